@@ -0,0 +1,388 @@
+// Headless frame benchmark harness for the Dear ImGui pipeline (no window, no GPU).
+// See bench.h for the scenario interface.
+
+// Usage: bench [options]
+//   --list               List available scenarios and exit
+//   --scenario NAME      Only run scenario NAME (may be repeated)
+//   --frames N           Override the number of measured frames of every scenario
+//   --warmup N           Number of unmeasured frames run before measuring (default: 2)
+//   --no-timings         Omit timing fields, so the output only contains deterministic values and can be diffed as is
+//   --out FILE           Write JSON to FILE instead of stdout
+// The JSON layout (key order, number formatting) is stable across runs.
+
+#include "bench.h"
+#include "imgui_internal.h"
+#include "tinycthread.h"
+#include <stdint.h>     // intptr_t
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+
+static const BenchScenario* g_Scenarios[] =
+{
+    &BenchScenario_DemoWindow,
+    &BenchScenario_Table10k,
+    &BenchScenario_TextLog,
+    &BenchScenario_TextLogGlyphRunCache,
+    &BenchScenario_InputTextMultiline1MB,
+    &BenchScenario_InputTextMultiline10MB,
+    &BenchScenario_InputTextMultiline200kLines,
+    &BenchScenario_StaticPanels,
+    &BenchScenario_StaticPanelsCached,
+    &BenchScenario_Polyline1M_Direct,
+    &BenchScenario_Polyline1M_Threads1,
+    &BenchScenario_Polyline1M_Threads2,
+    &BenchScenario_Polyline1M_Threads4,
+    &BenchScenario_Polyline1M_Threads8,
+    &BenchScenario_Polyline1M_Threads16,
+    &BenchScenario_PolylineThin_Scalar,
+    &BenchScenario_PolylineThin_SSE2,
+    &BenchScenario_PolylineThin_AVX2,
+    &BenchScenario_PolylineThick_Scalar,
+    &BenchScenario_PolylineThick_SSE2,
+    &BenchScenario_PolylineThick_AVX2,
+    &BenchScenario_HashLabels_Crc32,
+    &BenchScenario_HashLabels_Crc32c,
+    &BenchScenario_HashLabels_Mix64,
+    &BenchScenario_HashCollisions_Crc32,
+    &BenchScenario_HashCollisions_Crc32c,
+    &BenchScenario_HashCollisions_Mix64,
+    &BenchScenario_StorageInsert_Sorted1k,
+    &BenchScenario_StorageInsert_Sorted100k,
+    &BenchScenario_StorageInsert_Hashed1k,
+    &BenchScenario_StorageInsert_Hashed100k,
+    &BenchScenario_StorageInsert_Hashed1M,
+    &BenchScenario_StorageLookup_Sorted1k,
+    &BenchScenario_StorageLookup_Sorted100k,
+    &BenchScenario_StorageLookup_Sorted1M,
+    &BenchScenario_StorageLookup_Hashed1k,
+    &BenchScenario_StorageLookup_Hashed100k,
+    &BenchScenario_StorageLookup_Hashed1M,
+    &BenchScenario_StorageTree_Sorted100k,
+    &BenchScenario_StorageTree_Hashed100k,
+    &BenchScenario_SettingsLoad,
+    &BenchScenario_SettingsSave,
+    &BenchScenario_SettingsLoadBinary,
+    &BenchScenario_SettingsSaveBinary,
+    &BenchScenario_SettingsSaveDisk_Sync,
+    &BenchScenario_SettingsSaveDisk_Async,
+    &BenchScenario_PlotArray_10M,
+    &BenchScenario_PlotBuffer_10M,
+    &BenchScenario_VarRows1M_Unclipped,
+    &BenchScenario_VarRows1M_Clipped,
+    &BenchScenario_IndexView5M_AppSort,
+    &BenchScenario_IndexView5M_Sort,
+    &BenchScenario_IndexView5M_Sort_Threads4,
+    &BenchScenario_IndexView5M_AppFilter,
+    &BenchScenario_IndexView5M_Filter,
+    &BenchScenario_IndexView5M_Append,
+    &BenchScenario_WideTable_Static,
+    &BenchScenario_WideTable_ScrollX,
+    &BenchScenario_Tree1M_TreeNodes,
+    &BenchScenario_Tree1M_Virtual,
+    &BenchScenario_Tree1M_VirtualToggle,
+    &BenchScenario_FontAtlas_Serial,
+    &BenchScenario_FontAtlas_Threads1,
+    &BenchScenario_FontAtlas_Threads2,
+    &BenchScenario_FontAtlas_Threads4,
+    &BenchScenario_FontAtlas_Threads8,
+    &BenchScenario_FontAtlas_Cached,
+};
+
+//-----------------------------------------------------------------------------
+// Threading helpers
+//-----------------------------------------------------------------------------
+
+struct BenchWorker
+{
+    void            (*Func)(void* data, int index);
+    void*           Data;
+    int             Count;
+    int             First;
+    int             Stride;
+};
+
+static int BenchWorkerThreadFunc(void* arg)
+{
+    BenchWorker* worker = (BenchWorker*)arg;
+    for (int n = worker->First; n < worker->Count; n += worker->Stride)
+        worker->Func(worker->Data, n);
+    return 0;
+}
+
+// Spread tasks over threads with a fixed stride. ImGuiParallelForFn callers don't rely on the order of calls.
+void BenchParallelFor(int count, void (*func)(void* data, int index), void* data, void* user_data)
+{
+    const int thread_count = ImMin((int)(intptr_t)user_data, BENCH_MAX_THREADS);
+    BenchWorker workers[BENCH_MAX_THREADS];
+    thrd_t threads[BENCH_MAX_THREADS];
+    for (int n = 0; n < thread_count; n++)
+    {
+        BenchWorker worker = { func, data, count, n, thread_count };
+        workers[n] = worker;
+        thrd_create(&threads[n], BenchWorkerThreadFunc, &workers[n]);
+    }
+    for (int n = 0; n < thread_count; n++)
+        thrd_join(threads[n], NULL);
+}
+
+struct BenchAsyncJob
+{
+    void            (*Func)(void* data);
+    void*           Data;
+};
+
+static int BenchAsyncThreadFunc(void* arg)
+{
+    BenchAsyncJob job = *(BenchAsyncJob*)arg;
+    free(arg);
+    job.Func(job.Data);
+    return 0;
+}
+
+// Not allocated with IM_ALLOC(): the job is not part of the work measured by allocation counts.
+void BenchRunAsync(void (*func)(void* data), void* data, void* user_data)
+{
+    IM_UNUSED(user_data);
+    BenchAsyncJob* job = (BenchAsyncJob*)malloc(sizeof(BenchAsyncJob));
+    job->Func = func;
+    job->Data = data;
+    thrd_t thread;
+    thrd_create(&thread, BenchAsyncThreadFunc, job);
+    thrd_detach(thread);
+}
+
+//-----------------------------------------------------------------------------
+// Allocation counting
+//-----------------------------------------------------------------------------
+
+// Atomic: parallel font atlas builds (ImFontAtlas::BuildParallelForFn) and background jobs allocate from other threads.
+static std::atomic<unsigned long long> g_AllocCount(0);
+static std::atomic<unsigned long long> g_FreeCount(0);
+
+static void* BenchMemAlloc(size_t sz, void* user_data)
+{
+    IM_UNUSED(user_data);
+    g_AllocCount.fetch_add(1, std::memory_order_relaxed);
+    return malloc(sz);
+}
+
+static void BenchMemFree(void* ptr, void* user_data)
+{
+    IM_UNUSED(user_data);
+    if (ptr)
+        g_FreeCount.fetch_add(1, std::memory_order_relaxed);
+    free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+// Runner
+//-----------------------------------------------------------------------------
+
+struct BenchOptions
+{
+    int         Frames;             // <= 0: use scenario default
+    int         Warmup;
+    bool        NoTimings;
+    const char* Only[16];
+    int         OnlyCount;
+};
+
+struct BenchResult
+{
+    int         Frames;
+    double      FrameMsMin, FrameMsMax, FrameMsTotal;
+    int         Vertices, Indices, DrawLists, DrawCmds;     // From the ImDrawData of the last measured frame
+    unsigned long long Allocs, Frees;                       // Totals over the measured frames
+    int         DrawListCacheHits, DrawListCacheMisses;     // Totals over the measured frames (windows using ImGuiWindowFlags_CacheDrawList)
+    int         GlyphRunCacheHits, GlyphRunCacheMisses;     // Totals over the measured frames (io.ConfigGlyphRunCacheBudget > 0)
+    int         Value;                                      // BenchScenario::GetValue() after the last measured frame
+};
+
+static double BenchGetTimeMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+static void BenchRunFrame(const BenchScenario* scenario, int frame)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    if (scenario->Input)
+        scenario->Input(io, frame);
+    ImGui::NewFrame();
+    if (scenario->Submit)
+        scenario->Submit(frame);
+    ImGui::Render();
+}
+
+static void BenchRunScenario(const BenchScenario* scenario, const BenchOptions& opts, BenchResult* out)
+{
+    ImGui::SetAllocatorFunctions(BenchMemAlloc, BenchMemFree);
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.DeltaTime = 1.0f / 60.0f;                            // Fixed time step so that animations/timers are reproducible
+    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+    ImGui::StyleColorsDark();
+
+    // No renderer backend: build the atlas so NewFrame() is happy, the texture is never uploaded.
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsAlpha8(&tex_pixels, &tex_w, &tex_h);
+
+    if (scenario->Setup)
+        scenario->Setup();
+
+    int frame = 0;
+    for (int n = 0; n < opts.Warmup; n++)
+        BenchRunFrame(scenario, frame++);
+
+    memset(out, 0, sizeof(*out));
+    out->Frames = (opts.Frames > 0) ? opts.Frames : scenario->Frames;
+    out->FrameMsMin = 1e30;
+    const unsigned long long allocs_start = g_AllocCount.load();
+    const unsigned long long frees_start = g_FreeCount.load();
+    for (int n = 0; n < out->Frames; n++)
+    {
+        const double t0 = BenchGetTimeMs();
+        BenchRunFrame(scenario, frame++);
+        const double dt = BenchGetTimeMs() - t0;
+        out->FrameMsTotal += dt;
+        out->FrameMsMin = ImMin(out->FrameMsMin, dt);
+        out->FrameMsMax = ImMax(out->FrameMsMax, dt);
+        out->DrawListCacheHits += io.MetricsDrawListCacheHits;
+        out->DrawListCacheMisses += io.MetricsDrawListCacheMisses;
+        out->GlyphRunCacheHits += io.MetricsGlyphRunCacheHits;
+        out->GlyphRunCacheMisses += io.MetricsGlyphRunCacheMisses;
+    }
+    out->Allocs = g_AllocCount.load() - allocs_start;
+    out->Frees = g_FreeCount.load() - frees_start;
+
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    out->Vertices = draw_data->TotalVtxCount;
+    out->Indices = draw_data->TotalIdxCount;
+    out->DrawLists = draw_data->CmdListsCount;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+        out->DrawCmds += draw_data->CmdLists[n]->CmdBuffer.Size;
+    if (scenario->GetValue)
+        out->Value = scenario->GetValue();
+
+    if (scenario->Teardown)
+        scenario->Teardown();
+    ImGui::DestroyContext();
+}
+
+static bool BenchIsSelected(const BenchScenario* scenario, const BenchOptions& opts)
+{
+    if (opts.OnlyCount == 0)
+        return true;
+    for (int n = 0; n < opts.OnlyCount; n++)
+        if (strcmp(opts.Only[n], scenario->Name) == 0)
+            return true;
+    return false;
+}
+
+static void BenchWriteResult(FILE* f, const BenchScenario* scenario, const BenchResult& r, const BenchOptions& opts, bool last)
+{
+    fprintf(f, "    {\n");
+    fprintf(f, "      \"name\": \"%s\",\n", scenario->Name);
+    fprintf(f, "      \"frames\": %d,\n", r.Frames);
+    if (!opts.NoTimings)
+    {
+        fprintf(f, "      \"frame_ms_avg\": %.4f,\n", r.Frames > 0 ? r.FrameMsTotal / r.Frames : 0.0);
+        fprintf(f, "      \"frame_ms_min\": %.4f,\n", r.Frames > 0 ? r.FrameMsMin : 0.0);
+        fprintf(f, "      \"frame_ms_max\": %.4f,\n", r.FrameMsMax);
+        if (scenario->ItemsPerFrame > 0)
+            fprintf(f, "      \"items_per_sec\": %.0f,\n", r.FrameMsTotal > 0.0 ? (double)scenario->ItemsPerFrame * r.Frames * 1000.0 / r.FrameMsTotal : 0.0);
+    }
+    fprintf(f, "      \"vertices\": %d,\n", r.Vertices);
+    fprintf(f, "      \"indices\": %d,\n", r.Indices);
+    fprintf(f, "      \"draw_lists\": %d,\n", r.DrawLists);
+    fprintf(f, "      \"draw_cmds\": %d,\n", r.DrawCmds);
+    if (scenario->ValueName)
+        fprintf(f, "      \"%s\": %d,\n", scenario->ValueName, r.Value);
+    if (r.DrawListCacheHits + r.DrawListCacheMisses > 0)
+    {
+        fprintf(f, "      \"drawlist_cache_hits\": %d,\n", r.DrawListCacheHits);
+        fprintf(f, "      \"drawlist_cache_misses\": %d,\n", r.DrawListCacheMisses);
+    }
+    if (r.GlyphRunCacheHits + r.GlyphRunCacheMisses > 0)
+    {
+        fprintf(f, "      \"glyph_run_cache_hits\": %d,\n", r.GlyphRunCacheHits);
+        fprintf(f, "      \"glyph_run_cache_misses\": %d,\n", r.GlyphRunCacheMisses);
+    }
+    fprintf(f, "      \"allocs\": %llu,\n", r.Allocs);
+    fprintf(f, "      \"frees\": %llu\n", r.Frees);
+    fprintf(f, "    }%s\n", last ? "" : ",");
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions opts;
+    memset(&opts, 0, sizeof(opts));
+    opts.Warmup = 2;
+    const char* out_filename = NULL;
+
+    for (int n = 1; n < argc; n++)
+    {
+        const char* arg = argv[n];
+        const bool has_value = (n + 1 < argc);
+        if (strcmp(arg, "--list") == 0)
+        {
+            for (int i = 0; i < IM_ARRAYSIZE(g_Scenarios); i++)
+                printf("%s\n", g_Scenarios[i]->Name);
+            return 0;
+        }
+        else if (strcmp(arg, "--scenario") == 0 && has_value && opts.OnlyCount < IM_ARRAYSIZE(opts.Only))
+            opts.Only[opts.OnlyCount++] = argv[++n];
+        else if (strcmp(arg, "--frames") == 0 && has_value)
+            opts.Frames = atoi(argv[++n]);
+        else if (strcmp(arg, "--warmup") == 0 && has_value)
+            opts.Warmup = ImMax(atoi(argv[++n]), 0);
+        else if (strcmp(arg, "--no-timings") == 0)
+            opts.NoTimings = true;
+        else if (strcmp(arg, "--out") == 0 && has_value)
+            out_filename = argv[++n];
+        else
+        {
+            fprintf(stderr, "Unknown or incomplete argument '%s'\n", arg);
+            return 1;
+        }
+    }
+
+    FILE* f = out_filename ? fopen(out_filename, "wb") : stdout;
+    if (f == NULL)
+    {
+        fprintf(stderr, "Could not open '%s' for writing\n", out_filename);
+        return 1;
+    }
+
+    const BenchScenario* selected[IM_ARRAYSIZE(g_Scenarios)];
+    int selected_count = 0;
+    for (int n = 0; n < IM_ARRAYSIZE(g_Scenarios); n++)
+        if (BenchIsSelected(g_Scenarios[n], opts))
+            selected[selected_count++] = g_Scenarios[n];
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"imgui_version\": \"%s\",\n", IMGUI_VERSION);
+    fprintf(f, "  \"warmup_frames\": %d,\n", opts.Warmup);
+    fprintf(f, "  \"scenarios\": [\n");
+    for (int n = 0; n < selected_count; n++)
+    {
+        BenchResult result;
+        BenchRunScenario(selected[n], opts, &result);
+        BenchWriteResult(f, selected[n], result, opts, n + 1 == selected_count);
+        fflush(f);
+    }
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+
+    if (f != stdout)
+        fclose(f);
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Headless frame benchmark harness for the Dear ImGui pipeline.
+// Drives ImGui::NewFrame() -> widgets -> ImGui::Render() with a fake ImGuiIO (no platform/renderer backend),
+// and reports per-frame CPU time, ImDrawData vertex/index counts and allocation counts as JSON.
+// Build and run with 'make bench'. See bench.cpp for command-line options.
+
+#pragma once
+#include "imgui.h"
+
+// A scenario scripts the input of every frame then submits its widgets between NewFrame() and Render().
+// All callbacks are optional. 'frame' is the index of the frame being run, warm-up frames included.
+struct BenchScenario
+{
+    const char*     Name;
+    int             Frames;                                 // Default number of measured frames (overridden by --frames)
+    void            (*Setup)();                             // Called once after the context is created, before the first frame
+    void            (*Input)(ImGuiIO& io, int frame);       // Called before NewFrame(), queue scripted events with io.AddXXXEvent()
+    void            (*Submit)(int frame);                   // Called between NewFrame() and Render()
+    void            (*Teardown)();                          // Called once before the context is destroyed
+    int             ItemsPerFrame;                          // Optional: amount of work per frame (e.g. points), reported as items_per_sec
+    const char*     ValueName;                              // Optional: name of a deterministic value returned by GetValue() after the last frame
+    int             (*GetValue)();
+};
+
+// Threading helpers for scenarios (bench.cpp)
+static const int BENCH_MAX_THREADS = 16;
+void BenchParallelFor(int count, void (*func)(void* data, int index), void* data, void* user_data); // ImGuiParallelForFn running on (int)(intptr_t)user_data threads (at most BENCH_MAX_THREADS)
+void BenchRunAsync(void (*func)(void* data), void* data, void* user_data);                          // ImGuiAsyncJobFn running on a detached thread
+
+// Scenarios (bench_frames.cpp)
+extern const BenchScenario BenchScenario_DemoWindow;
+extern const BenchScenario BenchScenario_Table10k;
+extern const BenchScenario BenchScenario_TextLog;
+extern const BenchScenario BenchScenario_TextLogGlyphRunCache;
+extern const BenchScenario BenchScenario_InputTextMultiline1MB;
+extern const BenchScenario BenchScenario_InputTextMultiline10MB;
+extern const BenchScenario BenchScenario_InputTextMultiline200kLines;
+extern const BenchScenario BenchScenario_StaticPanels;
+extern const BenchScenario BenchScenario_StaticPanelsCached;
+
+// Scenarios (bench_drawlist.cpp)
+extern const BenchScenario BenchScenario_Polyline1M_Direct;
+extern const BenchScenario BenchScenario_Polyline1M_Threads1;
+extern const BenchScenario BenchScenario_Polyline1M_Threads2;
+extern const BenchScenario BenchScenario_Polyline1M_Threads4;
+extern const BenchScenario BenchScenario_Polyline1M_Threads8;
+extern const BenchScenario BenchScenario_Polyline1M_Threads16;
+extern const BenchScenario BenchScenario_PolylineThin_Scalar;
+extern const BenchScenario BenchScenario_PolylineThin_SSE2;
+extern const BenchScenario BenchScenario_PolylineThin_AVX2;
+extern const BenchScenario BenchScenario_PolylineThick_Scalar;
+extern const BenchScenario BenchScenario_PolylineThick_SSE2;
+extern const BenchScenario BenchScenario_PolylineThick_AVX2;
+
+// Scenarios (bench_hash.cpp)
+extern const BenchScenario BenchScenario_HashLabels_Crc32;
+extern const BenchScenario BenchScenario_HashLabels_Crc32c;
+extern const BenchScenario BenchScenario_HashLabels_Mix64;
+extern const BenchScenario BenchScenario_HashCollisions_Crc32;
+extern const BenchScenario BenchScenario_HashCollisions_Crc32c;
+extern const BenchScenario BenchScenario_HashCollisions_Mix64;
+
+// Scenarios (bench_storage.cpp)
+extern const BenchScenario BenchScenario_StorageInsert_Sorted1k;
+extern const BenchScenario BenchScenario_StorageInsert_Sorted100k;
+extern const BenchScenario BenchScenario_StorageInsert_Hashed1k;
+extern const BenchScenario BenchScenario_StorageInsert_Hashed100k;
+extern const BenchScenario BenchScenario_StorageInsert_Hashed1M;
+extern const BenchScenario BenchScenario_StorageLookup_Sorted1k;
+extern const BenchScenario BenchScenario_StorageLookup_Sorted100k;
+extern const BenchScenario BenchScenario_StorageLookup_Sorted1M;
+extern const BenchScenario BenchScenario_StorageLookup_Hashed1k;
+extern const BenchScenario BenchScenario_StorageLookup_Hashed100k;
+extern const BenchScenario BenchScenario_StorageLookup_Hashed1M;
+extern const BenchScenario BenchScenario_StorageTree_Sorted100k;
+extern const BenchScenario BenchScenario_StorageTree_Hashed100k;
+
+// Scenarios (bench_settings.cpp)
+extern const BenchScenario BenchScenario_SettingsLoad;
+extern const BenchScenario BenchScenario_SettingsSave;
+extern const BenchScenario BenchScenario_SettingsLoadBinary;
+extern const BenchScenario BenchScenario_SettingsSaveBinary;
+extern const BenchScenario BenchScenario_SettingsSaveDisk_Sync;
+extern const BenchScenario BenchScenario_SettingsSaveDisk_Async;
+
+// Scenarios (bench_plot.cpp)
+extern const BenchScenario BenchScenario_PlotArray_10M;
+extern const BenchScenario BenchScenario_PlotBuffer_10M;
+
+// Scenarios (bench_clipper.cpp)
+extern const BenchScenario BenchScenario_VarRows1M_Unclipped;
+extern const BenchScenario BenchScenario_VarRows1M_Clipped;
+
+// Scenarios (bench_index_view.cpp)
+extern const BenchScenario BenchScenario_IndexView5M_AppSort;
+extern const BenchScenario BenchScenario_IndexView5M_Sort;
+extern const BenchScenario BenchScenario_IndexView5M_Sort_Threads4;
+extern const BenchScenario BenchScenario_IndexView5M_AppFilter;
+extern const BenchScenario BenchScenario_IndexView5M_Filter;
+extern const BenchScenario BenchScenario_IndexView5M_Append;
+
+// Scenarios (bench_table_layout.cpp)
+extern const BenchScenario BenchScenario_WideTable_Static;
+extern const BenchScenario BenchScenario_WideTable_ScrollX;
+
+// Scenarios (bench_tree.cpp)
+extern const BenchScenario BenchScenario_Tree1M_TreeNodes;
+extern const BenchScenario BenchScenario_Tree1M_Virtual;
+extern const BenchScenario BenchScenario_Tree1M_VirtualToggle;
+
+// Scenarios (bench_fonts.cpp)
+extern const BenchScenario BenchScenario_FontAtlas_Serial;
+extern const BenchScenario BenchScenario_FontAtlas_Threads1;
+extern const BenchScenario BenchScenario_FontAtlas_Threads2;
+extern const BenchScenario BenchScenario_FontAtlas_Threads4;
+extern const BenchScenario BenchScenario_FontAtlas_Threads8;
+extern const BenchScenario BenchScenario_FontAtlas_Cached;
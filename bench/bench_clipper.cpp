@@ -0,0 +1,72 @@
+// Clipper scenarios: a table of 1M rows of different heights (multi-line cells and expanded rows), scrolled with the mouse
+// wheel and dragged to distant positions, submitting every row or only the visible rows with a variable height clipper.
+
+#include "bench.h"
+#include "imgui_internal.h"
+
+static const int VARROWS_COUNT = 1000 * 1000;
+
+static int VarRows_GetLinesCount(int row)
+{
+    const ImU32 hash = (ImU32)row * 2654435761u;
+    return ((hash >> 28) == 0) ? 6 : 1 + (int)((hash >> 16) % 3); // 1 in 16 rows is expanded
+}
+
+static void VarRows_SubmitRow(int row)
+{
+    ImGui::TableNextRow();
+    ImGui::TableNextColumn();
+    ImGui::Text("%d", row);
+    ImGui::TableNextColumn();
+    const int lines_count = VarRows_GetLinesCount(row);
+    for (int line = 0; line < lines_count; line++)
+        ImGui::Text("Entry %08X line %d", (ImU32)row * 2654435761u, line);
+    ImGui::TableNextColumn();
+    ImGui::Text("%.3f", row * 0.001f);
+}
+
+static void VarRows_Input(ImGuiIO& io, int frame)
+{
+    io.AddMousePosEvent(400.0f, 300.0f);
+    io.AddMouseWheelEvent(0.0f, (frame % 40 < 20) ? -1.0f : 1.0f);
+}
+
+static void VarRows_Submit(int frame, bool clip)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin("Variable Rows", NULL, ImGuiWindowFlags_NoDecoration);
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("##table", 3, flags))
+    {
+        if (frame % 10 == 0) // As when dragging the scrollbar
+            ImGui::SetScrollY(ImGui::GetScrollMaxY() * (float)((frame * 37) % 100) / 100.0f);
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Index");
+        ImGui::TableSetupColumn("Entry");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableHeadersRow();
+        if (clip)
+        {
+            ImGuiListClipper clipper;
+            clipper.BeginVariableHeight("##rows", VARROWS_COUNT);
+            while (clipper.Step())
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                    VarRows_SubmitRow(row);
+        }
+        else
+        {
+            for (int row = 0; row < VARROWS_COUNT; row++)
+                VarRows_SubmitRow(row);
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+static void VarRows_Unclipped_Submit(int frame)   { VarRows_Submit(frame, false); }
+static void VarRows_Clipped_Submit(int frame)     { VarRows_Submit(frame, true); }
+
+const BenchScenario BenchScenario_VarRows1M_Unclipped = { "table_1m_variable_rows_unclipped", 5, NULL, VarRows_Input, VarRows_Unclipped_Submit, NULL, VARROWS_COUNT, NULL, NULL };
+const BenchScenario BenchScenario_VarRows1M_Clipped = { "table_1m_variable_rows_clipped", 120, NULL, VarRows_Input, VarRows_Clipped_Submit, NULL, VARROWS_COUNT, NULL, NULL };
@@ -0,0 +1,160 @@
+// Draw list scenarios: heavy custom geometry submitted through ImDrawList.
+
+#include "bench.h"
+#include "imgui_internal.h"
+#include "tinycthread.h"
+
+//-----------------------------------------------------------------------------
+// 1M-segment polyline (oscilloscope-style trace), built either directly into the window draw list,
+// or split across N worker threads filling detached draw lists which are then spliced with AddDrawList().
+//-----------------------------------------------------------------------------
+
+static const int POLYLINE1M_SEGMENTS = 1000000;
+static const int POLYLINE1M_CHUNK = 1024;               // Segments per AddPolyline() call (each call needs its vertices addressable by ImDrawIdx)
+static const int POLYLINE1M_MAX_THREADS = 16;
+static ImVector<ImVec2> g_PolylinePoints;
+static ImDrawList*      g_PolylineLists[POLYLINE1M_MAX_THREADS];
+
+struct PolylineTask
+{
+    ImDrawList*     DrawList;
+    int             SegmentBegin;
+    int             SegmentEnd;
+};
+
+static void Polyline1M_AddSegments(ImDrawList* draw_list, int segment_begin, int segment_end)
+{
+    for (int n = segment_begin; n < segment_end; n += POLYLINE1M_CHUNK)
+    {
+        const int count = ImMin(POLYLINE1M_CHUNK, segment_end - n);
+        draw_list->AddPolyline(&g_PolylinePoints[n], count + 1, IM_COL32(90, 255, 120, 255), ImDrawFlags_None, 1.0f);
+    }
+}
+
+static int Polyline1M_ThreadFunc(void* arg)
+{
+    PolylineTask* task = (PolylineTask*)arg;
+    Polyline1M_AddSegments(task->DrawList, task->SegmentBegin, task->SegmentEnd);
+    return 0;
+}
+
+static void Polyline1M_Setup()
+{
+    // Lists past 64K vertices need ImDrawCmd::VtxOffset support from the renderer, we pretend to have one.
+    ImGui::GetIO().BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+    const ImVec2 display_size = ImGui::GetIO().DisplaySize;
+    g_PolylinePoints.resize(POLYLINE1M_SEGMENTS + 1);
+    for (int n = 0; n <= POLYLINE1M_SEGMENTS; n++)
+    {
+        const float t = (float)n / POLYLINE1M_SEGMENTS;
+        g_PolylinePoints[n] = ImVec2(t * display_size.x, display_size.y * (0.5f + 0.4f * ImSin(t * 600.0f) * ImCos(t * 7.0f)));
+    }
+    for (int n = 0; n < POLYLINE1M_MAX_THREADS; n++)
+        g_PolylineLists[n] = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+}
+
+static void Polyline1M_Teardown()
+{
+    for (int n = 0; n < POLYLINE1M_MAX_THREADS; n++)
+        IM_DELETE(g_PolylineLists[n]);
+    g_PolylinePoints.clear();
+}
+
+static void Polyline1M_Submit(int thread_count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin("Polyline 1M", NULL, ImGuiWindowFlags_NoDecoration);
+    ImDrawList* window_draw_list = ImGui::GetWindowDrawList();
+    if (thread_count == 0)
+    {
+        Polyline1M_AddSegments(window_draw_list, 0, POLYLINE1M_SEGMENTS);
+    }
+    else
+    {
+        PolylineTask tasks[POLYLINE1M_MAX_THREADS];
+        thrd_t threads[POLYLINE1M_MAX_THREADS];
+        for (int n = 0; n < thread_count; n++)
+        {
+            g_PolylineLists[n]->ResetDetached();
+            tasks[n].DrawList = g_PolylineLists[n];
+            tasks[n].SegmentBegin = (int)((long long)POLYLINE1M_SEGMENTS * n / thread_count);
+            tasks[n].SegmentEnd = (int)((long long)POLYLINE1M_SEGMENTS * (n + 1) / thread_count);
+            thrd_create(&threads[n], Polyline1M_ThreadFunc, &tasks[n]);
+        }
+        for (int n = 0; n < thread_count; n++)
+            thrd_join(threads[n], NULL);
+        for (int n = 0; n < thread_count; n++)
+            window_draw_list->AddDrawList(g_PolylineLists[n]);
+    }
+    ImGui::End();
+}
+
+static void Polyline1M_Direct_Submit(int)       { Polyline1M_Submit(0); }
+static void Polyline1M_Threads1_Submit(int)     { Polyline1M_Submit(1); }
+static void Polyline1M_Threads2_Submit(int)     { Polyline1M_Submit(2); }
+static void Polyline1M_Threads4_Submit(int)     { Polyline1M_Submit(4); }
+static void Polyline1M_Threads8_Submit(int)     { Polyline1M_Submit(8); }
+static void Polyline1M_Threads16_Submit(int)    { Polyline1M_Submit(16); }
+
+const BenchScenario BenchScenario_Polyline1M_Direct = { "polyline_1m_direct", 10, Polyline1M_Setup, NULL, Polyline1M_Direct_Submit, Polyline1M_Teardown, 0, NULL, NULL };
+const BenchScenario BenchScenario_Polyline1M_Threads1 = { "polyline_1m_threads_1", 10, Polyline1M_Setup, NULL, Polyline1M_Threads1_Submit, Polyline1M_Teardown, 0, NULL, NULL };
+const BenchScenario BenchScenario_Polyline1M_Threads2 = { "polyline_1m_threads_2", 10, Polyline1M_Setup, NULL, Polyline1M_Threads2_Submit, Polyline1M_Teardown, 0, NULL, NULL };
+const BenchScenario BenchScenario_Polyline1M_Threads4 = { "polyline_1m_threads_4", 10, Polyline1M_Setup, NULL, Polyline1M_Threads4_Submit, Polyline1M_Teardown, 0, NULL, NULL };
+const BenchScenario BenchScenario_Polyline1M_Threads8 = { "polyline_1m_threads_8", 10, Polyline1M_Setup, NULL, Polyline1M_Threads8_Submit, Polyline1M_Teardown, 0, NULL, NULL };
+const BenchScenario BenchScenario_Polyline1M_Threads16 = { "polyline_1m_threads_16", 10, Polyline1M_Setup, NULL, Polyline1M_Threads16_Submit, Polyline1M_Teardown, 0, NULL, NULL };
+
+//-----------------------------------------------------------------------------
+// Anti-aliased polyline tessellation (64K points per frame), for each SIMD level of AddPolyline().
+// Levels not supported by the CPU fall back to the best supported one.
+//-----------------------------------------------------------------------------
+
+static const int POLYLINE_AA_POINTS = 65536;
+static const int POLYLINE_AA_CHUNK = 4096;              // Points per AddPolyline() call
+static float g_PolylineAAThickness;
+
+static void PolylineAA_Setup(ImDrawSimdLevel simd_level, float thickness)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+    ImGui::GetDrawListSharedData()->SimdLevel = ImMin(simd_level, ImDrawGetMaxSimdLevel());
+    g_PolylineAAThickness = thickness;
+    g_PolylinePoints.resize(POLYLINE_AA_POINTS);
+    for (int n = 0; n < POLYLINE_AA_POINTS; n++)
+    {
+        const float t = (float)n / POLYLINE_AA_POINTS;
+        g_PolylinePoints[n] = ImVec2(t * io.DisplaySize.x, io.DisplaySize.y * (0.5f + 0.4f * ImSin(t * 300.0f) * ImCos(t * 5.0f)));
+    }
+}
+
+static void PolylineAA_Teardown()
+{
+    g_PolylinePoints.clear();
+}
+
+static void PolylineAA_Submit(int)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin("Polyline AA", NULL, ImGuiWindowFlags_NoDecoration);
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    for (int n = 0; n < POLYLINE_AA_POINTS - 1; n += POLYLINE_AA_CHUNK - 1)
+        draw_list->AddPolyline(&g_PolylinePoints[n], ImMin(POLYLINE_AA_CHUNK, POLYLINE_AA_POINTS - n), IM_COL32(90, 255, 120, 255), ImDrawFlags_None, g_PolylineAAThickness);
+    ImGui::End();
+}
+
+static void PolylineThin_Scalar_Setup()     { PolylineAA_Setup(ImDrawSimdLevel_Scalar, 1.0f); }
+static void PolylineThin_SSE2_Setup()       { PolylineAA_Setup(ImDrawSimdLevel_SSE2, 1.0f); }
+static void PolylineThin_AVX2_Setup()       { PolylineAA_Setup(ImDrawSimdLevel_AVX2, 1.0f); }
+static void PolylineThick_Scalar_Setup()    { PolylineAA_Setup(ImDrawSimdLevel_Scalar, 3.5f); }
+static void PolylineThick_SSE2_Setup()      { PolylineAA_Setup(ImDrawSimdLevel_SSE2, 3.5f); }
+static void PolylineThick_AVX2_Setup()      { PolylineAA_Setup(ImDrawSimdLevel_AVX2, 3.5f); }
+
+const BenchScenario BenchScenario_PolylineThin_Scalar = { "polyline_aa_thin_scalar", 100, PolylineThin_Scalar_Setup, NULL, PolylineAA_Submit, PolylineAA_Teardown, POLYLINE_AA_POINTS, NULL, NULL };
+const BenchScenario BenchScenario_PolylineThin_SSE2 = { "polyline_aa_thin_sse2", 100, PolylineThin_SSE2_Setup, NULL, PolylineAA_Submit, PolylineAA_Teardown, POLYLINE_AA_POINTS, NULL, NULL };
+const BenchScenario BenchScenario_PolylineThin_AVX2 = { "polyline_aa_thin_avx2", 100, PolylineThin_AVX2_Setup, NULL, PolylineAA_Submit, PolylineAA_Teardown, POLYLINE_AA_POINTS, NULL, NULL };
+const BenchScenario BenchScenario_PolylineThick_Scalar = { "polyline_aa_thick_scalar", 100, PolylineThick_Scalar_Setup, NULL, PolylineAA_Submit, PolylineAA_Teardown, POLYLINE_AA_POINTS, NULL, NULL };
+const BenchScenario BenchScenario_PolylineThick_SSE2 = { "polyline_aa_thick_sse2", 100, PolylineThick_SSE2_Setup, NULL, PolylineAA_Submit, PolylineAA_Teardown, POLYLINE_AA_POINTS, NULL, NULL };
+const BenchScenario BenchScenario_PolylineThick_AVX2 = { "polyline_aa_thick_avx2", 100, PolylineThick_AVX2_Setup, NULL, PolylineAA_Submit, PolylineAA_Teardown, POLYLINE_AA_POINTS, NULL, NULL };
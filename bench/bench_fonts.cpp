@@ -0,0 +1,55 @@
+// Font scenarios: startup work on ImFontAtlas.
+
+#include "bench.h"
+#include "imgui_internal.h"
+#include <stdint.h>     // intptr_t
+#include <stdio.h>      // remove
+
+//-----------------------------------------------------------------------------
+// Atlas build of the default font at many sizes with oversampling, rasterized on the calling thread
+// or on N worker threads through ImFontAtlas::BuildParallelForFn. Each frame builds a new atlas.
+//-----------------------------------------------------------------------------
+
+static const float FONTATLAS_SIZES[] = { 13.0f, 16.0f, 20.0f, 24.0f, 32.0f, 40.0f, 48.0f, 64.0f, 80.0f, 96.0f };
+
+static const char* FONTATLAS_CACHE_FILENAME = "bench_font_atlas.cache";
+
+static void FontAtlas_Build(int thread_count, const char* cache_filename = NULL)
+{
+    ImFontAtlas* atlas = IM_NEW(ImFontAtlas)();
+    atlas->BuildCacheFilename = cache_filename;
+    if (thread_count > 0)
+    {
+        atlas->BuildParallelForFn = BenchParallelFor;
+        atlas->BuildParallelForUserData = (void*)(intptr_t)thread_count;
+    }
+    for (int n = 0; n < IM_ARRAYSIZE(FONTATLAS_SIZES); n++)
+    {
+        ImFontConfig cfg;
+        cfg.SizePixels = FONTATLAS_SIZES[n];
+        cfg.OversampleH = 3;
+        cfg.OversampleV = 1;
+        cfg.PixelSnapH = false;
+        atlas->AddFontDefault(&cfg);
+    }
+    atlas->Build();
+    IM_DELETE(atlas);
+}
+
+static void FontAtlas_Serial_Submit(int)        { FontAtlas_Build(0); }
+static void FontAtlas_Threads1_Submit(int)      { FontAtlas_Build(1); }
+static void FontAtlas_Threads2_Submit(int)      { FontAtlas_Build(2); }
+static void FontAtlas_Threads4_Submit(int)      { FontAtlas_Build(4); }
+static void FontAtlas_Threads8_Submit(int)      { FontAtlas_Build(8); }
+
+// Same atlas loaded from the cache file written by Setup()
+static void FontAtlas_Cached_Setup()            { remove(FONTATLAS_CACHE_FILENAME); FontAtlas_Build(0, FONTATLAS_CACHE_FILENAME); }
+static void FontAtlas_Cached_Submit(int)        { FontAtlas_Build(0, FONTATLAS_CACHE_FILENAME); }
+static void FontAtlas_Cached_Teardown()         { remove(FONTATLAS_CACHE_FILENAME); }
+
+const BenchScenario BenchScenario_FontAtlas_Serial = { "font_atlas_build_serial", 10, NULL, NULL, FontAtlas_Serial_Submit, NULL, 0, NULL, NULL };
+const BenchScenario BenchScenario_FontAtlas_Threads1 = { "font_atlas_build_threads_1", 10, NULL, NULL, FontAtlas_Threads1_Submit, NULL, 0, NULL, NULL };
+const BenchScenario BenchScenario_FontAtlas_Threads2 = { "font_atlas_build_threads_2", 10, NULL, NULL, FontAtlas_Threads2_Submit, NULL, 0, NULL, NULL };
+const BenchScenario BenchScenario_FontAtlas_Threads4 = { "font_atlas_build_threads_4", 10, NULL, NULL, FontAtlas_Threads4_Submit, NULL, 0, NULL, NULL };
+const BenchScenario BenchScenario_FontAtlas_Threads8 = { "font_atlas_build_threads_8", 10, NULL, NULL, FontAtlas_Threads8_Submit, NULL, 0, NULL, NULL };
+const BenchScenario BenchScenario_FontAtlas_Cached = { "font_atlas_build_cached", 10, FontAtlas_Cached_Setup, NULL, FontAtlas_Cached_Submit, FontAtlas_Cached_Teardown, 0, NULL, NULL };
@@ -0,0 +1,249 @@
+// Frame scenarios: full NewFrame() -> widgets -> Render() passes over typical and pathological content.
+
+#include "bench.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Demo window, covering the display with a few top-level sections open and the mouse sweeping over it.
+//-----------------------------------------------------------------------------
+
+static void DemoWindow_Input(ImGuiIO& io, int frame)
+{
+    const float t = (float)(frame % 120) / 120.0f;
+    io.AddMousePosEvent(io.DisplaySize.x * t, io.DisplaySize.y * t);
+}
+
+static void DemoWindow_Submit(int frame)
+{
+    // Once the window exists: make it cover the display (ShowDemoWindow() only sizes it on first use)
+    // and open a few sections. CollapsingHeader() doesn't push an ID so the seed is the window ID.
+    if (frame == 1)
+        if (ImGuiWindow* window = ImGui::FindWindowByName("Dear ImGui Demo"))
+        {
+            ImGui::SetWindowPos(window->Name, ImVec2(0.0f, 0.0f));
+            ImGui::SetWindowSize(window->Name, ImGui::GetIO().DisplaySize);
+            const char* headers[] = { "Widgets", "Layout & Scrolling", "Tables & Columns" };
+            for (int n = 0; n < IM_ARRAYSIZE(headers); n++)
+                window->StateStorage.SetInt(ImHashStr(headers[n], 0, window->ID), 1);
+        }
+    ImGui::ShowDemoWindow();
+}
+
+const BenchScenario BenchScenario_DemoWindow = { "demo_window", 240, NULL, DemoWindow_Input, DemoWindow_Submit, NULL, 0, NULL, NULL };
+
+//-----------------------------------------------------------------------------
+// Table with 10k rows, all submitted every frame (no clipper), with scrolling.
+//-----------------------------------------------------------------------------
+
+static const int TABLE10K_ROWS = 10000;
+
+static void Table10k_Input(ImGuiIO& io, int frame)
+{
+    io.AddMousePosEvent(400.0f, 300.0f + (float)(frame % 50) * 4.0f);
+    io.AddMouseWheelEvent(0.0f, (frame % 40 < 20) ? -1.0f : 1.0f);
+}
+
+static void Table10k_Submit(int frame)
+{
+    IM_UNUSED(frame);
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin("Table 10k", NULL, ImGuiWindowFlags_NoDecoration);
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("##table", 4, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Index");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Flag");
+        ImGui::TableHeadersRow();
+        for (int row = 0; row < TABLE10K_ROWS; row++)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", row);
+            ImGui::TableNextColumn();
+            ImGui::Text("Item %04X", row * 2654435761u >> 16);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", row * 0.001f);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted((row & 1) ? "odd" : "even");
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+const BenchScenario BenchScenario_Table10k = { "table_10k", 60, NULL, Table10k_Input, Table10k_Submit, NULL, 0, NULL, NULL };
+
+//-----------------------------------------------------------------------------
+// Log view: a screen of long text lines and wrapped paragraphs which don't change, with and without io.ConfigGlyphRunCacheBudget.
+//-----------------------------------------------------------------------------
+
+static const int TEXTLOG_LINES = 60;
+
+static void TextLog_Setup()
+{
+    ImGui::GetIO().ConfigGlyphRunCacheBudget = 4 * 1024 * 1024;
+}
+
+static void TextLog_Submit(int frame)
+{
+    IM_UNUSED(frame);
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin("Log", NULL, ImGuiWindowFlags_NoDecoration);
+    ImGui::Columns(2, "##log", false);
+    for (int line = 0; line < TEXTLOG_LINES; line++)
+        ImGui::Text("%02d:%02d:%02d.%03d [info] renderer: frame %d presented, %d draw calls, %d vertices", line / 3600, (line / 60) % 60, line % 60, (line * 37) % 1000, line * 3, 40 + line, 12000 + line * 17);
+    ImGui::NextColumn();
+    for (int line = 0; line < TEXTLOG_LINES / 4; line++)
+        ImGui::TextWrapped("Note %d: the quick brown fox jumps over the lazy dog, then sits down for a while and watches the clouds go by.", line);
+    ImGui::Columns(1);
+    ImGui::End();
+}
+
+const BenchScenario BenchScenario_TextLog = { "text_log", 120, NULL, NULL, TextLog_Submit, NULL, 0, NULL, NULL };
+const BenchScenario BenchScenario_TextLogGlyphRunCache = { "text_log_glyph_run_cache", 120, TextLog_Setup, NULL, TextLog_Submit, NULL, 0, NULL, NULL };
+
+//-----------------------------------------------------------------------------
+// InputTextMultiline() over a 1 MB or 10 MB buffer, activated by a click then typed into.
+// The 200k lines variant first jumps to the end of the text, so the visible lines are far from the start.
+//-----------------------------------------------------------------------------
+
+static char* g_InputTextBuf = NULL;
+static int g_InputTextCapacity = 0;
+
+static void InputTextMultiline_Setup(int size)
+{
+    g_InputTextCapacity = size + 64 * 1024;    // Leave room for typed characters
+    g_InputTextBuf = (char*)IM_ALLOC(g_InputTextCapacity);
+    int len = 0;
+    for (int line = 0; len < size; line++)
+    {
+        char line_buf[96];
+        int line_len = ImFormatString(line_buf, IM_ARRAYSIZE(line_buf), "%06d: The quick brown fox jumps over the lazy dog.\n", line);
+        line_len = ImMin(line_len, size - len);
+        memcpy(g_InputTextBuf + len, line_buf, (size_t)line_len);
+        len += line_len;
+    }
+    g_InputTextBuf[len] = 0;
+}
+
+static void InputTextMultiline1MB_Setup()   { InputTextMultiline_Setup(1024 * 1024); }
+static void InputTextMultiline10MB_Setup()  { InputTextMultiline_Setup(10 * 1024 * 1024); }
+static void InputTextMultiline200kLines_Setup() { InputTextMultiline_Setup(200000 * 53); } // 53 bytes per line
+
+static void InputTextMultiline_Input(ImGuiIO& io, int frame)
+{
+    // Click inside the widget to activate it (once its window exists), then type and move the cursor around
+    io.AddMousePosEvent(300.0f, 200.0f);
+    if (frame == 1 || frame == 2)
+        io.AddMouseButtonEvent(0, frame == 1);
+    else if (frame % 8 == 7)
+    {
+        const bool down = (frame % 16) == 7;
+        io.AddKeyEvent(ImGuiKey_DownArrow, down);
+    }
+    else
+        io.AddInputCharacter('a' + (frame % 26));
+}
+
+static void InputTextMultilineEnd_Input(ImGuiIO& io, int frame)
+{
+    // Same as above, but CTRL+End once active and moving up instead of down
+    io.AddMousePosEvent(300.0f, 200.0f);
+    if (frame == 1 || frame == 2)
+        io.AddMouseButtonEvent(0, frame == 1);
+    else if (frame == 3 || frame == 4)
+    {
+        io.AddKeyEvent(ImGuiKey_ModCtrl, frame == 3);
+        io.AddKeyEvent(ImGuiKey_End, frame == 3);
+    }
+    else if (frame % 8 == 7)
+    {
+        const bool down = (frame % 16) == 7;
+        io.AddKeyEvent(ImGuiKey_UpArrow, down);
+    }
+    else
+        io.AddInputCharacter('a' + (frame % 26));
+}
+
+static void InputTextMultiline_Submit(int frame)
+{
+    IM_UNUSED(frame);
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin("InputText", NULL, ImGuiWindowFlags_NoDecoration);
+    ImGui::InputTextMultiline("##text", g_InputTextBuf, (size_t)g_InputTextCapacity, ImVec2(-FLT_MIN, -FLT_MIN));
+    ImGui::End();
+}
+
+static void InputTextMultiline_Teardown()
+{
+    IM_FREE(g_InputTextBuf);
+    g_InputTextBuf = NULL;
+}
+
+const BenchScenario BenchScenario_InputTextMultiline1MB = { "inputtext_multiline_1mb", 60, InputTextMultiline1MB_Setup, InputTextMultiline_Input, InputTextMultiline_Submit, InputTextMultiline_Teardown, 0, NULL, NULL };
+const BenchScenario BenchScenario_InputTextMultiline10MB = { "inputtext_multiline_10mb", 30, InputTextMultiline10MB_Setup, InputTextMultiline_Input, InputTextMultiline_Submit, InputTextMultiline_Teardown, 0, NULL, NULL };
+const BenchScenario BenchScenario_InputTextMultiline200kLines = { "inputtext_multiline_200k_lines", 30, InputTextMultiline200kLines_Setup, InputTextMultilineEnd_Input, InputTextMultiline_Submit, InputTextMultiline_Teardown, 0, NULL, NULL };
+
+//-----------------------------------------------------------------------------
+// Static monitoring panels: a grid of windows whose contents don't change, with and without ImGuiWindowFlags_CacheDrawList.
+//-----------------------------------------------------------------------------
+
+static const int STATICPANELS_COLUMNS = 4;
+static const int STATICPANELS_ROWS = 2;
+static const int STATICPANELS_VALUES = 64;
+
+static void StaticPanels_SubmitWithFlags(ImGuiWindowFlags flags)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    const ImVec2 panel_size(io.DisplaySize.x / STATICPANELS_COLUMNS, io.DisplaySize.y / STATICPANELS_ROWS);
+    float values[STATICPANELS_VALUES];
+    for (int n = 0; n < STATICPANELS_VALUES; n++)
+        values[n] = ImSin(n * 0.2f);
+    for (int panel = 0; panel < STATICPANELS_COLUMNS * STATICPANELS_ROWS; panel++)
+    {
+        char name[32];
+        ImFormatString(name, IM_ARRAYSIZE(name), "Panel %d", panel);
+        ImGui::SetNextWindowPos(ImVec2((panel % STATICPANELS_COLUMNS) * panel_size.x, (panel / STATICPANELS_COLUMNS) * panel_size.y));
+        ImGui::SetNextWindowSize(panel_size);
+        ImGui::Begin(name, NULL, flags | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize);
+        ImGui::PlotLines("##plot", values, STATICPANELS_VALUES, 0, NULL, -1.0f, 1.0f, ImVec2(-FLT_MIN, 60.0f));
+        if (ImGui::BeginTable("##sensors", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            for (int row = 0; row < 24; row++)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("Sensor %02d.%02d", panel, row);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", values[row]);
+                ImGui::TableNextColumn();
+                ImGui::ProgressBar(values[row] * 0.5f + 0.5f, ImVec2(-FLT_MIN, 0.0f));
+            }
+            ImGui::EndTable();
+        }
+        ImGui::End();
+    }
+}
+
+static void StaticPanels_Input(ImGuiIO& io, int frame)
+{
+    IM_UNUSED(frame);
+    io.AddMousePosEvent(-FLT_MAX, -FLT_MAX);
+}
+
+static void StaticPanels_Submit(int)        { StaticPanels_SubmitWithFlags(ImGuiWindowFlags_None); }
+static void StaticPanelsCached_Submit(int)  { StaticPanels_SubmitWithFlags(ImGuiWindowFlags_CacheDrawList); }
+
+const BenchScenario BenchScenario_StaticPanels = { "static_panels", 120, NULL, StaticPanels_Input, StaticPanels_Submit, NULL, 0, NULL, NULL };
+const BenchScenario BenchScenario_StaticPanelsCached = { "static_panels_cached", 120, NULL, StaticPanels_Input, StaticPanelsCached_Submit, NULL, 0, NULL, NULL };
@@ -0,0 +1,146 @@
+// Hash scenarios: ID hashing backends (ImHashStrXXX/ImHashDataXXX) on labels and integers as pushed by widgets.
+
+#include "bench.h"
+#include "imgui_internal.h"
+
+//-----------------------------------------------------------------------------
+// Corpus of IDs computed the way GetID()/PushID() would: zero-terminated labels (plain, "##" suffixes, "###" overrides,
+// long descriptive labels) and integers, each hashed with the seed of one of many windows/tree nodes.
+//-----------------------------------------------------------------------------
+
+static const int HASH_SEEDS = 256;
+static const int HASH_LABELS = 4096;
+static const int HASH_INTS = 1024;
+static const int HASH_LABELS_PASSES = 16;               // Passes over the corpus per frame (with the seed of a different window every time)
+
+struct HashBackend
+{
+    ImGuiID         (*HashData)(const void* data, size_t data_size, ImU32 seed);
+    ImGuiID         (*HashStr)(const char* data, size_t data_size, ImU32 seed);
+};
+
+static const HashBackend HASH_BACKEND_CRC32 = { ImHashDataCrc32, ImHashStrCrc32 };
+static const HashBackend HASH_BACKEND_CRC32C = { ImHashDataCrc32c, ImHashStrCrc32c };
+static const HashBackend HASH_BACKEND_MIX64 = { ImHashDataMix64, ImHashStrMix64 };
+
+static const HashBackend*   g_HashBackend = NULL;
+static ImGuiTextBuffer      g_HashLabelsBuf;
+static ImVector<int>        g_HashLabelsOffsets;
+static ImVector<ImGuiID>    g_HashSeeds;
+static volatile ImGuiID     g_HashSink;                 // Keep the compiler from discarding the hashes
+static int                  g_HashCollisions;
+
+static void Hash_BuildCorpus(const HashBackend* backend)
+{
+    static const char* words[] = { "Button", "Checkbox", "Radio", "Color", "Enable", "Show", "Filter", "Options", "Save", "Open...", "Width", "Height", "Speed", "Name", "Value", "Flags" };
+    g_HashBackend = backend;
+    g_HashLabelsBuf.clear();
+    g_HashLabelsOffsets.resize(0);
+    for (int n = 0; n < HASH_LABELS; n++)
+    {
+        g_HashLabelsOffsets.push_back(g_HashLabelsBuf.size());
+        const char* word = words[n % IM_ARRAYSIZE(words)];
+        switch (n % 6)
+        {
+        case 0: g_HashLabelsBuf.appendf("%s %d", word, n); break;
+        case 1: g_HashLabelsBuf.appendf("Item %d", n); break;
+        case 2: g_HashLabelsBuf.appendf("%s##%d", word, n); break;
+        case 3: g_HashLabelsBuf.appendf("##hidden%d", n); break;
+        case 4: g_HashLabelsBuf.appendf("%s: %d items###panel%d", word, n * 7, n); break;
+        case 5: g_HashLabelsBuf.appendf("Some longer descriptive label for the %s setting number %d", word, n); break;
+        }
+        g_HashLabelsBuf.Buf.push_back(0); // Keep the zero-terminator of each label, the next one is appended after it
+    }
+    g_HashSeeds.resize(HASH_SEEDS);
+    for (int n = 0; n < HASH_SEEDS; n++)
+    {
+        char window_name[32];
+        ImFormatString(window_name, IM_ARRAYSIZE(window_name), "Window %d", n);
+        g_HashSeeds[n] = backend->HashStr(window_name, 0, 0);
+    }
+}
+
+static ImGuiID Hash_HashCorpus(const HashBackend* backend, ImGuiID seed, ImGuiID* out_ids)
+{
+    ImGuiID acc = 0;
+    const char* labels = g_HashLabelsBuf.begin();
+    for (int n = 0; n < HASH_LABELS; n++)
+    {
+        const ImGuiID id = backend->HashStr(labels + g_HashLabelsOffsets[n], 0, seed);
+        if (out_ids)
+            *out_ids++ = id;
+        acc ^= id;
+    }
+    for (int n = 0; n < HASH_INTS; n++)
+    {
+        const ImGuiID id = backend->HashData(&n, sizeof(n), seed);
+        if (out_ids)
+            *out_ids++ = id;
+        acc ^= id;
+    }
+    return acc;
+}
+
+//-----------------------------------------------------------------------------
+// Throughput: IDs per second (reported as items_per_sec).
+//-----------------------------------------------------------------------------
+
+static void HashLabels_Crc32_Setup()    { Hash_BuildCorpus(&HASH_BACKEND_CRC32); }
+static void HashLabels_Crc32c_Setup()   { Hash_BuildCorpus(&HASH_BACKEND_CRC32C); }
+static void HashLabels_Mix64_Setup()    { Hash_BuildCorpus(&HASH_BACKEND_MIX64); }
+
+static void HashLabels_Submit(int frame)
+{
+    ImGuiID acc = 0;
+    for (int pass = 0; pass < HASH_LABELS_PASSES; pass++)
+        acc ^= Hash_HashCorpus(g_HashBackend, g_HashSeeds[(frame * HASH_LABELS_PASSES + pass) % HASH_SEEDS], NULL);
+    g_HashSink = acc;
+}
+
+static void Hash_Teardown()
+{
+    g_HashLabelsBuf.Buf.clear();
+    g_HashLabelsOffsets.clear();
+    g_HashSeeds.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Collisions: the whole corpus under every seed (1.3M IDs), sorted to count the IDs equal to another one.
+// For reference, an ideal 32-bit hash gives ~200 collisions for that many IDs.
+//-----------------------------------------------------------------------------
+
+static int IMGUI_CDECL Hash_CompareIDs(const void* lhs, const void* rhs)
+{
+    const ImGuiID a = *(const ImGuiID*)lhs;
+    const ImGuiID b = *(const ImGuiID*)rhs;
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+static void HashCollisions_Setup(const HashBackend* backend)
+{
+    Hash_BuildCorpus(backend);
+    const int ids_per_seed = HASH_LABELS + HASH_INTS;
+    ImVector<ImGuiID> ids;
+    ids.resize(HASH_SEEDS * ids_per_seed);
+    for (int n = 0; n < HASH_SEEDS; n++)
+        Hash_HashCorpus(backend, g_HashSeeds[n], ids.Data + n * ids_per_seed);
+    ImQsort(ids.Data, (size_t)ids.Size, sizeof(ImGuiID), Hash_CompareIDs);
+    g_HashCollisions = 0;
+    for (int n = 1; n < ids.Size; n++)
+        if (ids[n] == ids[n - 1])
+            g_HashCollisions++;
+}
+
+static void HashCollisions_Crc32_Setup()    { HashCollisions_Setup(&HASH_BACKEND_CRC32); }
+static void HashCollisions_Crc32c_Setup()   { HashCollisions_Setup(&HASH_BACKEND_CRC32C); }
+static void HashCollisions_Mix64_Setup()    { HashCollisions_Setup(&HASH_BACKEND_MIX64); }
+static int  HashCollisions_GetValue()       { return g_HashCollisions; }
+
+static const int HASH_LABELS_ITEMS_PER_FRAME = (HASH_LABELS + HASH_INTS) * HASH_LABELS_PASSES;
+
+const BenchScenario BenchScenario_HashLabels_Crc32 = { "hash_labels_crc32", 60, HashLabels_Crc32_Setup, NULL, HashLabels_Submit, Hash_Teardown, HASH_LABELS_ITEMS_PER_FRAME, NULL, NULL };
+const BenchScenario BenchScenario_HashLabels_Crc32c = { "hash_labels_crc32c", 60, HashLabels_Crc32c_Setup, NULL, HashLabels_Submit, Hash_Teardown, HASH_LABELS_ITEMS_PER_FRAME, NULL, NULL };
+const BenchScenario BenchScenario_HashLabels_Mix64 = { "hash_labels_mix64", 60, HashLabels_Mix64_Setup, NULL, HashLabels_Submit, Hash_Teardown, HASH_LABELS_ITEMS_PER_FRAME, NULL, NULL };
+const BenchScenario BenchScenario_HashCollisions_Crc32 = { "hash_collisions_crc32", 1, HashCollisions_Crc32_Setup, NULL, NULL, Hash_Teardown, 0, "hash_collisions", HashCollisions_GetValue };
+const BenchScenario BenchScenario_HashCollisions_Crc32c = { "hash_collisions_crc32c", 1, HashCollisions_Crc32c_Setup, NULL, NULL, Hash_Teardown, 0, "hash_collisions", HashCollisions_GetValue };
+const BenchScenario BenchScenario_HashCollisions_Mix64 = { "hash_collisions_mix64", 1, HashCollisions_Mix64_Setup, NULL, NULL, Hash_Teardown, 0, "hash_collisions", HashCollisions_GetValue };
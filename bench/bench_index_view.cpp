@@ -0,0 +1,229 @@
+// Index view scenarios: sorting, filtering and appending to a table of 5M rows, as application code does it
+// (sort the whole data set when the sort specs change, test the filter on every row every frame) and with ImGuiTableIndexView.
+
+#include "bench.h"
+#include "imgui_internal.h"
+#include <stdint.h>     // intptr_t
+#include <string.h>     // strcmp
+
+static const int INDEXVIEW_ROWS = 5 * 1000 * 1000;
+static const int INDEXVIEW_APPEND_PER_FRAME = 10000;
+
+struct IndexViewRow
+{
+    int         ID;
+    int         Quantity;
+    char        Name[16];
+};
+
+static ImVector<IndexViewRow>   g_IndexViewRows;
+static ImGuiTableIndexView      g_IndexView;
+static ImGuiTextFilter          g_IndexViewFilter;
+static ImVector<int>            g_IndexViewAppRows;     // Application-side sorted indices (baseline)
+static int                      g_IndexViewVisible = 0;
+
+static void IndexView_AppendRows(int count)
+{
+    static const char* words[] = { "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel", "india", "juliet", "kilo", "lima" };
+    for (int n = 0; n < count; n++)
+    {
+        IndexViewRow row;
+        row.ID = g_IndexViewRows.Size;
+        const ImU32 hash = (ImU32)row.ID * 2654435761u;
+        row.Quantity = (int)(hash >> 20);
+        ImFormatString(row.Name, IM_ARRAYSIZE(row.Name), "%s%04X", words[(hash >> 8) % IM_ARRAYSIZE(words)], (hash >> 4) & 0xFFFF);
+        g_IndexViewRows.push_back(row);
+    }
+}
+
+static int IndexView_CompareColumn(int column_n, const IndexViewRow* a, const IndexViewRow* b)
+{
+    switch (column_n)
+    {
+    case 0: return (a->ID > b->ID) - (a->ID < b->ID);
+    case 1: return strcmp(a->Name, b->Name);
+    default: return (a->Quantity > b->Quantity) - (a->Quantity < b->Quantity);
+    }
+}
+
+static int IndexView_CompareRows(const ImGuiTableColumnSortSpecs* spec, int row_a, int row_b, void*)
+{
+    return IndexView_CompareColumn(spec->ColumnIndex, &g_IndexViewRows[row_a], &g_IndexViewRows[row_b]);
+}
+
+static const char* IndexView_GetRowText(int row, void*)
+{
+    return g_IndexViewRows[row].Name;
+}
+
+static void IndexView_Setup(int thread_count)
+{
+    g_IndexViewRows.reserve(INDEXVIEW_ROWS + INDEXVIEW_APPEND_PER_FRAME * 1024);
+    IndexView_AppendRows(INDEXVIEW_ROWS);
+    g_IndexViewFilter.Clear();
+    g_IndexView.Clear();
+    g_IndexView.CompareFn = IndexView_CompareRows;
+    g_IndexView.GetRowTextFn = IndexView_GetRowText;
+    g_IndexView.ParallelForFn = (thread_count > 0) ? BenchParallelFor : NULL;
+    g_IndexView.ParallelForUserData = (void*)(intptr_t)thread_count;
+    g_IndexView.AddRows(g_IndexViewRows.Size);
+}
+
+static void IndexView_Teardown()
+{
+    g_IndexViewRows.clear();
+    g_IndexViewAppRows.clear();
+    g_IndexView.Clear();
+}
+
+// Submit the table (visible rows only, through the clipper). Sort specs change every frame when 'change_sort' is set.
+static bool IndexView_BeginTable(int frame, bool change_sort)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin("Index View", NULL, ImGuiWindowFlags_NoDecoration);
+    g_IndexViewFilter.Draw();
+    if (!ImGui::BeginTable("##table", 3, ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg))
+        return false;
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("ID");
+    ImGui::TableSetupColumn("Name");
+    ImGui::TableSetupColumn("Quantity");
+    if (change_sort)
+    {
+        // Cycle between: Name, then Quantity+Name (multi-sort), then ID descending
+        const int step = frame % 3;
+        ImGui::TableSetColumnSortDirection(step == 2 ? 0 : step + 1, step == 2 ? ImGuiSortDirection_Descending : ImGuiSortDirection_Ascending, false);
+        if (step == 1)
+            ImGui::TableSetColumnSortDirection(1, ImGuiSortDirection_Ascending, true);
+    }
+    ImGui::TableHeadersRow();
+    return true;
+}
+
+static void IndexView_EndTable(const int* rows, int rows_count)
+{
+    ImGuiListClipper clipper;
+    clipper.Begin(rows_count);
+    while (clipper.Step())
+        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+        {
+            const IndexViewRow& row = g_IndexViewRows[rows ? rows[n] : n];
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", row.ID);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(row.Name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", row.Quantity);
+        }
+    g_IndexViewVisible = rows_count;
+    ImGui::EndTable();
+    ImGui::End();
+}
+
+static void IndexView_TypeFilter(int frame)
+{
+    // Type "ec", "ech", "echo", "echo1", then start again (1 in 5 frames replaces the filter)
+    static const char* texts[] = { "e", "ec", "ech", "echo", "echo1" };
+    ImStrncpy(g_IndexViewFilter.InputBuf, texts[frame % IM_ARRAYSIZE(texts)], IM_ARRAYSIZE(g_IndexViewFilter.InputBuf));
+    g_IndexViewFilter.Build();
+}
+
+//-----------------------------------------------------------------------------
+// Baseline: the application sorts its own indices with qsort() when the sort specs are dirty,
+// and tests the filter on every row every frame.
+//-----------------------------------------------------------------------------
+
+static const ImGuiTableSortSpecs* g_IndexViewAppSortSpecs = NULL;
+
+static int IMGUI_CDECL IndexView_AppCompare(const void* lhs, const void* rhs)
+{
+    const int row_a = *(const int*)lhs;
+    const int row_b = *(const int*)rhs;
+    for (int n = 0; n < g_IndexViewAppSortSpecs->SpecsCount; n++)
+    {
+        const ImGuiTableColumnSortSpecs* spec = &g_IndexViewAppSortSpecs->Specs[n];
+        if (int d = IndexView_CompareColumn(spec->ColumnIndex, &g_IndexViewRows[row_a], &g_IndexViewRows[row_b]))
+            return (spec->SortDirection == ImGuiSortDirection_Ascending) ? d : -d;
+    }
+    return row_a - row_b;
+}
+
+static void IndexView_AppSubmit(int frame, bool change_sort, bool filter)
+{
+    if (filter)
+        IndexView_TypeFilter(frame);
+    if (!IndexView_BeginTable(frame, change_sort))
+        return;
+    if (g_IndexViewAppRows.Size != g_IndexViewRows.Size)
+    {
+        g_IndexViewAppRows.resize(g_IndexViewRows.Size);
+        for (int n = 0; n < g_IndexViewAppRows.Size; n++)
+            g_IndexViewAppRows[n] = n;
+    }
+    ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs();
+    if (sort_specs->SpecsDirty)
+    {
+        g_IndexViewAppSortSpecs = sort_specs;
+        ImQsort(g_IndexViewAppRows.Data, (size_t)g_IndexViewAppRows.Size, sizeof(int), IndexView_AppCompare);
+        sort_specs->SpecsDirty = false;
+    }
+    static ImVector<int> filtered_rows;
+    filtered_rows.resize(0);
+    for (int n = 0; n < g_IndexViewAppRows.Size; n++)
+        if (g_IndexViewFilter.PassFilter(g_IndexViewRows[g_IndexViewAppRows[n]].Name))
+            filtered_rows.push_back(g_IndexViewAppRows[n]);
+    IndexView_EndTable(filtered_rows.Data, filtered_rows.Size);
+}
+
+static void IndexView_Serial_Setup()                { IndexView_Setup(0); }
+static void IndexView_Threads4_Setup()              { IndexView_Setup(4); }
+static void IndexView_AppSort_Submit(int frame)     { IndexView_AppSubmit(frame, true, false); }
+static void IndexView_AppFilter_Submit(int frame)   { IndexView_AppSubmit(frame, false, true); }
+
+//-----------------------------------------------------------------------------
+// ImGuiTableIndexView: sort specs changing every frame, typing in the filter, or rows appended every frame.
+//-----------------------------------------------------------------------------
+
+static void IndexView_Sort_Submit(int frame)
+{
+    if (!IndexView_BeginTable(frame, true))
+        return;
+    g_IndexView.Update(&g_IndexViewFilter);
+    IndexView_EndTable(g_IndexView.Rows.Data, g_IndexView.Rows.Size);
+}
+
+static void IndexView_Filter_Submit(int frame)
+{
+    IndexView_TypeFilter(frame);
+    if (!IndexView_BeginTable(frame, false))
+        return;
+    g_IndexView.Update(&g_IndexViewFilter);
+    IndexView_EndTable(g_IndexView.Rows.Data, g_IndexView.Rows.Size);
+}
+
+static void IndexView_Append_Submit(int frame)
+{
+    if (frame > 0)
+    {
+        IndexView_AppendRows(INDEXVIEW_APPEND_PER_FRAME);
+        g_IndexView.AddRows(INDEXVIEW_APPEND_PER_FRAME);
+    }
+    ImStrncpy(g_IndexViewFilter.InputBuf, "echo", IM_ARRAYSIZE(g_IndexViewFilter.InputBuf));
+    g_IndexViewFilter.Build();
+    if (!IndexView_BeginTable(frame, false))
+        return;
+    g_IndexView.Update(&g_IndexViewFilter);
+    IndexView_EndTable(g_IndexView.Rows.Data, g_IndexView.Rows.Size);
+}
+
+static int IndexView_GetVisible() { return g_IndexViewVisible; }
+
+const BenchScenario BenchScenario_IndexView5M_AppSort = { "table_5m_sort_app_qsort", 3, IndexView_Serial_Setup, NULL, IndexView_AppSort_Submit, IndexView_Teardown, INDEXVIEW_ROWS, NULL, NULL };
+const BenchScenario BenchScenario_IndexView5M_Sort = { "table_5m_sort_index_view", 6, IndexView_Serial_Setup, NULL, IndexView_Sort_Submit, IndexView_Teardown, INDEXVIEW_ROWS, NULL, NULL };
+const BenchScenario BenchScenario_IndexView5M_Sort_Threads4 = { "table_5m_sort_index_view_threads4", 6, IndexView_Threads4_Setup, NULL, IndexView_Sort_Submit, IndexView_Teardown, INDEXVIEW_ROWS, NULL, NULL };
+const BenchScenario BenchScenario_IndexView5M_AppFilter = { "table_5m_filter_app_per_row", 10, IndexView_Serial_Setup, NULL, IndexView_AppFilter_Submit, IndexView_Teardown, INDEXVIEW_ROWS, "rows_visible", IndexView_GetVisible };
+const BenchScenario BenchScenario_IndexView5M_Filter = { "table_5m_filter_index_view", 10, IndexView_Serial_Setup, NULL, IndexView_Filter_Submit, IndexView_Teardown, INDEXVIEW_ROWS, "rows_visible", IndexView_GetVisible };
+const BenchScenario BenchScenario_IndexView5M_Append = { "table_5m_append_index_view", 60, IndexView_Serial_Setup, NULL, IndexView_Append_Submit, IndexView_Teardown, INDEXVIEW_APPEND_PER_FRAME, NULL, NULL };
@@ -0,0 +1,88 @@
+// Plot scenarios: PlotLines()/PlotHistogram() of a 10M values telemetry series, 10k values appended per frame.
+
+#include "bench.h"
+#include "imgui_internal.h"
+
+//-----------------------------------------------------------------------------
+// Array: the series is a plain ring buffer passed to PlotLines(values, count, offset), scanned every frame.
+//-----------------------------------------------------------------------------
+
+static const int PLOT_VALUES = 10 * 1000 * 1000;
+static const int PLOT_APPEND_PER_FRAME = 10000;
+
+static ImVector<float>  g_PlotValues;
+static int              g_PlotHead = 0;
+static ImU32            g_PlotSeed = 0;
+
+static float Plot_NextValue()
+{
+    // Noisy signal with rare spikes, which point sampling misses
+    g_PlotSeed = g_PlotSeed * 1664525u + 1013904223u;
+    const float noise = (float)(g_PlotSeed >> 8) / (float)(1 << 24);
+    return ((g_PlotSeed & 0xFFFF) == 0) ? 10.0f : noise;
+}
+
+static void PlotArray_Setup()
+{
+    g_PlotSeed = 0;
+    g_PlotHead = 0;
+    g_PlotValues.resize(PLOT_VALUES);
+    for (int n = 0; n < PLOT_VALUES; n++)
+        g_PlotValues[n] = Plot_NextValue();
+}
+
+static void PlotArray_Append()
+{
+    for (int n = 0; n < PLOT_APPEND_PER_FRAME; n++)
+    {
+        g_PlotValues[g_PlotHead] = Plot_NextValue();
+        g_PlotHead = (g_PlotHead + 1) % PLOT_VALUES;
+    }
+}
+
+static void PlotArray_Submit(int)
+{
+    PlotArray_Append();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(1280.0f, 720.0f));
+    ImGui::Begin("Plot", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::PlotLines("Lines", g_PlotValues.Data, PLOT_VALUES, g_PlotHead, NULL, FLT_MAX, FLT_MAX, ImVec2(1200.0f, 300.0f));
+    ImGui::PlotHistogram("Histogram", g_PlotValues.Data, PLOT_VALUES, g_PlotHead, NULL, FLT_MAX, FLT_MAX, ImVec2(1200.0f, 300.0f));
+    ImGui::End();
+}
+
+//-----------------------------------------------------------------------------
+// Buffer: the same series in an ImGuiPlotBuffer, drawn as the min/max envelope of each pixel column.
+//-----------------------------------------------------------------------------
+
+static ImGuiPlotBuffer  g_PlotBuffer;
+
+static void PlotBuffer_Setup()
+{
+    PlotArray_Setup();
+    g_PlotBuffer.Init(PLOT_VALUES);
+    g_PlotBuffer.Append(g_PlotValues.Data, PLOT_VALUES);
+}
+
+static void PlotBuffer_Submit(int)
+{
+    float values[PLOT_APPEND_PER_FRAME];
+    for (int n = 0; n < PLOT_APPEND_PER_FRAME; n++)
+        values[n] = Plot_NextValue();
+    g_PlotBuffer.Append(values, PLOT_APPEND_PER_FRAME);
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(1280.0f, 720.0f));
+    ImGui::Begin("Plot", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::PlotLines("Lines", &g_PlotBuffer, NULL, FLT_MAX, FLT_MAX, ImVec2(1200.0f, 300.0f));
+    ImGui::PlotHistogram("Histogram", &g_PlotBuffer, NULL, FLT_MAX, FLT_MAX, ImVec2(1200.0f, 300.0f));
+    ImGui::End();
+}
+
+static void Plot_Teardown()
+{
+    g_PlotValues.clear();
+    g_PlotBuffer = ImGuiPlotBuffer();
+}
+
+const BenchScenario BenchScenario_PlotArray_10M = { "plot_array_10m", 30, PlotArray_Setup, NULL, PlotArray_Submit, Plot_Teardown, PLOT_VALUES, NULL, NULL };
+const BenchScenario BenchScenario_PlotBuffer_10M = { "plot_buffer_10m", 60, PlotBuffer_Setup, NULL, PlotBuffer_Submit, Plot_Teardown, PLOT_VALUES, NULL, NULL };
@@ -0,0 +1,143 @@
+// Settings scenarios: .ini load and save with thousands of windows and tables.
+
+#include "bench.h"
+#include "imgui_internal.h"
+#include "tinycthread.h"
+#include <stdio.h>      // remove
+
+//-----------------------------------------------------------------------------
+// A ~1.5 MB .ini file: 2000 windows and 2000 tables of 8 columns, plus one live window moved every frame
+// (so each save has exactly one changed entry).
+//-----------------------------------------------------------------------------
+
+static const int SETTINGS_WINDOWS = 2000;
+static const int SETTINGS_TABLES = 2000;
+static const int SETTINGS_TABLE_COLUMNS = 8;
+static const char* SETTINGS_FILENAME = "bench_settings.ini";
+
+static ImGuiTextBuffer g_SettingsIni;
+
+static void Settings_BuildIni()
+{
+    g_SettingsIni.clear();
+    for (int n = 0; n < SETTINGS_WINDOWS; n++)
+        g_SettingsIni.appendf("[Window][Tool Window %d]\nPos=%d,%d\nSize=%d,%d\nCollapsed=%d\n\n", n, 60 + n % 800, 40 + n % 600, 300 + n % 200, 200 + n % 300, n & 1);
+    for (int n = 0; n < SETTINGS_TABLES; n++)
+    {
+        g_SettingsIni.appendf("[Table][0x%08X,%d]\nRefScale=13\n", ImHashData(&n, sizeof(n)), SETTINGS_TABLE_COLUMNS);
+        for (int column_n = 0; column_n < SETTINGS_TABLE_COLUMNS; column_n++)
+            g_SettingsIni.appendf("Column %-2d Width=%d Visible=1 Order=%d%s\n", column_n, 50 + (n + column_n) % 100, SETTINGS_TABLE_COLUMNS - 1 - column_n, column_n == 0 ? " Sort=0v" : "");
+        g_SettingsIni.append("\n");
+    }
+}
+
+static void Settings_MoveWindow(int frame)
+{
+    ImGui::SetNextWindowPos(ImVec2((float)(frame % 500), 100.0f));
+    ImGui::SetNextWindowSize(ImVec2(200.0f, 100.0f));
+    ImGui::Begin("Moving Window");
+    ImGui::MarkIniSettingsDirty(ImGui::GetCurrentWindow()); // As when moved with the mouse
+    ImGui::End();
+}
+
+//-----------------------------------------------------------------------------
+// Load: parse the whole file every frame (items = entries).
+//-----------------------------------------------------------------------------
+
+static void SettingsLoad_Setup()                { Settings_BuildIni(); }
+static void SettingsLoad_Submit(int)            { ImGui::LoadIniSettingsFromMemory(g_SettingsIni.c_str(), (size_t)g_SettingsIni.size()); }
+static void Settings_Teardown()                 { g_SettingsIni.Buf.clear(); }
+
+//-----------------------------------------------------------------------------
+// Save to memory: serialize every frame (items = entries).
+//-----------------------------------------------------------------------------
+
+static void SettingsSave_Setup()
+{
+    Settings_BuildIni();
+    ImGui::LoadIniSettingsFromMemory(g_SettingsIni.c_str(), (size_t)g_SettingsIni.size());
+}
+
+static void SettingsSave_Submit(int frame)
+{
+    Settings_MoveWindow(frame);
+    ImGui::SaveIniSettingsToMemory();
+}
+
+//-----------------------------------------------------------------------------
+// Binary: load the same settings from binary data then submit a few windows (entries are only unpacked on use),
+// or save them to binary data every frame (items = entries).
+//-----------------------------------------------------------------------------
+
+static ImVector<ImU32> g_SettingsBinary; // ImU32 for alignment
+static size_t g_SettingsBinarySize = 0;
+
+static void SettingsBinary_Setup()
+{
+    SettingsSave_Setup();
+    const void* data = ImGui::SaveIniSettingsToBinary(&g_SettingsBinarySize);
+    g_SettingsBinary.resize((int)(g_SettingsBinarySize + 3) / 4);
+    memcpy(g_SettingsBinary.Data, data, g_SettingsBinarySize);
+    ImGui::ClearIniSettings();
+}
+
+static void SettingsLoadBinary_Submit(int)
+{
+    ImGui::ClearIniSettings();
+    ImGui::LoadIniSettingsFromBinary(g_SettingsBinary.Data, g_SettingsBinarySize);
+    for (int n = 0; n < 10; n++)
+    {
+        char name[32];
+        ImFormatString(name, IM_ARRAYSIZE(name), "Tool Window %d", n * 100);
+        ImGui::Begin(name);
+        ImGui::End();
+    }
+}
+
+static void SettingsSaveBinary_Submit(int frame)
+{
+    Settings_MoveWindow(frame);
+    size_t data_size = 0;
+    ImGui::SaveIniSettingsToBinary(&data_size);
+}
+
+static void SettingsBinary_Teardown()
+{
+    g_SettingsBinary.clear();
+    Settings_Teardown();
+}
+
+//-----------------------------------------------------------------------------
+// Save to disk: automatic saves (io.IniSavingRate shorter than a frame), the file written on the UI thread
+// or by a thread started through io.IniSavingAsyncFn. Measures the UI thread.
+//-----------------------------------------------------------------------------
+
+static void SettingsSaveDisk_Setup(bool async)
+{
+    SettingsSave_Setup();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = SETTINGS_FILENAME;
+    io.IniSavingRate = 0.001f;
+    io.IniSavingAsyncFn = async ? BenchRunAsync : NULL;
+}
+
+static void SettingsSaveDisk_Sync_Setup()       { SettingsSaveDisk_Setup(false); }
+static void SettingsSaveDisk_Async_Setup()      { SettingsSaveDisk_Setup(true); }
+static void SettingsSaveDisk_Submit(int frame)  { Settings_MoveWindow(frame); thrd_yield(); } // Yield as while waiting for vsync so the save thread runs
+
+static void SettingsSaveDisk_Teardown()
+{
+    ImGui::SaveIniSettingsToDisk(SETTINGS_FILENAME); // Wait for a pending save
+    ImGui::GetIO().IniFilename = NULL;
+    remove(SETTINGS_FILENAME);
+    Settings_Teardown();
+}
+
+static const int SETTINGS_ENTRIES = SETTINGS_WINDOWS + SETTINGS_TABLES;
+
+const BenchScenario BenchScenario_SettingsLoad = { "settings_load_4k_entries", 30, SettingsLoad_Setup, NULL, SettingsLoad_Submit, Settings_Teardown, SETTINGS_ENTRIES, NULL, NULL };
+const BenchScenario BenchScenario_SettingsSave = { "settings_save_4k_entries", 60, SettingsSave_Setup, NULL, SettingsSave_Submit, Settings_Teardown, SETTINGS_ENTRIES, NULL, NULL };
+const BenchScenario BenchScenario_SettingsLoadBinary = { "settings_load_binary_4k_entries", 60, SettingsBinary_Setup, NULL, SettingsLoadBinary_Submit, SettingsBinary_Teardown, SETTINGS_ENTRIES, NULL, NULL };
+const BenchScenario BenchScenario_SettingsSaveBinary = { "settings_save_binary_4k_entries", 60, SettingsSave_Setup, NULL, SettingsSaveBinary_Submit, SettingsBinary_Teardown, SETTINGS_ENTRIES, NULL, NULL };
+const BenchScenario BenchScenario_SettingsSaveDisk_Sync = { "settings_save_disk_4k_entries", 60, SettingsSaveDisk_Sync_Setup, NULL, SettingsSaveDisk_Submit, SettingsSaveDisk_Teardown, 0, NULL, NULL };
+const BenchScenario BenchScenario_SettingsSaveDisk_Async = { "settings_save_disk_async_4k_entries", 60, SettingsSaveDisk_Async_Setup, NULL, SettingsSaveDisk_Submit, SettingsSaveDisk_Teardown, 0, NULL, NULL };
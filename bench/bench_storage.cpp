@@ -0,0 +1,103 @@
+// Storage scenarios: ImGuiStorage insertion and lookup, sorted (default) vs hash indexed.
+
+#include "bench.h"
+#include "imgui_internal.h"
+#include <stdint.h>     // intptr_t
+
+//-----------------------------------------------------------------------------
+// Keys are IDs as computed by TreeNode()/PushID(), so they arrive in random order relative to their sorted position.
+// Insert: each frame clears the storage then SetInt() every key. Lookup: each frame GetInt() every key of a filled storage.
+// Sorted insertion of 1M keys is quadratic (about two minutes per frame) so there is no scenario for it.
+//-----------------------------------------------------------------------------
+
+static ImGuiStorage         g_Storage;
+static ImVector<ImGuiID>    g_StorageKeys;
+static volatile int         g_StorageSink;              // Keep the compiler from discarding the lookups
+
+static void Storage_Setup(int key_count, bool use_hash_index, bool fill)
+{
+    g_StorageKeys.resize(key_count);
+    const ImGuiID seed = ImHashStr("Tree");
+    for (int n = 0; n < key_count; n++)
+        g_StorageKeys[n] = ImHashData(&n, sizeof(n), seed);
+    g_Storage.Clear();
+    g_Storage.SetUseHashIndex(use_hash_index);
+    if (fill)
+        for (int n = 0; n < key_count; n++)
+            g_Storage.SetInt(g_StorageKeys[n], n & 1);
+}
+
+static void Storage_Insert_Submit(int)
+{
+    g_Storage.Clear();
+    for (int n = 0; n < g_StorageKeys.Size; n++)
+        g_Storage.SetInt(g_StorageKeys[n], 1);
+}
+
+static void Storage_Lookup_Submit(int)
+{
+    int acc = 0;
+    for (int n = 0; n < g_StorageKeys.Size; n++)
+        acc += g_Storage.GetInt(g_StorageKeys[n], 0);
+    g_StorageSink = acc;
+}
+
+static void Storage_Teardown()
+{
+    g_Storage.Clear();
+    g_Storage.SetUseHashIndex(false);
+    g_StorageKeys.clear();
+}
+
+static void StorageInsert_Sorted1k_Setup()      { Storage_Setup(1000, false, false); }
+static void StorageInsert_Sorted100k_Setup()    { Storage_Setup(100000, false, false); }
+static void StorageInsert_Hashed1k_Setup()      { Storage_Setup(1000, true, false); }
+static void StorageInsert_Hashed100k_Setup()    { Storage_Setup(100000, true, false); }
+static void StorageInsert_Hashed1M_Setup()      { Storage_Setup(1000000, true, false); }
+static void StorageLookup_Sorted1k_Setup()      { Storage_Setup(1000, false, true); }
+static void StorageLookup_Sorted100k_Setup()    { Storage_Setup(100000, false, true); }
+static void StorageLookup_Sorted1M_Setup()      { Storage_Setup(1000000, false, true); }
+static void StorageLookup_Hashed1k_Setup()      { Storage_Setup(1000, true, true); }
+static void StorageLookup_Hashed100k_Setup()    { Storage_Setup(100000, true, true); }
+static void StorageLookup_Hashed1M_Setup()      { Storage_Setup(1000000, true, true); }
+
+//-----------------------------------------------------------------------------
+// Tree: first expansion of 100k tree nodes opened with SetNextItemOpen(true, ImGuiCond_Once), each of them
+// writing its open state to the window storage. The storage is cleared every frame so every frame is a first expansion.
+//-----------------------------------------------------------------------------
+
+static const int STORAGE_TREE_NODES = 100000;
+static bool g_StorageTreeUseHashIndex = false;
+
+static void StorageTree_Submit(int)
+{
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(800.0f, 600.0f));
+    ImGui::Begin("Tree", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGuiStorage* storage = ImGui::GetStateStorage();
+    storage->Clear();
+    storage->SetUseHashIndex(g_StorageTreeUseHashIndex);
+    for (int n = 0; n < STORAGE_TREE_NODES; n++)
+    {
+        ImGui::SetNextItemOpen(true, ImGuiCond_Once);
+        ImGui::TreeNodeEx((void*)(intptr_t)n, ImGuiTreeNodeFlags_NoTreePushOnOpen, "Node %d", n);
+    }
+    ImGui::End();
+}
+
+static void StorageTree_Sorted_Setup()          { g_StorageTreeUseHashIndex = false; }
+static void StorageTree_Hashed_Setup()          { g_StorageTreeUseHashIndex = true; }
+
+const BenchScenario BenchScenario_StorageInsert_Sorted1k = { "storage_insert_sorted_1k", 60, StorageInsert_Sorted1k_Setup, NULL, Storage_Insert_Submit, Storage_Teardown, 1000, NULL, NULL };
+const BenchScenario BenchScenario_StorageInsert_Sorted100k = { "storage_insert_sorted_100k", 1, StorageInsert_Sorted100k_Setup, NULL, Storage_Insert_Submit, Storage_Teardown, 100000, NULL, NULL };
+const BenchScenario BenchScenario_StorageInsert_Hashed1k = { "storage_insert_hashed_1k", 60, StorageInsert_Hashed1k_Setup, NULL, Storage_Insert_Submit, Storage_Teardown, 1000, NULL, NULL };
+const BenchScenario BenchScenario_StorageInsert_Hashed100k = { "storage_insert_hashed_100k", 60, StorageInsert_Hashed100k_Setup, NULL, Storage_Insert_Submit, Storage_Teardown, 100000, NULL, NULL };
+const BenchScenario BenchScenario_StorageInsert_Hashed1M = { "storage_insert_hashed_1m", 10, StorageInsert_Hashed1M_Setup, NULL, Storage_Insert_Submit, Storage_Teardown, 1000000, NULL, NULL };
+const BenchScenario BenchScenario_StorageLookup_Sorted1k = { "storage_lookup_sorted_1k", 60, StorageLookup_Sorted1k_Setup, NULL, Storage_Lookup_Submit, Storage_Teardown, 1000, NULL, NULL };
+const BenchScenario BenchScenario_StorageLookup_Sorted100k = { "storage_lookup_sorted_100k", 60, StorageLookup_Sorted100k_Setup, NULL, Storage_Lookup_Submit, Storage_Teardown, 100000, NULL, NULL };
+const BenchScenario BenchScenario_StorageLookup_Sorted1M = { "storage_lookup_sorted_1m", 10, StorageLookup_Sorted1M_Setup, NULL, Storage_Lookup_Submit, Storage_Teardown, 1000000, NULL, NULL };
+const BenchScenario BenchScenario_StorageLookup_Hashed1k = { "storage_lookup_hashed_1k", 60, StorageLookup_Hashed1k_Setup, NULL, Storage_Lookup_Submit, Storage_Teardown, 1000, NULL, NULL };
+const BenchScenario BenchScenario_StorageLookup_Hashed100k = { "storage_lookup_hashed_100k", 60, StorageLookup_Hashed100k_Setup, NULL, Storage_Lookup_Submit, Storage_Teardown, 100000, NULL, NULL };
+const BenchScenario BenchScenario_StorageLookup_Hashed1M = { "storage_lookup_hashed_1m", 10, StorageLookup_Hashed1M_Setup, NULL, Storage_Lookup_Submit, Storage_Teardown, 1000000, NULL, NULL };
+const BenchScenario BenchScenario_StorageTree_Sorted100k = { "storage_tree_expand_sorted_100k", 3, StorageTree_Sorted_Setup, NULL, StorageTree_Submit, NULL, STORAGE_TREE_NODES, NULL, NULL };
+const BenchScenario BenchScenario_StorageTree_Hashed100k = { "storage_tree_expand_hashed_100k", 10, StorageTree_Hashed_Setup, NULL, StorageTree_Submit, NULL, STORAGE_TREE_NODES, NULL, NULL };
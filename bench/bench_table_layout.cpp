@@ -0,0 +1,49 @@
+// Table layout scenarios: a wide-format data view with 320 columns and horizontal scrolling, of which only a dozen
+// columns are in view. The display doesn't change (static), or the view is scrolled horizontally every frame.
+
+#include "bench.h"
+#include "imgui_internal.h"
+
+static const int WIDETABLE_COLUMNS = 320;
+static const int WIDETABLE_ROWS = 1000;
+
+static void WideTable_Submit(int frame, bool scroll)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin("Wide Table", NULL, ImGuiWindowFlags_NoDecoration);
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY
+        | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable | ImGuiTableFlags_SizingFixedFit;
+    if (ImGui::BeginTable("##table", WIDETABLE_COLUMNS, flags))
+    {
+        if (scroll)
+            ImGui::SetScrollX((float)((frame * 40) % 20000));
+        ImGui::TableSetupScrollFreeze(1, 1);
+        for (int column_n = 0; column_n < WIDETABLE_COLUMNS; column_n++)
+        {
+            char label[16];
+            ImFormatString(label, IM_ARRAYSIZE(label), "Field %03d", column_n);
+            ImGui::TableSetupColumn(label, ImGuiTableColumnFlags_WidthFixed, 80.0f);
+        }
+        ImGui::TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(WIDETABLE_ROWS);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                ImGui::TableNextRow();
+                for (int column_n = 0; column_n < WIDETABLE_COLUMNS; column_n++)
+                    if (ImGui::TableSetColumnIndex(column_n))
+                        ImGui::Text("%d", row * WIDETABLE_COLUMNS + column_n);
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+static void WideTable_Static_Submit(int frame)  { WideTable_Submit(frame, false); }
+static void WideTable_Scroll_Submit(int frame)  { WideTable_Submit(frame, true); }
+
+const BenchScenario BenchScenario_WideTable_Static = { "table_320_columns_static", 300, NULL, NULL, WideTable_Static_Submit, NULL, 0, NULL, NULL };
+const BenchScenario BenchScenario_WideTable_ScrollX = { "table_320_columns_scroll_x", 300, NULL, NULL, WideTable_Scroll_Submit, NULL, 0, NULL, NULL };
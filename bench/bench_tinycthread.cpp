@@ -0,0 +1,3 @@
+// Build the vendored tinycthread (C code which also compiles as C++) for benchmarks using worker threads.
+
+#include "tinycthread.c"
@@ -0,0 +1,113 @@
+// Tree scenarios: a hierarchy of 1000 open folders of 1000 files (1M visible rows), scrolled with the mouse wheel and dragged to
+// distant positions, submitted with TreeNodeEx()/TreePop() or with ImGuiVirtualTree. Also opening and closing a folder of the
+// virtual tree every other frame.
+
+#include "bench.h"
+#include "imgui_internal.h"
+#include <stdint.h>     // intptr_t
+
+static const int TREE_FOLDERS = 1000;
+static const int TREE_FILES = 1000;     // Per folder
+
+// Root is 0, folder N is 1+N, file N of folder F is 1+TREE_FOLDERS+F*TREE_FILES+N
+static int      Tree_GetChildrenCount(ImU64 node, void*)    { return (node == 0) ? TREE_FOLDERS : (node <= (ImU64)TREE_FOLDERS) ? TREE_FILES : 0; }
+static ImU64    Tree_GetChild(ImU64 node, int child_n, void*) { return (node == 0) ? (ImU64)(1 + child_n) : (ImU64)(1 + TREE_FOLDERS + (node - 1) * TREE_FILES + child_n); }
+static bool     Tree_IsLeaf(ImU64 node, void*)              { return node > (ImU64)TREE_FOLDERS; }
+
+static const char* Tree_GetLabel(ImU64 node, void*)
+{
+    static char label[32];
+    if (node <= (ImU64)TREE_FOLDERS)
+        ImFormatString(label, IM_ARRAYSIZE(label), "Folder %d", (int)(node - 1));
+    else
+        ImFormatString(label, IM_ARRAYSIZE(label), "File %d", (int)((node - 1 - TREE_FOLDERS) % TREE_FILES));
+    return label;
+}
+
+static void Tree_ScrollInput(ImGuiIO& io, int frame)
+{
+    io.AddMousePosEvent(400.0f, 300.0f);
+    io.AddMouseWheelEvent(0.0f, (frame % 40 < 20) ? -1.0f : 1.0f);
+}
+
+static void Tree_BeginWindow(int frame, bool scroll)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin("Tree", NULL, ImGuiWindowFlags_NoDecoration);
+    if (scroll && frame % 10 == 0) // As when dragging the scrollbar
+        ImGui::SetScrollY(ImGui::GetScrollMaxY() * (float)((frame * 37) % 100) / 100.0f);
+}
+
+//-----------------------------------------------------------------------------
+// TreeNodeEx()/TreePop(): every node is submitted (items = visible rows)
+//-----------------------------------------------------------------------------
+
+static void TreeNodes_Submit(int frame)
+{
+    Tree_BeginWindow(frame, true);
+    for (int folder_n = 0; folder_n < TREE_FOLDERS; folder_n++)
+    {
+        const ImU64 folder = Tree_GetChild(0, folder_n, NULL);
+        if (!ImGui::TreeNodeEx((void*)(intptr_t)folder, ImGuiTreeNodeFlags_DefaultOpen, "%s", Tree_GetLabel(folder, NULL)))
+            continue;
+        for (int file_n = 0; file_n < TREE_FILES; file_n++)
+        {
+            const ImU64 file = Tree_GetChild(folder, file_n, NULL);
+            ImGui::TreeNodeEx((void*)(intptr_t)file, ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen, "%s", Tree_GetLabel(file, NULL));
+        }
+        ImGui::TreePop();
+    }
+    ImGui::End();
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiVirtualTree: only visible rows are submitted (items = visible rows)
+//-----------------------------------------------------------------------------
+
+static ImGuiVirtualTree g_Tree;
+
+static void VirtualTree_Setup()
+{
+    g_Tree.GetChildrenCountFn = Tree_GetChildrenCount;
+    g_Tree.GetChildFn = Tree_GetChild;
+    g_Tree.GetLabelFn = Tree_GetLabel;
+    g_Tree.IsLeafFn = Tree_IsLeaf;
+    g_Tree.RootNode = 0;
+    g_Tree.Rebuild();
+}
+
+static void VirtualTree_Submit(int frame, bool scroll)
+{
+    Tree_BeginWindow(frame, scroll);
+    if (g_Tree.Begin("##tree", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        while (g_Tree.Step()) {}
+        g_Tree.End();
+    }
+    ImGui::End();
+}
+
+static void VirtualTree_Scroll_Submit(int frame)    { VirtualTree_Submit(frame, true); }
+static void VirtualTree_Toggle_Submit(int frame)    { VirtualTree_Submit(frame, false); }
+static int  VirtualTree_GetRowsCount()              { return g_Tree.Rows.Size; }
+
+static void VirtualTree_Teardown()
+{
+    g_Tree.Rows.clear();
+    g_Tree.TempRows.clear();
+}
+
+// Click on the arrow of the first folder, inserting or removing its 1000 rows at the top of the tree
+static void VirtualTree_Toggle_Input(ImGuiIO& io, int frame)
+{
+    io.AddMousePosEvent(14.0f, 14.0f);
+    io.AddMouseButtonEvent(0, (frame & 1) == 0);
+}
+
+static const int TREE_ROWS = TREE_FOLDERS * (1 + TREE_FILES);
+
+const BenchScenario BenchScenario_Tree1M_TreeNodes = { "tree_1m_nodes_treenode", 5, NULL, Tree_ScrollInput, TreeNodes_Submit, NULL, TREE_ROWS, NULL, NULL };
+const BenchScenario BenchScenario_Tree1M_Virtual = { "tree_1m_nodes_virtual", 120, VirtualTree_Setup, Tree_ScrollInput, VirtualTree_Scroll_Submit, VirtualTree_Teardown, TREE_ROWS, "rows", VirtualTree_GetRowsCount };
+const BenchScenario BenchScenario_Tree1M_VirtualToggle = { "tree_1m_nodes_virtual_toggle", 120, VirtualTree_Setup, VirtualTree_Toggle_Input, VirtualTree_Toggle_Submit, VirtualTree_Teardown, TREE_ROWS, "rows", VirtualTree_GetRowsCount };
@@ -58,6 +58,15 @@
 //---- Use 32-bit for ImWchar (default is 16-bit) to support unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
+//---- Select the hash function used to compute IDs (ImHashStr/ImHashData). Default is CRC32, which gives the same IDs as previous versions.
+// Changing it changes the IDs stored in .ini files for tables (they will be reset once), window settings are stored by name.
+//#define IMGUI_USE_HASH_CRC32C                             // CRC32C using the SSE4.2 crc32 instruction when the CPU supports it (checked at runtime), lookup table otherwise. Same IDs on every CPU.
+//#define IMGUI_USE_HASH_MIX64                              // 64-bit multiply/rotate mixing hash truncated to 32-bit, processing 8 bytes at a time. IDs depend on the CPU endianness.
+
+//---- Use a hash index in every ImGuiStorage (window state storage, ID maps) instead of a sorted array: O(1) insertion for storages receiving many keys, ~1.5x memory.
+// Can also be enabled on a single storage with ImGuiStorage::SetUseHashIndex(), e.g. ImGui::GetStateStorage()->SetUseHashIndex(true) after Begin().
+//#define IMGUI_USE_STORAGE_HASH_INDEX
+
 //---- Avoid multiple STB libraries implementations, or redefine path/filenames to prioritize another version
 // By default the embedded implementations are declared static and not available outside of Dear ImGui sources files.
 //#define IMGUI_STB_TRUETYPE_FILENAME   "my_folder/stb_truetype.h"
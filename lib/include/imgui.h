@@ -31,7 +31,7 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiPlotBuffer, ImColor)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -140,6 +140,8 @@ struct ImDrawListSplitter;          // Helper to split a draw list into differen
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasDynamicGlyphs;    // Opaque state of glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+struct ImFontAtlasTexUpdate;        // Region of the atlas texture modified after Build(), to upload again
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
@@ -153,14 +155,17 @@ struct ImGuiListClipper;            // Helper to manually clip large list of ite
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformImeData;        // Platform IME data for io.SetPlatformImeDataFn() function.
+struct ImGuiPlotBuffer;             // Helper to hold a large series of values for PlotLines()/PlotHistogram() (ring buffer + min/max pyramid)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
+struct ImGuiTableIndexView;         // Helper to hold a sorted and filtered view of the rows of a large data set, for tables
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
+struct ImGuiVirtualTree;            // Helper to display very large trees, only submitting the visible tree nodes
 
 // Enums/Flags (declared as int for compatibility with old C++, to allow using as flags without overhead, and to not pollute the top of this file)
 // - Tip: Use your programming IDE navigation facilities on the names in the _central column_ below to find the actual flags/enum lists!
@@ -242,6 +247,8 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef void    (*ImGuiParallelForFn)(int count, void (*func)(void* data, int index), void* data, void* user_data); // Call func(data, 0..count-1) from worker threads in any order, returning once all calls are done (ImFontAtlas::BuildParallelForFn, ImGuiTableIndexView::ParallelForFn)
+typedef void    (*ImGuiAsyncJobFn)(void (*func)(void* data), void* data, void* user_data);                     // Call func(data) on a background thread and return immediately (io.IniSavingAsyncFn, ImGuiTableIndexView::AsyncJobFn)
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -629,6 +636,8 @@ namespace ImGui
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));      // [BETA] each pixel column shows the min/max of the values it covers. Cost depends on the graph width, not on the number of values.
+    IMGUI_API void          PlotHistogram(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));  // [BETA] "
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -854,6 +863,8 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API void          SetMaxWaitBeforeNextFrame(float time);                              // power saving: request the next frame to be rendered within 'time' seconds even without input, e.g. for an animation (0.0f = as soon as possible). Only meaningful when the platform backend waits for events between frames.
+    IMGUI_API float         GetEventWaitingTime();                                              // power saving: how long the platform backend may block waiting for input events before rendering the next frame (FLT_MAX = until the next event). Call after Render().
     IMGUI_API ImDrawList*   GetBackgroundDrawList();                                            // this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList();                                            // this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
@@ -919,6 +930,8 @@ namespace ImGui
     IMGUI_API void          LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size=0); // call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source.
     IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
     IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
+    IMGUI_API void          LoadIniSettingsFromBinary(const void* data, size_t data_size);     // [BETA] load windows and tables settings written by SaveIniSettingsToBinary(). Not copied: 'data' must stay valid until the next LoadIniSettingsFromBinary()/ClearIniSettings() call (e.g. a memory-mapped file). Entries are only unpacked when a window/table with a matching ID first appears.
+    IMGUI_API const void*   SaveIniSettingsToBinary(size_t* out_data_size);                     // [BETA] return compact binary settings data (fixed-size records sorted by ID, native endianness). Only handlers with binary support are included (windows, tables). Load from one format then save to the other to convert.
 
     // Debug Utilities
     // - This is used by the IMGUI_CHECKVERSION() macro.
@@ -963,6 +976,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavInputs            = 1 << 18,  // No gamepad/keyboard navigation within the window
     ImGuiWindowFlags_NoNavFocus             = 1 << 19,  // No focusing toward this window with gamepad/keyboard navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 20,  // Display a dot next to the title. When used in a tab/docking context, tab is selected when clicking the X + closure is not assumed (will wait for user to stop submitting the tab). Otherwise closure is assumed when pressing the X, so if you keep submitting the tab may reappear at end of tab bar.
+    ImGuiWindowFlags_CacheDrawList          = 1 << 21,  // [BETA] Hash draw calls and reuse the previous frame output instead of emitting vertices while the window contents don't change. A change is displayed one frame late. Vertices written with ImDrawList::PrimXXX functions are not hashed. See io.ConfigDrawListCacheVerify.
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs               = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -1520,7 +1534,8 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasGamepad            = 1 << 0,   // Backend Platform supports gamepad and currently has one connected.
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
-    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3    // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasTexUpdates = 1 << 4    // Backend Renderer uploads ImFontAtlas::TexUpdates[] every frame. Required by ImFontAtlasFlags_DynamicGlyphs.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1913,6 +1928,8 @@ struct ImGuiIO
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file (important: default "imgui.ini" is relative to current working dir!). Set NULL to disable automatic .ini loading/saving or if you want to manually call LoadIniSettingsXXX() / SaveIniSettingsXXX() functions.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
+    ImGuiAsyncJobFn IniSavingAsyncFn;           // = NULL           // [BETA] Optional: call func(data) on a background thread and return immediately, so automatic saves of io.IniFilename don't write the file on the UI thread. At most one call is in flight at a time. Memory allocators (see ImGui::SetAllocatorFunctions()) need to be thread-safe.
+    void*       IniSavingAsyncUserData;         // = NULL           // Passed to IniSavingAsyncFn()
     float       MouseDoubleClickTime;           // = 0.30f          // Time for a double-click, in seconds.
     float       MouseDoubleClickMaxDist;        // = 6.0f           // Distance threshold to stay in to validate a double-click, in pixels.
     float       MouseDragThreshold;             // = 6.0f           // Distance threshold before considering we are dragging.
@@ -1935,6 +1952,8 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigDrawListCacheVerify;      // = false          // [DEBUG] Windows using ImGuiWindowFlags_CacheDrawList always emit their vertices, and compare them to the cached output when the hash matches. Mismatches are counted in io.MetricsDrawListCacheErrors.
+    int         ConfigGlyphRunCacheBudget;      // = 0              // [BETA] Memory budget (in bytes) of the cache of text layouts used by CalcTextSize() and text rendering, least recently used text being evicted first. 0 to disable. Only text between IM_FONTGLYPHRUN_CACHE_MIN_LEN and IM_FONTGLYPHRUN_CACHE_MAX_LEN bytes is cached.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -2000,7 +2019,13 @@ struct ImGuiIO
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
-    int         MetricsActiveAllocations;           // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsActiveAllocations;           // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts, and approximate while other threads allocate (parallel font atlas builds, detached draw lists).
+    int         MetricsDrawListCacheHits;           // Number of windows using ImGuiWindowFlags_CacheDrawList which reused their cached output during last call to Render()
+    int         MetricsDrawListCacheMisses;         // Number of windows using ImGuiWindowFlags_CacheDrawList which rebuilt their output (or displayed it one frame late) during last call to Render()
+    int         MetricsDrawListCacheErrors;         // Number of cached outputs which differed from the rebuilt ones during last call to Render(), with io.ConfigDrawListCacheVerify
+    int         MetricsGlyphRunCacheHits;           // Number of text layouts reused from the glyph run cache during last frame, with io.ConfigGlyphRunCacheBudget > 0
+    int         MetricsGlyphRunCacheMisses;         // Number of text layouts computed and stored in the glyph run cache during last frame
+    int         MetricsGlyphRunCacheMemory;         // Memory used by the glyph run cache, in bytes
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     // Legacy: before 1.87, we required backend to fill io.KeyMap[] (imgui->native map) during initialization and io.KeysDown[] (native indices) every frame.
@@ -2156,7 +2181,7 @@ struct ImGuiTableSortSpecs
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiPlotBuffer, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2227,6 +2252,8 @@ struct ImGuiTextBuffer
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
 // This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// For storages receiving many new keys (e.g. a tree with 100k nodes being expanded), call SetUseHashIndex(true) to index pairs with a hash table:
+// insertion and lookup become O(1) and Data is kept in insertion order. Use '#define IMGUI_USE_STORAGE_HASH_INDEX' in imconfig.h to enable it for all storages.
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -2244,11 +2271,19 @@ struct ImGuiStorage
     };
 
     ImVector<ImGuiStoragePair>      Data;
+    ImVector<int>                   HashIndex;      // When UseHashIndex is set: open-addressing table of (index into Data + 1), 0 for empty slots
+    bool                            UseHashIndex;
 
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+#ifdef IMGUI_USE_STORAGE_HASH_INDEX
+    ImGuiStorage()      { UseHashIndex = true; }
+#else
+    ImGuiStorage()      { UseHashIndex = false; }
+#endif
+
+    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N), or O(1) with UseHashIndex.
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    void                Clear() { Data.clear(); HashIndex.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2271,7 +2306,11 @@ struct ImGuiStorage
     IMGUI_API void      SetAllInt(int val);
 
     // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // This also rebuilds the hash index, so call it after adding to Data directly when UseHashIndex is set.
     IMGUI_API void      BuildSortByKey();
+
+    // Switch between sorted storage (default) and hash indexed storage. Enabling it on a window: ImGui::GetStateStorage()->SetUseHashIndex(true);
+    IMGUI_API void      SetUseHashIndex(bool enable);
 };
 
 // Helper: Manually clip large list of items.
@@ -2311,6 +2350,16 @@ struct ImGuiListClipper
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
+    // Variable height mode: for items of different heights (e.g. wrapped text, expanded table rows).
+    // - The height of each item is measured when it is submitted and stored under 'str_id' (in the current ID scope) across frames.
+    //   Items never submitted yet use the average height of measured items, or 'items_height_estimate' until any is measured (use -1.0f to use the height of the first item measured).
+    // - When items above the first visible item get measured (e.g. when scrolling up) or the average height changes, the window scrolls by the change of their heights so visible items stay in place.
+    //   Scroll requests made by an item (e.g. SetScrollHereY() on an item of ForceDisplayRangeByIndices()) are adjusted the same way, so they land on that item.
+    // - Each Step() returns a single item so it can be measured. Seeking to the visible items is O(log n).
+    // - Call ClearItemHeights() after Begin() if the items changed order or contents (e.g. after sorting), as heights are stored per index.
+    IMGUI_API void  BeginVariableHeight(const char* str_id, int items_count, float items_height_estimate = -1.0f);
+    IMGUI_API void  ClearItemHeights();
+
     // Call ForceDisplayRangeByIndices() before first call to Step() if you need a range of items to be displayed regardless of visibility.
     IMGUI_API void  ForceDisplayRangeByIndices(int item_min, int item_max); // item_max is exclusive e.g. use (42, 42+1) to make item 42 always visible BUT due to alignment/padding of certain items it is likely that an extra item may be included on either end of the display range.
 
@@ -2319,6 +2368,160 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Ring buffer of values for PlotLines()/PlotHistogram() with very large values count. [BETA]
+// - Keeps the min/max of blocks of values at multiple resolutions (updated when appending), so the min/max of any range of values is
+//   found without reading all of them, and the plot draws the exact min/max envelope of each pixel column.
+// - Once full, appending overwrites the oldest values. NaN values are ignored.
+// Usage:
+//   static ImGuiPlotBuffer buffer;
+//   if (buffer.GetCapacity() == 0)
+//       buffer.Init(10000000);
+//   buffer.Append(new_samples, new_samples_count);
+//   ImGui::PlotLines("Telemetry", &buffer);
+struct ImGuiPlotBuffer
+{
+    ImVector<float>     Values;         // Values.Size == capacity. The oldest value is at index 0 until full, then at index Head.
+    ImVector<ImVec2>    Levels;         // (min, max) of blocks of values: 16 values at level 0, then each level combines 2 blocks of the previous one
+    ImVector<int>       LevelsOffsets;  // Index of the first block of each level in Levels[]
+    int                 Count;          // Number of values stored (<= capacity)
+    int                 Head;           // Index where the next value is written
+
+    ImGuiPlotBuffer()                   { Count = Head = 0; }
+    IMGUI_API void      Init(int capacity);
+    IMGUI_API void      Clear();                                    // Remove all values (keep capacity)
+    IMGUI_API void      Append(const float* values, int values_count);
+    void                Append(float v)                             { Append(&v, 1); }
+    int                 GetCapacity() const                         { return Values.Size; }
+    IMGUI_API float     GetValue(int idx) const;                    // idx == 0 for the oldest value
+    IMGUI_API bool      GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const; // Of values [idx_begin, idx_end). Return false if there are none (or all NaN)
+};
+
+// Helper: Sorted and filtered view of the rows of a large data set, for tables. [BETA]
+// - Rows[] holds the indices of your rows passing the filter, in the order of the table sort specs: display Rows[n] as the n-th row.
+// - Update() sorts again when the sort specs of the current table changed (so call it after TableSetupColumn()), and filters again when
+//   the filter changed. When the filter text was only extended (e.g. typing in a single word), only the rows of the view are tested.
+// - Call AddRows() after appending rows to your data set: they are sorted on their own then merged into the view, without a full sort.
+//   Call Rebuild() when rows were removed or modified.
+// - Sorting or filtering all rows runs on the calling thread by default, which takes seconds to sort and ~100 ms to filter millions of rows.
+//   Set ParallelForFn to sort and filter on worker threads (rows are split in chunks, sorted chunks are merged in parallel), and/or AsyncJobFn
+//   to do it on a background thread: Update() then returns right away, Rows[] keeps the previous result and is swapped by the Update() call
+//   after the job is done. While IsUpdating(), CompareFn and GetRowTextFn are called from the job thread: rows already added must not be
+//   modified or moved in memory (appending rows is fine if their storage doesn't reallocate), and memory allocators need to be thread-safe.
+// - CompareFn is called with one of the table sort specs and returns the ascending order of two rows for this column (<0, 0, >0).
+//   Ties over all the sort specs are ordered by row index, so the order is deterministic.
+// Usage:
+//   static ImGuiTableIndexView view; // Set view.CompareFn, view.GetRowTextFn, view.UserData and call view.AddRows(rows_count) once
+//   filter.Draw();
+//   if (ImGui::BeginTable("##table", 3, ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY))
+//   {
+//       [...] TableSetupColumn() calls
+//       view.Update(&filter);
+//       ImGuiListClipper clipper;
+//       clipper.Begin(view.Rows.Size);
+//       while (clipper.Step())
+//           for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+//               DisplayMyRow(view.Rows[n]);
+//       ImGui::EndTable();
+//   }
+struct ImGuiTableIndexView
+{
+    int                 (*CompareFn)(const ImGuiTableColumnSortSpecs* spec, int row_a, int row_b, void* user_data); // Optional: without it rows stay in their order
+    const char*         (*GetRowTextFn)(int row, void* user_data);  // Optional: text tested by the filter. Without it all rows pass. Called from worker threads with ParallelForFn.
+    void*               UserData;
+    ImGuiParallelForFn  ParallelForFn;  // Optional: sort and filter on worker threads.
+    void*               ParallelForUserData;
+    ImGuiAsyncJobFn     AsyncJobFn;     // Optional: sort and filter all rows on a background thread, Rows[] keeps the previous result until done.
+    void*               AsyncJobUserData;
+
+    ImVector<int>       Rows;           // Rows passing the filter, sorted
+    ImVector<int>       SortedRows;     // All rows, sorted
+    int                 RowsCount;      // Number of rows of the data set
+    ImVector<ImGuiTableColumnSortSpecs> SortSpecs; // Sort specs of SortedRows[] (of JobSortedRows[] while a sorting job is running)
+    ImVector<char>      FilterText;     // Filter text of Rows[] (zero-terminated, empty when the filter is not active)
+    ImVector<int>       TempRows;
+    bool                NeedRebuild;
+    volatile int        JobState;       // 0: no job, 1: AsyncJobFn job running, 2: job done, results not swapped yet (read/written with atomics)
+    bool                JobSort;        // Job sorts all rows to JobSortedRows[], otherwise only filters
+    bool                JobNarrowFilter;// Job filters Rows[] rather than SortedRows[]
+    int                 JobRowsCount;
+    ImVector<int>       JobRows;        // Output of the job, swapped with Rows[] by Update()
+    ImVector<int>       JobSortedRows;  // Output of the job, swapped with SortedRows[] by Update()
+    ImVector<char>      JobFilterText;
+
+    IMGUI_API ImGuiTableIndexView();
+    IMGUI_API ~ImGuiTableIndexView();                               // Wait for the AsyncJobFn job
+    IMGUI_API void      Clear();                                    // Remove all rows and free memory (waits for the AsyncJobFn job)
+    IMGUI_API void      AddRows(int rows_count);                    // Rows [RowsCount, RowsCount + rows_count) were appended to the data set
+    IMGUI_API void      Rebuild(int rows_count);                    // Rows were removed or modified: sort and filter all rows again on the next Update()
+    IMGUI_API bool      Update(const ImGuiTextFilter* filter = NULL); // Return true when Rows[] changed. Clears the SpecsDirty flag of the current table sort specs.
+    IMGUI_API bool      IsUpdating() const;                         // Return true while the AsyncJobFn job is running or its results were not swapped into Rows[] yet
+};
+
+// Helper: Tree of a very large hierarchy (e.g. file system, object graph) only submitting the visible tree nodes. [BETA]
+// - Nodes are identified by an ImU64 of your choice (index, pointer, etc.) and read through callbacks. Children are only queried when their parent is opened.
+// - Rows[] is the flattened list of the nodes whose ancestors are all open. Opening or closing a node only inserts or removes the rows of its
+//   descendants, and Step() uses a ImGuiListClipper over Rows[]: all rows must have the same height.
+// - Open state is stored in the window storage like TreeNode(), under an ID made of the node and its ancestors.
+// - Step() submits a row with TreeNodeBehavior() then returns true: the tree node is the last item so you can use IsItemClicked(),
+//   BeginPopupContextItem() etc. and submit more items on the same line. Keyboard navigation opens and closes nodes like TreeNode() and
+//   ImGuiTreeNodeFlags_NavLeftJumpsBackHere makes Left jump to the parent row, even when it is clipped.
+// - Call Rebuild() when the hierarchy changed. Nodes opened or closed with SetNextItemOpen() or the storage are only taken into account by Rebuild().
+// - With ImGuiTreeNodeFlags_DefaultOpen, a node which is also one of its ancestors (e.g. in a graph with cycles) starts closed.
+// Usage:
+//   static ImGuiVirtualTree tree; // Set tree.GetChildrenCountFn, tree.GetChildFn, tree.GetLabelFn, tree.UserData and tree.RootNode once
+//   if (tree.Begin("##tree", ImGuiTreeNodeFlags_OpenOnArrow))
+//   {
+//       while (tree.Step())
+//           if (ImGui::IsItemClicked())
+//               selected_node = tree.Node;
+//       tree.End();
+//   }
+struct ImGuiVirtualTreeRow
+{
+    ImU64               Node;
+    ImGuiID             ID;             // Hash of the node, seeded with the ID of its parent row
+    ImS16               Depth;          // 0 for children of the root node
+    bool                IsLeaf;
+    bool                IsOpen;
+};
+
+struct ImGuiVirtualTree
+{
+    int                 (*GetChildrenCountFn)(ImU64 node, void* user_data);         // Called when a node is opened (and for each new row without IsLeafFn)
+    ImU64               (*GetChildFn)(ImU64 node, int child_n, void* user_data);    // Called for each child of a node being opened
+    const char*         (*GetLabelFn)(ImU64 node, void* user_data);                 // Called for displayed rows only
+    bool                (*IsLeafFn)(ImU64 node, void* user_data);                   // Optional: without it nodes without children are leaves
+    bool                (*IsSelectedFn)(ImU64 node, void* user_data);               // Optional: display the row with ImGuiTreeNodeFlags_Selected
+    void*               UserData;
+    ImU64               RootNode;       // Not displayed: its children are the rows of depth 0
+
+    ImVector<ImGuiVirtualTreeRow> Rows; // Rows which can be displayed, in order
+    ImU64               Node;           // Node of the row submitted by the last Step()
+    int                 RowIndex;       // Index in Rows[] of the row submitted by the last Step(), -1 outside of the loop
+    int                 Depth;
+
+    ImGuiListClipper    Clipper;        // [Internal]
+    ImGuiID             ID;
+    ImGuiTreeNodeFlags  Flags;
+    float               RowIndent;      // Indentation of the current row
+    int                 NavLeftRow;     // Row to jump back to its parent from (ImGuiTreeNodeFlags_NavLeftJumpsBackHere)
+    int                 NavRow;         // Row holding the navigation focus this frame
+    int                 ScrollToRow;
+    ImVector<int>       ToggledRows;
+    ImVector<ImU64>     ScrollToPath;
+    ImVector<ImGuiVirtualTreeRow> TempRows;
+    ImVector<ImGuiVirtualTreeRow> TempStack;    // Rows waiting to be added, when opening nodes
+    ImVector<ImU64>     TempPath;       // Ancestors of the rows being added, RootNode first
+    bool                NeedRebuild;
+
+    IMGUI_API ImGuiVirtualTree();
+    IMGUI_API bool      Begin(const char* str_id, ImGuiTreeNodeFlags flags = 0); // Only call End() if Begin() returns true
+    IMGUI_API bool      Step();                                     // Call until it returns false. Submits the row Rows[RowIndex].
+    IMGUI_API void      End();                                      // Apply open/close changes of this frame to Rows[]
+    IMGUI_API void      Rebuild();                                  // Rebuild Rows[] from the root on the next Begin()
+    IMGUI_API void      ScrollToNode(const ImU64* path, int path_count); // Open the ancestors of path[path_count - 1] and scroll to it on the next Begin(), moving the navigation focus to it if the window is focused. path[0] is a child of RootNode.
+};
+
 // Helpers macros to generate 32-bit encoded colors
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
 #define IM_COL32_R_SHIFT    16
@@ -2484,7 +2687,10 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLines        = 1 << 0,  // Enable anti-aliased lines/borders (*2 the number of triangles for 1.0f wide line or lines thin enough to be drawn using textures, otherwise *3 the number of triangles)
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering.
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
-    ImDrawListFlags_AllowVtxOffset          = 1 << 3   // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_HashContents            = 1 << 4,  // [Internal] Hash draw calls and render state into _ContentHash. Set on windows using ImGuiWindowFlags_CacheDrawList.
+    ImDrawListFlags_SkipGeometry            = 1 << 5,  // [Internal] Only hash draw calls, don't emit vertices. Set while a window using ImGuiWindowFlags_CacheDrawList is reusing its previous output.
+    ImDrawListFlags_GlyphRunCache           = 1 << 6   // Reuse text layouts from ImDrawListSharedData::GlyphRunCache in AddText(). Set when io.ConfigGlyphRunCacheBudget > 0, cleared on detached lists.
 };
 
 // Draw command list
@@ -2516,9 +2722,13 @@ struct ImDrawList
     ImDrawCmdHeader         _CmdHeader;         // [Internal] template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
+    ImU32                   _ContentHash;       // [Internal] hash of draw calls since last reset, when ImDrawListFlags_HashContents is set
+    int                     _PrimHashVtxStart;  // [Internal] start of vertices written since last PrimReserve() and not hashed yet, -1 if none
+    int                     _PrimHashIdxStart;  // [Internal] start of indices written since last PrimReserve() and not hashed yet
+    unsigned int            _PrimHashVtxBase;   // [Internal] _VtxCurrentIdx at last PrimReserve(), indices are hashed relative to it
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
-    ImDrawList(const ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); _Data = shared_data; }
+    ImDrawList(const ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); _Data = shared_data; _PrimHashVtxStart = -1; }
 
     ~ImDrawList() { _ClearFreeMemory(); }
     IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
@@ -2579,6 +2789,17 @@ struct ImDrawList
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
 
+    // Advanced: Detached lists
+    // - Use to build geometry outside of a window draw list, e.g. from worker threads, then splice it into one.
+    // - Create with IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()) and call ResetDetached() from the main thread after NewFrame(), every frame.
+    // - A detached list may then be filled from any thread, one thread per list. Shared data is only read, so lists sharing it can be filled concurrently,
+    //   but your allocator (see SetAllocatorFunctions()) needs to be thread-safe and io.MetricsActiveAllocations may become inaccurate.
+    // - Text may use fonts built with ImFontAtlasFlags_DynamicGlyphs: missing glyphs are queued with atomics and drawn with the fallback glyph until the next NewFrame().
+    //   Anything else modifying fonts or the atlas (Build(), AddGlyph(), AddRemapChar()...) must not happen while lists are being filled.
+    // - Back on the main thread, AddDrawList() appends a list to e.g. GetWindowDrawList(), clipped by the destination current clip rectangle.
+    IMGUI_API void  ResetDetached();                                            // Reset for a new frame, with font texture and full-screen clip rectangle pushed.
+    IMGUI_API void  AddDrawList(const ImDrawList* src_list);                    // Append commands/vertices/indices of another list sharing our ImDrawListSharedData. Fixes up ClipRect, IdxOffset, VtxOffset.
+
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
     // - Use to minimize draw calls (e.g. if going back-and-forth between multiple clipping rectangles, prefer to append into separate channels then merge at the end)
@@ -2592,6 +2813,7 @@ struct ImDrawList
     // Advanced: Primitives allocations
     // - We render triangles (three vertices)
     // - All primitives needs to be reserved via PrimReserve() beforehand.
+    // - In windows using ImGuiWindowFlags_CacheDrawList, what you write after PrimReserve() is hashed on the next draw call, PrimReserve() or end of window.
     IMGUI_API void  PrimReserve(int idx_count, int vtx_count);
     IMGUI_API void  PrimUnreserve(int idx_count, int vtx_count);
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
@@ -2614,6 +2836,8 @@ struct ImDrawList
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _PrimReserve(int idx_count, int vtx_count);     // PrimReserve() for callers which already hashed their arguments
+    IMGUI_API void  _HashPrimWrites();
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
@@ -2712,13 +2936,22 @@ struct ImFontAtlasCustomRect
     bool IsPacked() const           { return X != 0xFFFF; }
 };
 
+// [BETA] A region of the atlas texture which changed after Build() (see ImFontAtlasFlags_DynamicGlyphs).
+// Renderer backends upload the pixels of each region from TexPixelsAlpha8/TexPixelsRGBA32 then clear the ImFontAtlas::TexUpdates[] list.
+struct ImFontAtlasTexUpdate
+{
+    unsigned short  X, Y;
+    unsigned short  Width, Height;
+};
+
 // Flags for ImFontAtlas build
 enum ImFontAtlasFlags_
 {
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
-    ImFontAtlasFlags_NoBakedLines       = 1 << 2    // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 3    // [BETA] Only rasterize codepoints 0x00-0xFF in Build(). Other codepoints of the glyph ranges are rasterized in NewFrame() after first being used, least recently used ones are evicted when the texture is full. Requires ImGuiBackendFlags_RendererHasTexUpdates and keeping the CPU-side texture data (don't call ClearTexData()). stb_truetype only.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2808,6 +3041,9 @@ struct ImFontAtlas
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
+    ImGuiParallelForFn          BuildParallelForFn; // [BETA] Optional: call func(data, 0..count-1) from worker threads, returning once all calls are done, so Build() rasterizes glyphs in parallel. Output is identical to a single-threaded build. Memory allocators (see ImGui::SetAllocatorFunctions()) need to be thread-safe, and io.MetricsActiveAllocations is approximate during the build.
+    void*                       BuildParallelForUserData; // Passed to BuildParallelForFn()
+    const char*                 BuildCacheFilename; // = NULL   // [BETA] Optional: path to an atlas cache file. Build() loads the texture and glyphs from it when it was written from the same fonts and settings, otherwise builds normally and rewrites it. Ignored when using a custom FontBuilderIO or ImFontAtlasFlags_DynamicGlyphs.
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2823,6 +3059,9 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    int                         GlyphDataVersion;   // Incremented when glyphs of any font are rebuilt or destroyed, to invalidate cached text layouts
+    ImVector<ImFontAtlasTexUpdate> TexUpdates;      // Regions of the texture modified since the renderer backend last uploaded them (with ImFontAtlasFlags_DynamicGlyphs)
+    ImFontAtlasDynamicGlyphs*   DynamicGlyphs;      // State of glyphs rasterized on demand, when built with ImFontAtlasFlags_DynamicGlyphs
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
@@ -2859,6 +3098,7 @@ struct ImFont
     ImWchar                     EllipsisChar;       // 2     // out // = '...'    // Character used for ellipsis rendering.
     ImWchar                     DotChar;            // 2     // out // = '.'      // Character used for ellipsis rendering (if a single '...' character isn't found)
     bool                        DirtyLookupTables;  // 1     // out //
+    bool                        UseDynamicGlyphs;   // 1     // out //            // Glyphs are rasterized on demand (see ImFontAtlasFlags_DynamicGlyphs)
     float                       Scale;              // 4     // in  // = 1.f      // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
@@ -7,6 +7,7 @@
 //  [X] Platform: Gamepad support. Enable with 'io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad'.
 //  [x] Platform: Mouse cursor shape and visibility. Disable with 'io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange'. FIXME: 3 cursors types are missing from GLFW.
 //  [X] Platform: Keyboard arrays indexed using GLFW_KEY_* codes, e.g. ImGui::IsKeyPressed(GLFW_KEY_SPACE).
+//  [X] Platform: Optional power saving mode (block waiting for events while idle instead of rendering continuously). Enable with ImGui_ImplGlfw_SetPowerSaving(), see ImGui_ImplGlfw_WaitForEvents().
 
 // You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
@@ -27,6 +28,26 @@ IMGUI_IMPL_API bool     ImGui_ImplGlfw_InitForOther(GLFWwindow* window, bool ins
 IMGUI_IMPL_API void     ImGui_ImplGlfw_Shutdown();
 IMGUI_IMPL_API void     ImGui_ImplGlfw_NewFrame();
 
+// Power saving (event-driven rendering)
+// - Call ImGui_ImplGlfw_WaitForEvents() instead of glfwPollEvents() at the end of your main loop. With power saving enabled it blocks while
+//   nothing happens, so NewFrame()/Render()/SwapBuffers() don't run for frames that would be identical. Without it, it just polls.
+// - Dear ImGui reports when it needs frames without input (blinking text cursor, fading, held keys...) through ImGui::GetEventWaitingTime().
+//   For your own animations, call ImGui::SetMaxWaitBeforeNextFrame() during the frame.
+// - To wake up the loop when data displayed by the UI changes elsewhere, call ImGui_ImplGlfw_RequestRedraw(). It may be called from any thread.
+// - Requires GLFW 3.2+ (glfwWaitEventsTimeout), otherwise we keep polling whenever an animation is requested.
+IMGUI_IMPL_API void     ImGui_ImplGlfw_SetPowerSaving(bool enabled);
+IMGUI_IMPL_API void     ImGui_ImplGlfw_WaitForEvents();
+IMGUI_IMPL_API void     ImGui_ImplGlfw_RequestRedraw();
+
+// Counters updated by ImGui_ImplGlfw_WaitForEvents()
+struct ImGui_ImplGlfw_Stats
+{
+    float   FramesPerSecond;    // Effective frame rate over the last measurement period (one second or more, a single idle wait may last longer)
+    float   IdleRatio;          // Fraction of the same period spent blocked waiting for events, i.e. CPU time saved compared to rendering continuously
+    int     FramesRendered;     // Total number of frames (calls to ImGui_ImplGlfw_WaitForEvents())
+};
+IMGUI_IMPL_API const ImGui_ImplGlfw_Stats& ImGui_ImplGlfw_GetStats();
+
 // GLFW callbacks
 // - When calling Init with 'install_callbacks=true': GLFW callbacks will be installed for you. They will call user's previously installed callbacks, if any.
 // - When calling Init with 'install_callbacks=false': GLFW callbacks won't be installed. You will need to call those function yourself from your own GLFW callbacks.
@@ -3,6 +3,13 @@
 
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Optional streaming of vertex/index data through buffer objects (VBO/IBO). Enable with ImGui_ImplOpenGL2_Flags_UseBufferObjects.
+//  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices, when using buffer objects.
+//  [X] Renderer: Redundant texture/scissor changes are skipped and adjacent compatible ImDrawCmd are merged into a single draw call. See ImGui_ImplOpenGL2_GetStats().
+//  [X] Renderer: Optional host-owned GL state (no state readback/restore, only changes are applied). Enable with ImGui_ImplOpenGL2_Flags_HostOwnsState.
+//  [X] Renderer: Optional partial redraw of the region that changed since the previous frame(s). See ImGui_ImplOpenGL2_ComputeDamage().
+//  [X] Renderer: Optional single-channel (GL_ALPHA) font texture, 4x smaller than RGBA. Enable with ImGui_ImplOpenGL2_Flags_FontAlpha8.
+//  [X] Renderer: Partial font texture updates for glyphs rasterized on demand (ImGuiBackendFlags_RendererHasTexUpdates, see ImFontAtlasFlags_DynamicGlyphs).
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this. 
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -20,11 +27,55 @@
 #pragma once
 #include "imgui.h"      // IMGUI_IMPL_API
 
-IMGUI_IMPL_API bool     ImGui_ImplOpenGL2_Init();
+typedef int ImGui_ImplOpenGL2_Flags;     // -> enum ImGui_ImplOpenGL2_Flags_
+
+// Optional features, passed to ImGui_ImplOpenGL2_Init()
+enum ImGui_ImplOpenGL2_Flags_
+{
+    ImGui_ImplOpenGL2_Flags_None                = 0,
+    ImGui_ImplOpenGL2_Flags_UseBufferObjects    = 1 << 0,   // Upload all command lists of a frame into one orphaned VBO/IBO pair and draw from it, instead of client-side arrays. Requires OpenGL 1.5 or GL_ARB_vertex_buffer_object (otherwise silently falls back) and a 'get_proc_address' loader.
+    ImGui_ImplOpenGL2_Flags_HostOwnsState       = 1 << 1,   // Host manages GL state: RenderDrawData() doesn't read back/push/restore anything and leaves its own state in place, only re-applying what changed since last frame. Call ImGui_ImplOpenGL2_InvalidateState() after modifying any state the backend sets (see SetupRenderState()).
+    ImGui_ImplOpenGL2_Flags_ValidateState       = 1 << 2,   // Debug: with HostOwnsState, read back GL state at the start of RenderDrawData() and assert that it matches what the backend expects. Stalls the pipeline!
+    ImGui_ImplOpenGL2_Flags_FontAlpha8          = 1 << 3,   // Upload the font atlas from GetTexDataAsAlpha8() as a GL_ALPHA texture (1 byte per texel instead of 4), and don't keep the RGBA32 copy in CPU memory. Falls back to RGBA when the atlas has colored glyphs. User textures are unaffected.
+};
+
+// Loader for OpenGL entry points that legacy headers don't declare. Signature-compatible with glfwGetProcAddress(), SDL_GL_GetProcAddress(), eglGetProcAddress().
+typedef void (*ImGui_ImplOpenGL2_GLProc)(void);
+typedef ImGui_ImplOpenGL2_GLProc (*ImGui_ImplOpenGL2_GetProcAddressFunc)(const char* name);
+
+// The GL context must be current when calling Init().
+IMGUI_IMPL_API bool     ImGui_ImplOpenGL2_Init(ImGui_ImplOpenGL2_Flags flags = 0, ImGui_ImplOpenGL2_GetProcAddressFunc get_proc_address = NULL);
 IMGUI_IMPL_API void     ImGui_ImplOpenGL2_Shutdown();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL2_NewFrame();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data);
 
+// Counters for the last call to ImGui_ImplOpenGL2_RenderDrawData()
+struct ImGui_ImplOpenGL2_Stats
+{
+    int     DrawCalls;          // glDrawElements() calls issued
+    int     CmdsMerged;         // ImDrawCmd appended to the previous draw call instead of issuing their own (shared texture and clip rectangle, contiguous indices)
+    int     TexBindsSkipped;    // glBindTexture() calls skipped because the texture was already bound
+    int     ScissorsSkipped;    // glScissor() calls skipped because the rectangle was already set
+    int     CmdsCulled;         // ImDrawCmd skipped because they are entirely outside of the damaged region
+    float   DamageRatio;        // Fraction of the framebuffer redrawn (1.0f on full redraws, including when ImGui_ImplOpenGL2_ComputeDamage() isn't used)
+    int     TexUpdates;         // Font texture regions uploaded with glTexSubImage2D() (glyphs rasterized on demand)
+};
+IMGUI_IMPL_API const ImGui_ImplOpenGL2_Stats& ImGui_ImplOpenGL2_GetStats();
+
+// With ImGui_ImplOpenGL2_Flags_HostOwnsState: notify the backend that GL state was modified outside of it, so it is fully set up again on the next render.
+IMGUI_IMPL_API void     ImGui_ImplOpenGL2_InvalidateState();
+
+// Partial redraw (optional, for fill-rate bound setups e.g. software GL)
+// - Call every frame after ImGui::Render(): each command list is compared (content hash and bounds) with the previous frame to get the framebuffer
+//   region which changed. The next ImGui_ImplOpenGL2_RenderDrawData() clips everything it draws to that region.
+// - 'out_rect' receives { x, y, width, height } in GL window coordinates (origin at bottom-left): restrict your glClear() and own rendering to it with glScissor().
+// - 'buffer_age' is the number of frames since the back buffer was last drawn to: 1 for single-buffered or copy-swap setups, usually 2 for double-buffered
+//   flips (query EGL_EXT_buffer_age / GLX_EXT_buffer_age when available). Pass 0 to force a full redraw, e.g. when your own content changed.
+// - Switches to a full redraw when the region exceeds 'full_redraw_ratio' of the framebuffer (overhead of scissored clears isn't worth it).
+// - Changes we can't see aren't detected: contents of user textures, or of what user callbacks draw (lists with callbacks are always redrawn).
+// - Returns false when nothing changed: you should skip rendering and presenting the frame altogether.
+IMGUI_IMPL_API bool     ImGui_ImplOpenGL2_ComputeDamage(ImDrawData* draw_data, int buffer_age, int out_rect[4], float full_redraw_ratio = 0.60f);
+
 // Called by Init/NewFrame/Shutdown
 IMGUI_IMPL_API bool     ImGui_ImplOpenGL2_CreateFontsTexture();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL2_DestroyFontsTexture();
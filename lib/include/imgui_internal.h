@@ -53,6 +53,9 @@ Index of this file:
 #include <stdlib.h>     // NULL, malloc, free, qsort, atoi, atof
 #include <math.h>       // sqrtf, fabsf, fmodf, powf, floorf, ceilf, cosf, sinf
 #include <limits.h>     // INT_MIN, INT_MAX
+#if defined(_MSC_VER)
+#include <intrin.h>     // _InterlockedXXX, _ReadWriteBarrier
+#endif
 
 // Enable SSE intrinsics if available
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64) && !defined(IMGUI_DISABLE_SSE)
@@ -114,6 +117,7 @@ struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
+struct ImFontGlyphRunCache;         // Cache of text layouts, for ImGui::CalcTextSize() and ImFont::RenderText()
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
@@ -121,6 +125,7 @@ struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDat
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiLastItemData;           // Status storage for last submitted items
+struct ImGuiListClipperHeights;     // Persistent item heights of a variable height ImGuiListClipper
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
 struct ImGuiNavItemData;            // Result of a gamepad/keyboard directional navigation move query result
 struct ImGuiMetricsConfig;          // Storage for ShowMetricsWindow() and DebugNodeXXX() functions
@@ -130,6 +135,8 @@ struct ImGuiOldColumnData;          // Storage data for a single column for lega
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
 struct ImGuiPopupData;              // Storage for current popup stack
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
+struct ImGuiSettingsBinaryRecords;  // Records of one type in binary settings data, sorted by ID
+struct ImGuiSettingsIniCache;       // Location of a settings entry in the last .ini output
 struct ImGuiStackSizes;             // Storage of stack sizes for debugging/asserting
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
@@ -296,6 +303,31 @@ namespace ImStb
 // Helpers: Hashing
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImU32 seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImU32 seed = 0);
+// Hash backends: ImHashData()/ImHashStr() forward to the one selected in imconfig.h (CRC32 by default). All backends support ### in ImHashStrXXX().
+IMGUI_API ImGuiID       ImHashDataCrc32(const void* data, size_t data_size, ImU32 seed);
+IMGUI_API ImGuiID       ImHashStrCrc32(const char* data, size_t data_size, ImU32 seed);
+IMGUI_API ImGuiID       ImHashDataCrc32c(const void* data, size_t data_size, ImU32 seed);     // SSE4.2 crc32 instruction if the CPU supports it, lookup table otherwise
+IMGUI_API ImGuiID       ImHashStrCrc32c(const char* data, size_t data_size, ImU32 seed);
+IMGUI_API ImGuiID       ImHashDataMix64(const void* data, size_t data_size, ImU32 seed);      // 64-bit multiply/rotate mixing of 8 bytes at a time, truncated to 32-bit
+IMGUI_API ImGuiID       ImHashStrMix64(const char* data, size_t data_size, ImU32 seed);
+// Murmur3 mixing of 4 bytes at a time, inlined for hashing large or frequent buffers (draw list contents) where the result is only compared with itself.
+static inline ImU32     ImHashDataMurmur3(const void* data, size_t data_size, ImU32 seed)
+{
+    ImU32 h = seed;
+    const unsigned char* p = (const unsigned char*)data;
+    for (; data_size >= 4; data_size -= 4, p += 4)
+    {
+        ImU32 k;
+        memcpy(&k, p, 4);
+        k *= 0xCC9E2D51; k = (k << 15) | (k >> 17); k *= 0x1B873593;
+        h ^= k; h = (h << 13) | (h >> 19); h = h * 5 + 0xE6546B64;
+    }
+    ImU32 k = 0;
+    for (ImU32 shift = 0; data_size > 0; data_size--, p++, shift += 8)
+        k |= (ImU32)*p << shift;
+    k *= 0xCC9E2D51; k = (k << 15) | (k >> 17); k *= 0x1B873593;
+    return h ^ k;
+}
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 static inline ImGuiID   ImHash(const void* data, int size, ImU32 seed = 0) { return size ? ImHashData(data, (size_t)size, seed) : ImHashStr((const char*)data, 0, seed); } // [moved to ImHashStr/ImHashData in 1.68]
 #endif
@@ -384,11 +416,51 @@ IMGUI_API bool              ImFileClose(ImFileHandle file);
 IMGUI_API ImU64             ImFileGetSize(ImFileHandle file);
 IMGUI_API ImU64             ImFileRead(void* data, ImU64 size, ImU64 count, ImFileHandle file);
 IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 count, ImFileHandle file);
+IMGUI_API bool              ImFileRename(const char* src_filename, const char* dst_filename);   // Replace dst_filename atomically where the OS allows it
 #else
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
 
+// Helpers: Time
+IMGUI_API double            ImGetTimeSeconds();     // Monotonic high resolution clock (seconds from an arbitrary origin), 0.0 if unavailable. Used by profiling counters in Metrics/Debugger.
+IMGUI_API void              ImSleepMilliseconds(int ms); // Suspend the calling thread, return right away if unavailable. Used to wait for background jobs.
+
+// Helpers: Atomics, for state shared with background jobs and worker threads. Loads are acquire, stores are release.
+// (x86/x64 loads and stores already have those semantics: MSVC only needs to keep the compiler from reordering them)
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+static inline int       ImAtomicLoad(volatile int* p)                   { const int v = *p; _ReadWriteBarrier(); return v; }
+static inline void      ImAtomicStore(volatile int* p, int v)           { _ReadWriteBarrier(); *p = v; }
+static inline ImWchar   ImAtomicLoad(volatile ImWchar* p)               { const ImWchar v = *p; _ReadWriteBarrier(); return v; }
+static inline void      ImAtomicStore(volatile ImWchar* p, ImWchar v)   { _ReadWriteBarrier(); *p = v; }
+#elif defined(_MSC_VER)
+static inline int       ImAtomicLoad(volatile int* p)                   { return (int)_InterlockedCompareExchange((volatile long*)p, 0, 0); }
+static inline void      ImAtomicStore(volatile int* p, int v)           { _InterlockedExchange((volatile long*)p, (long)v); }
+#ifdef IMGUI_USE_WCHAR32
+static inline ImWchar   ImAtomicLoad(volatile ImWchar* p)               { return (ImWchar)_InterlockedCompareExchange((volatile long*)p, 0, 0); }
+static inline void      ImAtomicStore(volatile ImWchar* p, ImWchar v)   { _InterlockedExchange((volatile long*)p, (long)v); }
+#else
+static inline ImWchar   ImAtomicLoad(volatile ImWchar* p)               { return (ImWchar)_InterlockedCompareExchange16((volatile short*)p, 0, 0); }
+static inline void      ImAtomicStore(volatile ImWchar* p, ImWchar v)   { _InterlockedExchange16((volatile short*)p, (short)v); }
+#endif
+#else
+static inline int       ImAtomicLoad(volatile int* p)                   { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static inline void      ImAtomicStore(volatile int* p, int v)           { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static inline ImWchar   ImAtomicLoad(volatile ImWchar* p)               { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static inline void      ImAtomicStore(volatile ImWchar* p, ImWchar v)   { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+#endif
+#if defined(_MSC_VER)
+static inline int       ImAtomicFetchAdd(volatile int* p, int v)        { return (int)_InterlockedExchangeAdd((volatile long*)p, (long)v); }
+#ifdef IMGUI_USE_WCHAR32
+static inline bool      ImAtomicCompareExchange(volatile ImWchar* p, ImWchar expected, ImWchar desired) { return _InterlockedCompareExchange((volatile long*)p, (long)desired, (long)expected) == (long)expected; }
+#else
+static inline bool      ImAtomicCompareExchange(volatile ImWchar* p, ImWchar expected, ImWchar desired) { return _InterlockedCompareExchange16((volatile short*)p, (short)desired, (short)expected) == (short)expected; }
+#endif
+#else
+static inline int       ImAtomicFetchAdd(volatile int* p, int v)        { return __atomic_fetch_add(p, v, __ATOMIC_ACQ_REL); }
+static inline bool      ImAtomicCompareExchange(volatile ImWchar* p, ImWchar expected, ImWchar desired) { return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE); }
+#endif
+
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
 // - Wrapper for standard libs functions. (Note that imgui_demo.cpp does _not_ use them to keep the code easy to copy)
@@ -522,6 +594,9 @@ struct IMGUI_API ImRect
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 // Helper: ImBitArray
+typedef ImU32* ImBitArrayPtr; // Name for use in structs
+inline size_t   ImBitArrayGetStorageSizeInBytes(int bitcount)   { return (size_t)((bitcount + 31) >> 5) << 2; }
+inline void     ImBitArrayClearAllBits(ImU32* arr, int bitcount){ memset(arr, 0, ImBitArrayGetStorageSizeInBytes(bitcount)); }
 inline bool     ImBitArrayTestBit(const ImU32* arr, int n)      { ImU32 mask = (ImU32)1 << (n & 31); return (arr[n >> 5] & mask) != 0; }
 inline void     ImBitArrayClearBit(ImU32* arr, int n)           { ImU32 mask = (ImU32)1 << (n & 31); arr[n >> 5] &= ~mask; }
 inline void     ImBitArraySetBit(ImU32* arr, int n)             { ImU32 mask = (ImU32)1 << (n & 31); arr[n >> 5] |= mask; }
@@ -707,6 +782,17 @@ struct ImChunkStream
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: SIMD code paths used by AddPolyline() for anti-aliased lines.
+// The SSE2 path is compiled when IMGUI_ENABLE_SSE is defined, the AVX2 path is selected at runtime if the CPU supports it.
+// All paths output the same vertices (the vector paths evaluate the same float operations as the scalar code, lane by lane).
+enum ImDrawSimdLevel
+{
+    ImDrawSimdLevel_Scalar,
+    ImDrawSimdLevel_SSE2,
+    ImDrawSimdLevel_AVX2
+};
+IMGUI_API ImDrawSimdLevel ImDrawGetMaxSimdLevel();     // Best level supported by the compiler and CPU
+
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
 struct IMGUI_API ImDrawListSharedData
@@ -718,17 +804,70 @@ struct IMGUI_API ImDrawListSharedData
     float           CircleSegmentMaxError;      // Number of circle segments to use per pixel of radius for AddCircle() etc
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
+    ImDrawSimdLevel SimdLevel;                  // SIMD code path for AddPolyline(), default to ImDrawGetMaxSimdLevel(). May be lowered e.g. to compare with the scalar path.
 
     // [Internal] Lookup tables
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
     float           ArcFastRadiusCutoff;                        // Cutoff radius after which arc drawing will fallback to slower PathArcTo()
     ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius before we calculate it dynamically (to avoid calculation overhead)
     const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas
+    ImFontGlyphRunCache* GlyphRunCache;         // Text layouts cache used by lists with ImDrawListFlags_GlyphRunCache. Not thread-safe.
 
     ImDrawListSharedData();
     void SetCircleTessellationMaxError(float max_error);
 };
 
+// Range of text lengths (in bytes) stored in ImFontGlyphRunCache. Other text is always laid out from scratch:
+// shorter text is faster to lay out than to look up, longer text would use too much memory.
+#ifndef IM_FONTGLYPHRUN_CACHE_MIN_LEN
+#define IM_FONTGLYPHRUN_CACHE_MIN_LEN           16
+#endif
+#ifndef IM_FONTGLYPHRUN_CACHE_MAX_LEN
+#define IM_FONTGLYPHRUN_CACHE_MAX_LEN           256
+#endif
+
+// Layout of a text string for a given font, size and wrap width. Size and quads are computed on demand.
+struct ImFontGlyphRun
+{
+    ImGuiID         Hash;
+    const ImFont*   Font;
+    float           Size;
+    float           WrapWidth;
+    ImVector<char>  Text;                       // Copy of the text, to resolve hash collisions
+    ImVector<ImDrawVert> Vtx;                   // 4 vertices per visible glyph, relative to the text origin. 'col' is OR-ed with the text color (0 or ~IM_COL32_A_MASK for colored glyphs). Valid when HasQuads is set
+    ImVec2          TextSize;                   // Result of ImFont::CalcTextSizeA(), valid when HasTextSize is set
+    ImRect          Bounds;                     // Bounding box of Vtx and of all lines, relative to the text origin. Valid when HasQuads is set
+    bool            HasTextSize;
+    bool            HasQuads;
+    int             MemorySize;                 // Heap memory accounted to this run
+    int             HashNext;                   // Next run in the same bucket (or next free run)
+    int             LruPrev, LruNext;           // Neighbors in use order, LruFirst being the most recently used
+};
+
+// LRU cache of text runs bounded by io.ConfigGlyphRunCacheBudget, cleared by NewFrame() when fonts are rebuilt.
+struct IMGUI_API ImFontGlyphRunCache
+{
+    ImVector<ImFontGlyphRun> Runs;
+    ImVector<int>   Buckets;                    // Hash table of run indices chained with HashNext. Size is a power of two
+    int             RunsCount;                  // Number of live runs
+    int             LruFirst, LruLast;          // Most and least recently used run
+    int             FreeFirst;                  // First unused entry in Runs[], chained with HashNext
+    int             MemoryBudget;               // Maximum value of MemoryUsed before evicting runs, in bytes
+    int             MemoryUsed;
+    int             GlyphDataVersion;           // Value of ImFontAtlas::GlyphDataVersion when the runs were laid out
+    int             Hits, Misses;               // Statistics since last NewFrame()
+
+    ImFontGlyphRunCache()   { RunsCount = MemoryBudget = MemoryUsed = Hits = Misses = 0; LruFirst = LruLast = FreeFirst = GlyphDataVersion = -1; }
+    ~ImFontGlyphRunCache()  { ClearFreeMemory(); }
+    ImFontGlyphRun* GetRun(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end); // Find or create run, mark it as most recently used
+    void            UpdateMemorySize(ImFontGlyphRun* run);  // Call after filling a run. May evict other runs to stay within budget.
+    void            ClearFreeMemory();
+
+    // [Internal]
+    void            RemoveRun(int run_idx);
+    void            RebuildBuckets(int buckets_count);
+};
+
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>   Layers[2];           // Global layers for: regular, tooltip
@@ -991,6 +1130,9 @@ struct IMGUI_API ImGuiMenuColumns
     void        CalcNextTotalWidth(bool update_offsets);
 };
 
+// Characters of ImGuiInputTextState::TextW between two entries of TextAOffsets[]
+#define IM_INPUTTEXT_OFFSETS_STRIDE     1024
+
 // Internal state of the currently focused/edited text input box
 // For a given item ID, access with ImGui::GetInputTextState()
 struct IMGUI_API ImGuiInputTextState
@@ -998,8 +1140,10 @@ struct IMGUI_API ImGuiInputTextState
     ImGuiID                 ID;                     // widget id owning the text state
     int                     CurLenW, CurLenA;       // we need to maintain our buffer length in both UTF-8 and wchar format. UTF-8 length is valid even if TextA is not.
     ImVector<ImWchar>       TextW;                  // edit buffer, we need to persist but can't guarantee the persistence of the user-provided buffer. so we copy into own buffer.
-    ImVector<char>          TextA;                  // temporary UTF8 buffer for callbacks and other operations. this is not updated in every code-path! size=capacity.
+    ImVector<char>          TextA;                  // UTF8 copy of TextW, for callbacks and for copying back to the user buffer. updated incrementally by every edit (not in read-only mode). size=capacity.
     ImVector<char>          InitialTextA;           // backup of end-user buffer at the time of focus (in UTF-8, unaltered)
+    ImVector<int>           TextAOffsets;           // offset in TextA of every IM_INPUTTEXT_OFFSETS_STRIDE-th character of TextW, to convert positions without scanning from the start. extended lazily, truncated by edits.
+    ImVector<int>           LineStarts;             // position in TextW of the first character of every line, so multi-line layout doesn't scan the text. built lazily, updated by edits.
     bool                    TextAIsValid;           // temporary UTF8 buffer is not initially valid before we make the widget active (until then we pull the data from user argument)
     int                     BufCapacityA;           // end-user buffer capacity
     float                   ScrollX;                // horizontal scrolling/offset
@@ -1011,8 +1155,13 @@ struct IMGUI_API ImGuiInputTextState
     ImGuiInputTextFlags     Flags;                  // copy of InputText() flags
 
     ImGuiInputTextState()                   { memset(this, 0, sizeof(*this)); }
-    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); }
+    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; TextAOffsets.resize(0); LineStarts.resize(0); CursorClamp(); }
+    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); TextAOffsets.clear(); LineStarts.clear(); }
+    int         GetTextAOffset(int pos_w);  // convert a TextW position to a TextA (UTF-8) offset
+    void        BuildLineStarts();          // rebuild LineStarts[] if it was invalidated
+    int         GetLineCount()              { BuildLineStarts(); return LineStarts.Size; }
+    int         GetLineStart(int line)      { BuildLineStarts(); return (line < LineStarts.Size) ? LineStarts[line] : CurLenW; }
+    int         GetLineIndex(int pos_w);    // line containing a TextW position
     int         GetUndoAvailCount() const   { return Stb.undostate.undo_point; }
     int         GetRedoAvailCount() const   { return STB_TEXTEDIT_UNDOSTATECOUNT - Stb.undostate.redo_point; }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
@@ -1249,9 +1398,40 @@ struct ImGuiListClipperData
     int                             StepNo;
     int                             ItemsFrozen;
     ImVector<ImGuiListClipperRange> Ranges;
+    int                             HeightsIdx;         // Variable height mode: index in g.ClipperHeights (-1 otherwise)
+    int                             MeasureItem;        // Variable height mode: item submitted by the previous step, measured by the next one (-1 if none)
+    float                           MeasurePosY;
+    int                             AnchorItem;         // Variable height mode: visible item or item targeted by a scroll request, kept in place when items above it change height (-1 if none)
+    double                          AnchorPos;          // Variable height mode: position of AnchorItem when it was picked
+    float                           AnchorShift;        // Variable height mode: subtracted from LossynessOffset so AnchorItem stays at AnchorPos in this frame while items above it get measured
+    float                           AnchorScrollTargetY;// Variable height mode: window->ScrollTarget.y when AnchorItem was picked, to detect scroll requests made by displayed items
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); HeightsIdx = MeasureItem = AnchorItem = -1; AnchorPos = 0.0; AnchorShift = 0.0f; AnchorScrollTargetY = FLT_MAX; }
+};
+
+// Persistent item heights of a variable height clipper (see ImGuiListClipper::BeginVariableHeight())
+// Prefix sums are stored in Fenwick trees so the position of an item, and the item at a position, are found in O(log n).
+// Items not measured yet count for HeightEstimate, which is why measured heights and measured counts are summed separately.
+struct ImGuiListClipperHeights
+{
+    ImGuiID                         ID;
+    float                           LastTimeActive;     // Last used timestamp, for GC
+    float                           HeightEstimate;     // Height of items not measured yet: average of measured heights, updated after each frame (<= 0.0f until the first item is measured)
+    double                          MeasuredSum;        // Sum of measured heights
+    int                             MeasuredCount;      // Number of measured items
+    int                             TreeMask;           // Highest power of two <= Heights.Size
+    ImVector<float>                 Heights;            // Measured height of each item, < 0.0f if not measured yet
+    ImVector<double>                TreeSums;           // Fenwick tree (1-based) of measured heights
+    ImVector<int>                   TreeCounts;         // Fenwick tree (1-based) of measured items count
+
+    ImGuiListClipperHeights()       { ID = 0; LastTimeActive = -1.0f; HeightEstimate = 0.0f; MeasuredSum = 0.0; MeasuredCount = 0; TreeMask = 0; }
+    void                            Resize(int items_count);
+    void                            Clear();
+    void                            SetHeight(int item_n, float height);
+    float                           GetHeight(int item_n) const { return Heights[item_n] >= 0.0f ? Heights[item_n] : HeightEstimate; }
+    double                          GetItemPos(int item_n) const;       // Sum of the heights of items [0, item_n)
+    int                             FindItemAtPos(double pos) const;    // Item at offset 'pos' from the first item
 };
 
 //-----------------------------------------------------------------------------
@@ -1447,6 +1627,30 @@ struct ImGuiViewportP : public ImGuiViewport
 // [SECTION] Settings support
 //-----------------------------------------------------------------------------
 
+// Text of one settings entry in the last output of SaveIniSettingsToMemory(), so the next save can copy it instead of formatting it again.
+// Handlers reset Size to 0 when the entry data changes. See AppendIniSettingsCache()/UpdateIniSettingsCache().
+struct ImGuiSettingsIniCache
+{
+    int         Offset;         // Offset in g.SettingsIniDataPrev when SaveCount == g.SettingsIniSaveCount - 1
+    int         Size;           // 0: not cached
+    int         SaveCount;      // Value of g.SettingsIniSaveCount when the entry was written
+};
+
+// Array of fixed-size records in the data given to LoadIniSettingsFromBinary(), each starting with its ImGuiID, sorted by ID.
+// Handlers keep one per type to unpack entries on demand (e.g. FindWindowSettings()) instead of on load.
+struct ImGuiSettingsBinaryRecords
+{
+    const char* Data;           // First record
+    int         Count;
+    int         Stride;         // sizeof() of one record
+    const char* Extra;          // Variable-size data following the records (e.g. window names)
+    int         ExtraSize;
+
+    ImGuiSettingsBinaryRecords()    { Clear(); }
+    void        Clear()             { memset(this, 0, sizeof(*this)); }
+    IMGUI_API const void* Find(ImGuiID id) const;
+};
+
 // Windows data saved in imgui.ini file
 // Because we never destroy or rename ImGuiWindowSettings, we can store the names in a separate buffer easily.
 // (this is designed to be stored in a ImChunkStream buffer, with the variable-length Name following our structure)
@@ -1457,11 +1661,23 @@ struct ImGuiWindowSettings
     ImVec2ih    Size;
     bool        Collapsed;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    ImGuiSettingsIniCache IniCache;
 
     ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); }
     char* GetName()             { return (char*)(this + 1); }
 };
 
+// Windows data in binary settings (see SaveIniSettingsToBinary()), names are stored zero-terminated after the records
+struct ImGuiWindowSettingsRecord
+{
+    ImGuiID     ID;
+    ImU32       NameOffset;     // Offset in names
+    ImVec2ih    Pos;
+    ImVec2ih    Size;
+    ImU8        Collapsed;
+    ImU8        Pad[3];
+};
+
 struct ImGuiSettingsHandler
 {
     const char* TypeName;       // Short description stored in .ini file. Disallowed characters: '[' ']'
@@ -1472,6 +1688,8 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*ReadBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const void* data, size_t data_size); // Read: Called with the handler block of binary settings data, NULL if none (optional). 'data' stays valid until the next load.
+    void        (*WriteBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImVector<char>* out_buf);   // Write: Append the handler block of binary settings data to 'out_buf' (optional)
     void*       UserData;
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
@@ -1560,6 +1778,7 @@ struct ImGuiContext
     float                   FontSize;                           // (Shortcut) == FontBaseSize * g.CurrentWindow->FontWindowScale == window->FontSize(). Text height for current window.
     float                   FontBaseSize;                       // (Shortcut) == IO.FontGlobalScale * Font->Scale * Font->FontSize. Base text height.
     ImDrawListSharedData    DrawListSharedData;
+    ImFontGlyphRunCache     GlyphRunCache;                      // Referred to by DrawListSharedData.GlyphRunCache
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
@@ -1721,6 +1940,7 @@ struct ImGuiContext
     // Clipper
     int                             ClipperTempDataStacked;
     ImVector<ImGuiListClipperData>  ClipperTempData;
+    ImPool<ImGuiListClipperHeights> ClipperHeights;             // Persistent item heights of variable height clippers
 
     // Table
     ImGuiTable*                     CurrentTable;
@@ -1769,9 +1989,21 @@ struct ImGuiContext
     bool                    SettingsLoaded;
     float                   SettingsDirtyTimer;                 // Save .ini Settings to memory when time reaches zero
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
+    ImGuiTextBuffer         SettingsIniDataPrev;                // Previous output of SaveIniSettingsToMemory(), unchanged entries are copied from it (see ImGuiSettingsIniCache)
+    int                     SettingsIniSaveCount;               // Incremented by every SaveIniSettingsToMemory() and LoadIniSettingsFromMemory() call
+    ImVector<char>          SettingsIniSaveData;                // Snapshot being written to disk by io.IniSavingAsyncFn(). Owned by the job while SettingsIniSaveBusy != 0.
+    ImVector<char>          SettingsIniSaveFilenames;           // "filename\0filename.tmp\0" for the job
+    volatile int            SettingsIniSaveBusy;                // Set while a job started by SaveIniSettingsToDiskAsync() is running (read/written with atomics)
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiStorage                        SettingsWindowsMap;     // ID -> offset in SettingsWindows (hash indexed)
+    ImGuiStorage                        SettingsTablesMap;      // ID -> offset in SettingsTables (hash indexed)
+    ImGuiSettingsBinaryRecords          SettingsWindowsBinary;  // Windows settings in the data given to LoadIniSettingsFromBinary(), not unpacked yet unless in SettingsWindowsMap
+    ImGuiSettingsBinaryRecords          SettingsTablesBinary;   // Tables settings in the data given to LoadIniSettingsFromBinary(), not unpacked yet unless in SettingsTablesMap
+    const void*                         SettingsBinaryLoadedData; // Last data given to LoadIniSettingsFromBinary()
+    ImVector<char>                      SettingsBinaryData;     // Output of SaveIniSettingsToBinary()
+    ImVector<char>                      SettingsBinaryDataPrev; // Previous output, kept alive when it was loaded back (SettingsBinaryLoadedData)
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -1802,6 +2034,7 @@ struct ImGuiContext
     int                     WantCaptureMouseNextFrame;          // Explicit capture via CaptureKeyboardFromApp()/CaptureMouseFromApp() sets those flags
     int                     WantCaptureKeyboardNextFrame;
     int                     WantTextInputNextFrame;
+    float                   MaxWaitBeforeNextFrame;             // Power saving: requests from SetMaxWaitBeforeNextFrame() (e.g. blinking text cursor) for the current frame, see GetEventWaitingTime()
     char                    TempBuffer[1024 * 3 + 1];           // Temporary text buffer
 
     ImGuiContext(ImFontAtlas* shared_font_atlas)
@@ -1811,6 +2044,7 @@ struct ImGuiContext
         Font = NULL;
         FontSize = FontBaseSize = 0.0f;
         IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
+        DrawListSharedData.GlyphRunCache = &GlyphRunCache;
         Time = 0.0f;
         FrameCount = 0;
         FrameCountEnded = FrameCountRendered = -1;
@@ -1932,6 +2166,11 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsIniSaveCount = 0;
+        SettingsIniSaveBusy = 0;
+        SettingsWindowsMap.SetUseHashIndex(true);
+        SettingsTablesMap.SetUseHashIndex(true);
+        SettingsBinaryLoadedData = NULL;
         HookIdNext = 0;
 
         LogEnabled = false;
@@ -1950,6 +2189,7 @@ struct ImGuiContext
         FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
+        MaxWaitBeforeNextFrame = FLT_MAX;
         memset(TempBuffer, 0, sizeof(TempBuffer));
     }
 };
@@ -2088,6 +2328,11 @@ struct IMGUI_API ImGuiWindow
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImDrawList*             DrawListCache;                      // With ImGuiWindowFlags_CacheDrawList: output of the last frame which emitted geometry, rendered in place of DrawList
+    ImU32                   DrawListCacheHash;                  // With ImGuiWindowFlags_CacheDrawList: content hash of DrawListCache
+    bool                    DrawListCacheStable;                // With ImGuiWindowFlags_CacheDrawList: last two frames which emitted geometry had the same hash, next frame skips geometry
+    bool                    DrawListCacheSkipping;              // With ImGuiWindowFlags_CacheDrawList: geometry is not emitted this frame
+    int                     DrawListCacheGlyphDataVersion;      // With ImGuiWindowFlags_CacheDrawList: value of ImFontAtlas::GlyphDataVersion when geometry was last emitted
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup _or_ docked window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            ParentWindowInBeginStack;
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window. Doesn't cross through popups/dock nodes.
@@ -2211,14 +2456,14 @@ struct IMGUI_API ImGuiTabBar
 //-----------------------------------------------------------------------------
 
 #define IM_COL32_DISABLE                IM_COL32(0,0,0,1)   // Special sentinel code which cannot be used as a regular color.
-#define IMGUI_TABLE_MAX_COLUMNS         64                  // sizeof(ImU64) * 8. This is solely because we frequently encode columns set in a ImU64.
-#define IMGUI_TABLE_MAX_DRAW_CHANNELS   (4 + 64 * 2)        // See TableSetupDrawChannels()
+#define IMGUI_TABLE_MAX_COLUMNS         512                 // May be further lifted
+#define IMGUI_TABLE_MAX_DRAW_CHANNELS   (4 + IMGUI_TABLE_MAX_COLUMNS * 2)   // See TableSetupDrawChannels()
 
-// Our current column maximum is 64 but we may raise that in the future.
-typedef ImS8 ImGuiTableColumnIdx;
-typedef ImU8 ImGuiTableDrawChannelIdx;
+// Our current column maximum is 512 but we may raise that in the future.
+typedef ImS16 ImGuiTableColumnIdx;
+typedef ImU16 ImGuiTableDrawChannelIdx;
 
-// [Internal] sizeof() ~ 104
+// [Internal] sizeof() ~ 112
 // We use the terminology "Enabled" to refer to a column that is not Hidden by user/api.
 // We use the terminology "Clipped" to refer to a column that is out of sight because of scrolling/clipping.
 // This is in contrast with some user-facing api such as IsItemVisible() / IsRectVisible() which use "Visible" to mean "not clipped".
@@ -2275,12 +2520,12 @@ struct ImGuiTableColumn
         PrevEnabledColumn = NextEnabledColumn = -1;
         SortOrder = -1;
         SortDirection = ImGuiSortDirection_None;
-        DrawChannelCurrent = DrawChannelFrozen = DrawChannelUnfrozen = (ImU8)-1;
+        DrawChannelCurrent = DrawChannelFrozen = DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)-1;
     }
 };
 
 // Transient cell data stored per row.
-// sizeof() ~ 6
+// sizeof() ~ 8
 struct ImGuiTableCellData
 {
     ImU32                       BgColor;    // Actual color
@@ -2292,15 +2537,15 @@ struct IMGUI_API ImGuiTable
 {
     ImGuiID                     ID;
     ImGuiTableFlags             Flags;
-    void*                       RawData;                    // Single allocation to hold Columns[], DisplayOrderToIndex[] and RowCellData[]
+    void*                       RawData;                    // Single allocation to hold Columns[], DisplayOrderToIndex[], RowCellData[] and the column masks
     ImGuiTableTempData*         TempData;                   // Transient data while table is active. Point within g.CurrentTableStack[]
     ImSpan<ImGuiTableColumn>    Columns;                    // Point within RawData[]
     ImSpan<ImGuiTableColumnIdx> DisplayOrderToIndex;        // Point within RawData[]. Store display order of columns (when not reordered, the values are 0...Count-1)
     ImSpan<ImGuiTableCellData>  RowCellData;                // Point within RawData[]. Store cells background requests for current row.
-    ImU64                       EnabledMaskByDisplayOrder;  // Column DisplayOrder -> IsEnabled map
-    ImU64                       EnabledMaskByIndex;         // Column Index -> IsEnabled map (== not hidden by user/api) in a format adequate for iterating column without touching cold data
-    ImU64                       VisibleMaskByIndex;         // Column Index -> IsVisibleX|IsVisibleY map (== not hidden by user/api && not hidden by scrolling/cliprect)
-    ImU64                       RequestOutputMaskByIndex;   // Column Index -> IsVisible || AutoFit (== expect user to submit items)
+    ImBitArrayPtr               EnabledMaskByDisplayOrder;  // Point within RawData[]. Column DisplayOrder -> IsEnabled map
+    ImBitArrayPtr               EnabledMaskByIndex;         // Point within RawData[]. Column Index -> IsEnabled map (== not hidden by user/api) in a format adequate for iterating column without touching cold data
+    ImBitArrayPtr               VisibleMaskByIndex;         // Point within RawData[]. Column Index -> IsVisibleX|IsVisibleY map (== not hidden by user/api && not hidden by scrolling/cliprect)
+    ImBitArrayPtr               RequestOutputMaskByIndex;   // Point within RawData[]. Column Index -> IsVisible || AutoFit (== expect user to submit items)
     ImGuiTableFlags             SettingsLoadedFlags;        // Which data were loaded from the .ini file (e.g. when order is not altered we won't save order)
     int                         SettingsOffset;             // Offset in g.SettingsTables
     int                         LastFrameActive;
@@ -2378,6 +2623,18 @@ struct IMGUI_API ImGuiTable
     ImGuiTableDrawChannelIdx    DummyDrawChannel;           // Redirect non-visible columns here.
     ImGuiTableDrawChannelIdx    Bg2DrawChannelCurrent;      // For Selectable() and other widgets drawing across columns after the freezing line. Index within DrawSplitter.Channels[]
     ImGuiTableDrawChannelIdx    Bg2DrawChannelUnfrozen;
+    ImGuiID                     LayoutWidthsKey;            // Hash of the table-wide inputs of column widths at the time of the last full TableUpdateLayout()
+    ImGuiID                     LayoutPositionsKey;         // Hash of the table-wide inputs of column positions (origin, clipping, freezing) from the last TableUpdateLayout()
+    ImGuiID                     HeaderRowHeightKey;         // Hash of the inputs of HeaderRowHeight (font, padding, names), 0 when invalidated
+    float                       HeaderRowHeight;            // Cached result of TableGetHeaderRowHeight()
+    float                       PerfLayoutTime;             // Time spent in TableUpdateLayout() by all instances during the current frame (in ms)
+    float                       PerfEndTime;                // Time spent in EndTable() by all instances during the current frame (in ms)
+    float                       PerfLastLayoutTime;         // PerfLayoutTime from the last frame the table was active
+    float                       PerfLastEndTime;            // PerfEndTime from the last frame the table was active
+    int                         PerfLayoutFullCount;        // Number of TableUpdateLayout() calls recomputing column widths
+    int                         PerfLayoutCachedCount;      // Number of TableUpdateLayout() calls reusing column widths from the previous call
+    bool                        IsLayoutDirty;              // Set when column widths need to be recomputed (setup, resize, reorder, visibility, settings changes)
+    bool                        IsLayoutCacheable;          // Set by TableUpdateLayout() when column widths don't depend on contents (no auto-fitting column)
     bool                        IsLayoutLocked;             // Set by TableUpdateLayout() which is called when beginning the first row.
     bool                        IsInsideRow;                // Set when inside TableBeginRow()/TableEndRow().
     bool                        IsInitializing;
@@ -2454,11 +2711,35 @@ struct ImGuiTableSettings
     ImGuiTableColumnIdx         ColumnsCount;
     ImGuiTableColumnIdx         ColumnsCountMax;        // Maximum number of columns this settings instance can store, we can recycle a settings instance with lower number of columns but not higher
     bool                        WantApply;              // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    ImGuiSettingsIniCache       IniCache;               // Reset by TableSaveSettings()
 
     ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); }
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
 };
 
+// Tables data in binary settings (see SaveIniSettingsToBinary()), columns are stored after the records.
+// Fixed-width fields and explicit padding: records are written as is, so every byte must be initialized.
+struct ImGuiTableSettingsRecord
+{
+    ImU32                       ID;
+    ImS32                       SaveFlags;              // ImGuiTableFlags
+    float                       RefScale;
+    ImU32                       ColumnsOffset;          // Index of the first column record
+    ImS16                       ColumnsCount;
+    ImU8                        Pad[2];
+};
+
+struct ImGuiTableColumnSettingsRecord
+{
+    float                       WidthOrWeight;
+    ImU32                       UserID;
+    ImS16                       Index;
+    ImS16                       DisplayOrder;
+    ImS16                       SortOrder;
+    ImU8                        Flags;                  // SortDirection in bits 0-1, IsEnabled in bit 2, IsStretch in bit 3
+    ImU8                        Pad;
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGui internal API
 // No guarantee of forward compatibility here!
@@ -2529,6 +2810,12 @@ namespace ImGui
     IMGUI_API ImGuiWindowSettings*  FindWindowSettings(ImGuiID id);
     IMGUI_API ImGuiWindowSettings*  FindOrCreateWindowSettings(const char* name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
+    IMGUI_API bool                  SaveIniSettingsToDiskAsync(const char* ini_filename);   // Serialize then hand the file write to io.IniSavingAsyncFn(). Return false if the previous save is still being written.
+    IMGUI_API bool                  AppendIniSettingsCache(ImGuiSettingsIniCache* cache, ImGuiTextBuffer* buf);                 // Copy the entry text written by the previous save, return false if it needs to be formatted again
+    IMGUI_API void                  UpdateIniSettingsCache(ImGuiSettingsIniCache* cache, ImGuiTextBuffer* buf, int entry_begin); // Record the entry text just written from 'entry_begin'
+    IMGUI_API bool                  BeginBinarySettingsRecords(ImGuiSettingsBinaryRecords* records, const void* data, size_t data_size, int stride); // Validate and reference a handler block written by AppendBinarySettingsRecords()
+    IMGUI_API int                   AppendBinarySettingsRecords(ImVector<char>* buf, int count, int stride, int extra_size); // Append an uninitialized handler block, return offset of the first record. Sort with SortBinarySettingsRecords() after filling.
+    IMGUI_API void                  SortBinarySettingsRecords(ImVector<char>* buf, int records_offset, int count, int stride);
 
     // Scrolling
     IMGUI_API void          SetNextWindowScroll(const ImVec2& scroll); // Use -1.0f on one axis to leave as-is
@@ -2834,6 +3121,7 @@ namespace ImGui
 
     // Plot
     IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size);
+    IMGUI_API int           PlotBufferEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -2874,6 +3162,11 @@ namespace ImGui
 // [SECTION] ImFontAtlas internal API
 //-----------------------------------------------------------------------------
 
+// Special values of ImFont::IndexLookup[] (valid glyph indices are below them):
+// - (ImWchar)-1: no glyph. With ImFontAtlasFlags_DynamicGlyphs: not rasterized yet, the next FindGlyph() call requests it.
+// - IM_FONTGLYPH_INDEX_PENDING: no glyph, already requested or missing from the font. FindGlyph() doesn't request it again.
+#define IM_FONTGLYPH_INDEX_PENDING  ((ImWchar)-2)
+
 // This structure is likely to evolve as we add support for incremental atlas updates
 struct ImFontBuilderIO
 {
@@ -2892,6 +3185,13 @@ IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas,
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
+IMGUI_API void      ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas);
+IMGUI_API void      ImFontAtlasDestroyDynamicGlyphs(ImFontAtlas* atlas);
+IMGUI_API const ImFontGlyph* ImFontFindDynamicGlyph(const ImFont* font, ImWchar c);
+IMGUI_API bool      ImFontAtlasHasPendingDynamicGlyphs(const ImFontAtlas* atlas);
+IMGUI_API ImU32     ImFontAtlasBuildCalcCacheKey(ImFontAtlas* atlas);
+IMGUI_API bool      ImFontAtlasBuildLoadCacheFile(ImFontAtlas* atlas, const char* filename, ImU32 key);
+IMGUI_API bool      ImFontAtlasBuildSaveCacheFile(ImFontAtlas* atlas, const char* filename, ImU32 key);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
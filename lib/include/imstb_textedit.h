@@ -171,6 +171,11 @@
 //    STB_TEXTEDIT_K_LINEEND2            secondary keyboard input to move cursor to end of line
 //    STB_TEXTEDIT_K_TEXTSTART2          secondary keyboard input to move cursor to start of text
 //    STB_TEXTEDIT_K_TEXTEND2            secondary keyboard input to move cursor to end of text
+//    STB_TEXTEDIT_GETROWINDEX(obj,i)    [DEAR IMGUI] returns the row containing character #i
+//    STB_TEXTEDIT_GETROWSTART(obj,r)    [DEAR IMGUI] returns the first character of row #r (or the length of
+//                                          the string if past the last row). when both are defined, rows
+//                                          are located without laying out the rows above them, which
+//                                          requires every row to have the same baseline_y_delta.
 //
 // Keyboard input must be encoded as a single integer value; e.g. a character code
 // and some bitflags that represent shift states. to simplify the interface, SHIFT must
@@ -399,13 +404,32 @@ static int stb_text_locate_coord(STB_TEXTEDIT_STRING *str, float x, float y)
 {
    StbTexteditRow r;
    int n = STB_TEXTEDIT_STRINGLEN(str);
-   float base_y = 0, prev_x;
+   float prev_x;
    int i=0, k;
 
    r.x0 = r.x1 = 0;
    r.ymin = r.ymax = 0;
    r.num_chars = 0;
 
+#ifdef STB_TEXTEDIT_GETROWSTART
+   // [DEAR IMGUI]
+   // jump straight to the row straddling 'y'
+   if (n > 0) {
+      STB_TEXTEDIT_LAYOUTROW(&r, str, 0);
+      if (y < r.ymin)
+         return 0;
+      if (y >= r.ymax && r.baseline_y_delta > 0) {
+         int row = (int)((y - r.ymax) / r.baseline_y_delta) + 1;
+         i = STB_TEXTEDIT_GETROWSTART(str, row);
+         if (i >= n)
+            return n;
+         STB_TEXTEDIT_LAYOUTROW(&r, str, i);
+      }
+      if (r.num_chars <= 0)
+         return n;
+   }
+#else
+   float base_y = 0;
    // search rows to find one that straddles 'y'
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -421,6 +445,7 @@ static int stb_text_locate_coord(STB_TEXTEDIT_STRING *str, float x, float y)
       i += r.num_chars;
       base_y += r.baseline_y_delta;
    }
+#endif
 
    // below all text, return 'after' last character
    if (i >= n)
@@ -536,11 +561,18 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
          find->y = 0;
          find->x = 0;
          find->height = 1;
+#ifdef STB_TEXTEDIT_GETROWSTART
+         // [DEAR IMGUI]
+         if (z > 0)
+            prev_start = STB_TEXTEDIT_GETROWSTART(str, STB_TEXTEDIT_GETROWINDEX(str, z - 1));
+         i = z;
+#else
          while (i < z) {
             STB_TEXTEDIT_LAYOUTROW(&r, str, i);
             prev_start = i;
             i += r.num_chars;
          }
+#endif
          find->first_char = i;
          find->length = 0;
          find->prev_first = prev_start;
@@ -551,6 +583,17 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
    // search rows to find the one that straddles character n
    find->y = 0;
 
+#ifdef STB_TEXTEDIT_GETROWSTART
+   // [DEAR IMGUI]
+   {
+      int row = STB_TEXTEDIT_GETROWINDEX(str, n);
+      i = STB_TEXTEDIT_GETROWSTART(str, row);
+      if (row > 0)
+         prev_start = STB_TEXTEDIT_GETROWSTART(str, row - 1);
+      STB_TEXTEDIT_LAYOUTROW(&r, str, i);
+      find->y = row * r.baseline_y_delta;
+   }
+#else
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
       if (n < i + r.num_chars)
@@ -559,6 +602,7 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
       i += r.num_chars;
       find->y += r.baseline_y_delta;
    }
+#endif
 
    find->first_char = first = i;
    find->length = r.num_chars;
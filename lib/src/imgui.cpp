@@ -823,6 +823,12 @@ CODE
 #else
 #include <stdint.h>     // intptr_t
 #endif
+#if defined(_MSC_VER)
+#include <intrin.h>     // __cpuid
+#endif
+#if !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+#include <time.h>       // clock_gettime, nanosleep
+#endif
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -930,6 +936,9 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static void             WindowSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, const void* data, size_t data_size);
+static void             WindowSettingsHandler_WriteBinary(ImGuiContext*, ImGuiSettingsHandler*, ImVector<char>* buf);
+static void             WaitIniSettingsSaveJob(ImGuiContext* ctx);
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data);
@@ -1148,6 +1157,8 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigDrawListCacheVerify = false;
+    ConfigGlyphRunCacheBudget = 0;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1703,8 +1714,7 @@ static const ImU32 GCrc32LookupTable[256] =
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
-ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
+ImGuiID ImHashDataCrc32(const void* data_p, size_t data_size, ImU32 seed)
 {
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
@@ -1719,8 +1729,7 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
-ImGuiID ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
+ImGuiID ImHashStrCrc32(const char* data_p, size_t data_size, ImU32 seed)
 {
     seed = ~seed;
     ImU32 crc = seed;
@@ -1748,6 +1757,170 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
     return ~crc;
 }
 
+// CRC32C (Castagnoli polynomial) lookup table, used when SSE4.2 is not available. Both paths output the same values.
+static const ImU32 GCrc32cLookupTable[256] =
+{
+    0x00000000,0xF26B8303,0xE13B70F7,0x1350F3F4,0xC79A971F,0x35F1141C,0x26A1E7E8,0xD4CA64EB,0x8AD958CF,0x78B2DBCC,0x6BE22838,0x9989AB3B,0x4D43CFD0,0xBF284CD3,0xAC78BF27,0x5E133C24,
+    0x105EC76F,0xE235446C,0xF165B798,0x030E349B,0xD7C45070,0x25AFD373,0x36FF2087,0xC494A384,0x9A879FA0,0x68EC1CA3,0x7BBCEF57,0x89D76C54,0x5D1D08BF,0xAF768BBC,0xBC267848,0x4E4DFB4B,
+    0x20BD8EDE,0xD2D60DDD,0xC186FE29,0x33ED7D2A,0xE72719C1,0x154C9AC2,0x061C6936,0xF477EA35,0xAA64D611,0x580F5512,0x4B5FA6E6,0xB93425E5,0x6DFE410E,0x9F95C20D,0x8CC531F9,0x7EAEB2FA,
+    0x30E349B1,0xC288CAB2,0xD1D83946,0x23B3BA45,0xF779DEAE,0x05125DAD,0x1642AE59,0xE4292D5A,0xBA3A117E,0x4851927D,0x5B016189,0xA96AE28A,0x7DA08661,0x8FCB0562,0x9C9BF696,0x6EF07595,
+    0x417B1DBC,0xB3109EBF,0xA0406D4B,0x522BEE48,0x86E18AA3,0x748A09A0,0x67DAFA54,0x95B17957,0xCBA24573,0x39C9C670,0x2A993584,0xD8F2B687,0x0C38D26C,0xFE53516F,0xED03A29B,0x1F682198,
+    0x5125DAD3,0xA34E59D0,0xB01EAA24,0x42752927,0x96BF4DCC,0x64D4CECF,0x77843D3B,0x85EFBE38,0xDBFC821C,0x2997011F,0x3AC7F2EB,0xC8AC71E8,0x1C661503,0xEE0D9600,0xFD5D65F4,0x0F36E6F7,
+    0x61C69362,0x93AD1061,0x80FDE395,0x72966096,0xA65C047D,0x5437877E,0x4767748A,0xB50CF789,0xEB1FCBAD,0x197448AE,0x0A24BB5A,0xF84F3859,0x2C855CB2,0xDEEEDFB1,0xCDBE2C45,0x3FD5AF46,
+    0x7198540D,0x83F3D70E,0x90A324FA,0x62C8A7F9,0xB602C312,0x44694011,0x5739B3E5,0xA55230E6,0xFB410CC2,0x092A8FC1,0x1A7A7C35,0xE811FF36,0x3CDB9BDD,0xCEB018DE,0xDDE0EB2A,0x2F8B6829,
+    0x82F63B78,0x709DB87B,0x63CD4B8F,0x91A6C88C,0x456CAC67,0xB7072F64,0xA457DC90,0x563C5F93,0x082F63B7,0xFA44E0B4,0xE9141340,0x1B7F9043,0xCFB5F4A8,0x3DDE77AB,0x2E8E845F,0xDCE5075C,
+    0x92A8FC17,0x60C37F14,0x73938CE0,0x81F80FE3,0x55326B08,0xA759E80B,0xB4091BFF,0x466298FC,0x1871A4D8,0xEA1A27DB,0xF94AD42F,0x0B21572C,0xDFEB33C7,0x2D80B0C4,0x3ED04330,0xCCBBC033,
+    0xA24BB5A6,0x502036A5,0x4370C551,0xB11B4652,0x65D122B9,0x97BAA1BA,0x84EA524E,0x7681D14D,0x2892ED69,0xDAF96E6A,0xC9A99D9E,0x3BC21E9D,0xEF087A76,0x1D63F975,0x0E330A81,0xFC588982,
+    0xB21572C9,0x407EF1CA,0x532E023E,0xA145813D,0x758FE5D6,0x87E466D5,0x94B49521,0x66DF1622,0x38CC2A06,0xCAA7A905,0xD9F75AF1,0x2B9CD9F2,0xFF56BD19,0x0D3D3E1A,0x1E6DCDEE,0xEC064EED,
+    0xC38D26C4,0x31E6A5C7,0x22B65633,0xD0DDD530,0x0417B1DB,0xF67C32D8,0xE52CC12C,0x1747422F,0x49547E0B,0xBB3FFD08,0xA86F0EFC,0x5A048DFF,0x8ECEE914,0x7CA56A17,0x6FF599E3,0x9D9E1AE0,
+    0xD3D3E1AB,0x21B862A8,0x32E8915C,0xC083125F,0x144976B4,0xE622F5B7,0xF5720643,0x07198540,0x590AB964,0xAB613A67,0xB831C993,0x4A5A4A90,0x9E902E7B,0x6CFBAD78,0x7FAB5E8C,0x8DC0DD8F,
+    0xE330A81A,0x115B2B19,0x020BD8ED,0xF0605BEE,0x24AA3F05,0xD6C1BC06,0xC5914FF2,0x37FACCF1,0x69E9F0D5,0x9B8273D6,0x88D28022,0x7AB90321,0xAE7367CA,0x5C18E4C9,0x4F48173D,0xBD23943E,
+    0xF36E6F75,0x0105EC76,0x12551F82,0xE03E9C81,0x34F4F86A,0xC69F7B69,0xD5CF889D,0x27A40B9E,0x79B737BA,0x8BDCB4B9,0x988C474D,0x6AE7C44E,0xBE2DA0A5,0x4C4623A6,0x5F16D052,0xAD7D5351,
+};
+
+// Hardware CRC32C: compiled when the compiler can target SSE4.2, used if the CPU supports it (checked at runtime unless it is always enabled at compile time).
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE4_2__) || defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define IMGUI_ENABLE_SSE42_CRC32C
+#if !defined(__SSE4_2__) && (defined(__GNUC__) || defined(__clang__))
+#define IM_TARGET_SSE42 __attribute__((target("sse4.2")))
+#else
+#define IM_TARGET_SSE42
+#endif
+
+static bool ImHashCrc32cHasSSE42()
+{
+#ifdef __SSE4_2__
+    return true;
+#else
+    static int has_sse42 = -1; // Benign race: every thread would write the same value
+    if (has_sse42 < 0)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 1);
+        has_sse42 = (info[2] & (1 << 20)) ? 1 : 0;
+#else
+        __builtin_cpu_init(); // We may be called from static constructors, before libgcc initialized its CPU model
+        has_sse42 = __builtin_cpu_supports("sse4.2") ? 1 : 0;
+#endif
+    }
+    return has_sse42 != 0;
+#endif
+}
+
+IM_TARGET_SSE42 static ImU32 ImHashCrc32cSSE42(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    ImU64 crc64 = crc;
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc64 = _mm_crc32_u64(crc64, v);
+    }
+    crc = (ImU32)crc64;
+#endif
+    for (; data_size >= 4; data += 4, data_size -= 4)
+    {
+        ImU32 v;
+        memcpy(&v, data, 4);
+        crc = _mm_crc32_u32(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = _mm_crc32_u8(crc, *data++);
+    return crc;
+}
+#endif
+
+static ImU32 ImHashCrc32c(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+#ifdef IMGUI_ENABLE_SSE42_CRC32C
+    if (ImHashCrc32cHasSSE42())
+        return ImHashCrc32cSSE42(crc, data, data_size);
+#endif
+    const ImU32* crc32c_lut = GCrc32cLookupTable;
+    while (data_size-- != 0)
+        crc = (crc >> 8) ^ crc32c_lut[(crc & 0xFF) ^ *data++];
+    return crc;
+}
+
+// Same ### semantic as ImHashStrCrc32() for backends that don't process one byte at a time: hash from the start of the last ###.
+// Returns the start of the part to hash and outputs the end of the string.
+static const char* ImHashStrFindStart(const char* data, size_t data_size, const char** out_data_end)
+{
+    const char* data_end = data + (data_size ? data_size : strlen(data));
+    const char* start = data;
+    for (const char* p = data; (p = (const char*)memchr(p, '#', (size_t)(data_end - p))) != NULL && data_end - p >= 3; p++)
+        if (p[1] == '#' && p[2] == '#')
+            start = p;
+    *out_data_end = data_end;
+    return start;
+}
+
+ImGuiID ImHashDataCrc32c(const void* data_p, size_t data_size, ImU32 seed)
+{
+    return ~ImHashCrc32c(~seed, (const unsigned char*)data_p, data_size);
+}
+
+ImGuiID ImHashStrCrc32c(const char* data_p, size_t data_size, ImU32 seed)
+{
+    const char* data_end;
+    const char* data = ImHashStrFindStart(data_p, data_size, &data_end);
+    return ~ImHashCrc32c(~seed, (const unsigned char*)data, (size_t)(data_end - data));
+}
+
+// 64-bit multiply/rotate rounds over 8 bytes at a time and the xxHash64 final avalanche, truncated to 32-bit.
+// Reads native-endian words: IDs differ between little and big-endian machines (unlike CRC32/CRC32C).
+static inline ImU64 ImHashMix64Round(ImU64 acc, ImU64 v)
+{
+    acc += v * 0xC2B2AE3D27D4EB4FULL;
+    acc = (acc << 31) | (acc >> 33);
+    return acc * 0x9E3779B185EBCA87ULL;
+}
+
+ImGuiID ImHashDataMix64(const void* data_p, size_t data_size, ImU32 seed)
+{
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU64 h = ((ImU64)seed * 0x9E3779B185EBCA87ULL) ^ ((ImU64)data_size * 0x27D4EB2F165667C5ULL);
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        h = ImHashMix64Round(h, v);
+    }
+    if (data_size > 0)
+    {
+        ImU64 v = 0;
+        memcpy(&v, data, data_size);
+        h = ImHashMix64Round(h, v);
+    }
+    h ^= h >> 33;
+    h *= 0xC2B2AE3D27D4EB4FULL;
+    h ^= h >> 29;
+    h *= 0x165667B19E3779F9ULL;
+    h ^= h >> 32;
+    return (ImGuiID)h;
+}
+
+ImGuiID ImHashStrMix64(const char* data_p, size_t data_size, ImU32 seed)
+{
+    const char* data_end;
+    const char* data = ImHashStrFindStart(data_p, data_size, &data_end);
+    return ImHashDataMix64(data, (size_t)(data_end - data), seed);
+}
+
+// Backend selected in imconfig.h. CRC32 is the default and gives the same IDs as previous versions.
+#if defined(IMGUI_USE_HASH_CRC32C)
+ImGuiID ImHashData(const void* data, size_t data_size, ImU32 seed)  { return ImHashDataCrc32c(data, data_size, seed); }
+ImGuiID ImHashStr(const char* data, size_t data_size, ImU32 seed)   { return ImHashStrCrc32c(data, data_size, seed); }
+#elif defined(IMGUI_USE_HASH_MIX64)
+ImGuiID ImHashData(const void* data, size_t data_size, ImU32 seed)  { return ImHashDataMix64(data, data_size, seed); }
+ImGuiID ImHashStr(const char* data, size_t data_size, ImU32 seed)   { return ImHashStrMix64(data, data_size, seed); }
+#else
+ImGuiID ImHashData(const void* data, size_t data_size, ImU32 seed)  { return ImHashDataCrc32(data, data_size, seed); }
+ImGuiID ImHashStr(const char* data, size_t data_size, ImU32 seed)   { return ImHashStrCrc32(data, data_size, seed); }
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -1777,6 +1950,28 @@ bool    ImFileClose(ImFileHandle f)     { return fclose(f) == 0; }
 ImU64   ImFileGetSize(ImFileHandle f)   { long off = 0, sz = 0; return ((off = ftell(f)) != -1 && !fseek(f, 0, SEEK_END) && (sz = ftell(f)) != -1 && !fseek(f, off, SEEK_SET)) ? (ImU64)sz : (ImU64)-1; }
 ImU64   ImFileRead(void* data, ImU64 sz, ImU64 count, ImFileHandle f)           { return fread(data, (size_t)sz, (size_t)count, f); }
 ImU64   ImFileWrite(const void* data, ImU64 sz, ImU64 count, ImFileHandle f)    { return fwrite(data, (size_t)sz, (size_t)count, f); }
+
+// MoveFileEx() with MOVEFILE_REPLACE_EXISTING replaces the destination in one step on every Windows compiler, rename() would fail if it exists.
+// Filenames are converted from UTF-8 under the same conditions as ImFileOpen(), otherwise passed as is like to fopen().
+bool ImFileRename(const char* src_filename, const char* dst_filename)
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(__CYGWIN__) && !defined(__GNUC__)
+    const int src_wsize = ::MultiByteToWideChar(CP_UTF8, 0, src_filename, -1, NULL, 0);
+    const int dst_wsize = ::MultiByteToWideChar(CP_UTF8, 0, dst_filename, -1, NULL, 0);
+    ImVector<wchar_t> buf;
+    buf.resize(src_wsize + dst_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, src_filename, -1, &buf[0], src_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, dst_filename, -1, &buf[src_wsize], dst_wsize);
+    return ::MoveFileExW(&buf[0], &buf[src_wsize], MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#elif defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    return ::MoveFileExA(src_filename, dst_filename, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#elif defined(_WIN32)
+    remove(dst_filename); // Not atomic: only without Win32 functions
+    return rename(src_filename, dst_filename) == 0;
+#else
+    return rename(src_filename, dst_filename) == 0; // Atomic on POSIX
+#endif
+}
 #endif // #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 
 // Helper: Load file content into memory
@@ -1821,6 +2016,37 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+// Helper: Monotonic high resolution clock, for the profiling counters displayed in Metrics/Debugger.
+// Return 0.0 when no such clock is available (counters will read zero).
+double ImGetTimeSeconds()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    LARGE_INTEGER frequency, counter;
+    ::QueryPerformanceFrequency(&frequency);
+    ::QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#elif !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#else
+    return 0.0;
+#endif
+}
+
+// Helper: Sleep, to wait for background jobs without spinning.
+void ImSleepMilliseconds(int ms)
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    ::Sleep((DWORD)ms);
+#elif !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+    struct timespec ts = { ms / 1000, (long)(ms % 1000) * 1000000 };
+    nanosleep(&ts, NULL);
+#else
+    IM_UNUSED(ms);
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2114,6 +2340,83 @@ static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiSt
     return first;
 }
 
+// Hash index: open-addressing with linear probing, slots store (index into Data + 1). Kept at most half full.
+// Keys are already hashes but PushID(int) ones are poorly distributed in low bits, so mix them before masking.
+static inline ImU32 StorageHashSlot(ImGuiID key, ImU32 mask)
+{
+    ImU32 h = key * 0x9E3779B1u;
+    return (h ^ (h >> 16)) & mask;
+}
+
+static void StorageBuildHashIndex(ImGuiStorage* storage)
+{
+    int index_size = 16;
+    while (index_size < storage->Data.Size * 2)
+        index_size <<= 1;
+    storage->HashIndex.resize(index_size);
+    memset(storage->HashIndex.Data, 0, (size_t)storage->HashIndex.size_in_bytes());
+    const ImU32 mask = (ImU32)index_size - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        ImU32 slot = StorageHashSlot(storage->Data.Data[n].key, mask);
+        while (storage->HashIndex.Data[slot] != 0)
+            slot = (slot + 1) & mask;
+        storage->HashIndex.Data[slot] = n + 1;
+    }
+}
+
+// Return the pair for 'key' or NULL
+static ImGuiStorage::ImGuiStoragePair* StorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->UseHashIndex)
+    {
+        const ImVector<int>& index = storage->HashIndex;
+        if (index.Size == 0)
+            return NULL;
+        const ImU32 mask = (ImU32)index.Size - 1;
+        for (ImU32 slot = StorageHashSlot(key, mask); index.Data[slot] != 0; slot = (slot + 1) & mask)
+        {
+            ImGuiStorage::ImGuiStoragePair* it = &storage->Data.Data[index.Data[slot] - 1];
+            if (it->key == key)
+                return it;
+        }
+        return NULL;
+    }
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStorage::ImGuiStoragePair>&>(storage->Data), key);
+    if (it == storage->Data.end() || it->key != key)
+        return NULL;
+    return it;
+}
+
+// Return the pair for 'new_pair.key', adding 'new_pair' if missing
+static ImGuiStorage::ImGuiStoragePair* StorageFindOrAdd(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& new_pair)
+{
+    if (storage->UseHashIndex)
+    {
+        if (storage->HashIndex.Size == 0)
+            StorageBuildHashIndex(storage);
+        ImVector<int>& index = storage->HashIndex;
+        const ImU32 mask = (ImU32)index.Size - 1;
+        ImU32 slot = StorageHashSlot(new_pair.key, mask);
+        for (; index.Data[slot] != 0; slot = (slot + 1) & mask)
+        {
+            ImGuiStorage::ImGuiStoragePair* it = &storage->Data.Data[index.Data[slot] - 1];
+            if (it->key == new_pair.key)
+                return it;
+        }
+        storage->Data.push_back(new_pair);
+        if (storage->Data.Size * 2 > index.Size)
+            StorageBuildHashIndex(storage);
+        else
+            index.Data[slot] = storage->Data.Size;
+        return &storage->Data.back();
+    }
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(storage->Data, new_pair.key);
+    if (it == storage->Data.end() || it->key != new_pair.key)
+        it = storage->Data.insert(it, new_pair);
+    return it;
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -2128,14 +2431,30 @@ void ImGuiStorage::BuildSortByKey()
         }
     };
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairComparerByID);
+    if (UseHashIndex)
+        StorageBuildHashIndex(this);
+}
+
+void ImGuiStorage::SetUseHashIndex(bool enable)
+{
+    if (UseHashIndex == enable)
+        return;
+    UseHashIndex = enable;
+    if (enable)
+    {
+        StorageBuildHashIndex(this);
+    }
+    else
+    {
+        HashIndex.clear();
+        BuildSortByKey();
+    }
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2145,27 +2464,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &StorageFindOrAdd(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2175,30 +2487,17 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &StorageFindOrAdd(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &StorageFindOrAdd(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
-// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_i = val;
+    StorageFindOrAdd(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2208,24 +2507,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_f = val;
+    StorageFindOrAdd(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_p = val;
+    StorageFindOrAdd(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2467,6 +2754,103 @@ void ImGui::CalcListClipping(int items_count, float items_height, int* out_items
 }
 #endif
 
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    if (items_count == Heights.Size)
+        return;
+    Heights.resize(items_count, -1.0f);
+    TreeSums.resize(items_count + 1);
+    TreeCounts.resize(items_count + 1);
+    for (TreeMask = 1; TreeMask * 2 <= items_count; TreeMask *= 2) {}
+
+    // Rebuild the trees in O(n): every node adds itself to its parent
+    TreeSums[0] = 0.0;
+    TreeCounts[0] = 0;
+    MeasuredSum = 0.0;
+    MeasuredCount = 0;
+    for (int i = 1; i <= items_count; i++)
+    {
+        const float height = Heights[i - 1];
+        TreeSums[i] = (height >= 0.0f) ? height : 0.0;
+        TreeCounts[i] = (height >= 0.0f) ? 1 : 0;
+        MeasuredSum += TreeSums[i];
+        MeasuredCount += TreeCounts[i];
+    }
+    for (int i = 1; i <= items_count; i++)
+    {
+        const int parent = i + (i & -i);
+        if (parent <= items_count)
+        {
+            TreeSums[parent] += TreeSums[i];
+            TreeCounts[parent] += TreeCounts[i];
+        }
+    }
+}
+
+void ImGuiListClipperHeights::Clear()
+{
+    for (int n = 0; n < Heights.Size; n++)
+        Heights[n] = -1.0f;
+    memset(TreeSums.Data, 0, (size_t)TreeSums.size_in_bytes());
+    memset(TreeCounts.Data, 0, (size_t)TreeCounts.size_in_bytes());
+    MeasuredSum = 0.0;
+    MeasuredCount = 0;
+}
+
+void ImGuiListClipperHeights::SetHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < Heights.Size);
+    height = ImMax(height, 0.0f);
+    if (HeightEstimate <= 0.0f)
+        HeightEstimate = height;
+    const float prev_height = Heights[item_n];
+    if (prev_height == height)
+        return;
+    const double delta_sum = (double)height - ((prev_height >= 0.0f) ? prev_height : 0.0f);
+    const int delta_count = (prev_height >= 0.0f) ? 0 : 1;
+    Heights[item_n] = height;
+    MeasuredSum += delta_sum;
+    MeasuredCount += delta_count;
+    for (int i = item_n + 1; i <= Heights.Size; i += (i & -i))
+    {
+        TreeSums[i] += delta_sum;
+        TreeCounts[i] += delta_count;
+    }
+}
+
+double ImGuiListClipperHeights::GetItemPos(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= Heights.Size);
+    double sum = 0.0;
+    int count = 0;
+    for (int i = item_n; i > 0; i -= (i & -i))
+    {
+        sum += TreeSums[i];
+        count += TreeCounts[i];
+    }
+    return sum + (double)(item_n - count) * HeightEstimate;
+}
+
+int ImGuiListClipperHeights::FindItemAtPos(double pos) const
+{
+    // Descend the tree to find the last item starting at or before 'pos'.
+    // Node 'i' covers the (i & -i) items before it: skip them when they all end before 'pos'.
+    int item_n = 0;
+    for (int mask = TreeMask; mask != 0; mask >>= 1)
+    {
+        const int i = item_n + mask;
+        if (i > Heights.Size)
+            continue;
+        const double node_size = TreeSums[i] + (double)(mask - TreeCounts[i]) * HeightEstimate;
+        if (node_size <= pos)
+        {
+            item_n = i;
+            pos -= node_size;
+        }
+    }
+    return ImMin(item_n, Heights.Size - 1);
+}
+
 static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>& ranges, int offset = 0)
 {
     if (ranges.Size - offset <= 1)
@@ -2491,7 +2875,7 @@ static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>&
     }
 }
 
-static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height)
+static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height, int row_increase = -1)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
     // FIXME: It is problematic that we have to do that here, because custom/equivalent end-user code would stumble on the same issue.
@@ -2510,7 +2894,8 @@ static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_
         if (table->IsInsideRow)
             ImGui::TableEndRow(table);
         table->RowPosY2 = window->DC.CursorPos.y;
-        const int row_increase = (int)((off_y / line_height) + 0.5f);
+        if (row_increase < 0)
+            row_increase = (int)((off_y / line_height) + 0.5f);
         //table->CurrentRow += row_increase; // Can't do without fixing TableEndRow()
         table->RowBgColorCounter += row_increase;
     }
@@ -2521,6 +2906,16 @@ static void ImGuiListClipper_SeekCursorForItem(ImGuiListClipper* clipper, int it
     // StartPosY starts from ItemsFrozen hence the subtraction
     // Perform the add and multiply with double to allow seeking through larger ranges
     ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    if (data->HeightsIdx >= 0)
+    {
+        // Variable height mode: measured heights (or the estimate) of the items in between.
+        // Seek to a whole pixel: ItemSize() floors the cursor, a fractional start would change the height measured for the item.
+        ImGuiListClipperHeights* heights = GImGui->ClipperHeights.GetByIndex(data->HeightsIdx);
+        float pos_y = IM_FLOOR((float)((double)clipper->StartPosY + data->LossynessOffset + heights->GetItemPos(item_n) - heights->GetItemPos(data->ItemsFrozen)));
+        float line_height = (item_n > 0) ? heights->GetHeight(item_n - 1) : heights->HeightEstimate;
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, line_height, item_n - clipper->DisplayEnd);
+        return;
+    }
     float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + (double)(item_n - data->ItemsFrozen) * clipper->ItemsHeight);
     ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, clipper->ItemsHeight);
 }
@@ -2563,17 +2958,45 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     TempData = data;
 }
 
+void ImGuiListClipper::BeginVariableHeight(const char* str_id, int items_count, float items_height_estimate)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(items_count >= 0 && items_count < INT_MAX && "Variable height mode needs to know the number of items.");
+    const ImGuiID id = g.CurrentWindow->GetID(str_id);
+    Begin(items_count, items_height_estimate);
+
+    ImGuiListClipperHeights* heights = g.ClipperHeights.GetOrAddByKey(id);
+    heights->ID = id;
+    heights->LastTimeActive = (float)g.Time;
+    if (items_height_estimate > 0.0f && heights->MeasuredCount == 0)
+        heights->HeightEstimate = items_height_estimate;
+    heights->Resize(items_count);
+    ItemsHeight = heights->HeightEstimate;
+
+    ImGuiListClipperData* data = (ImGuiListClipperData*)TempData;
+    data->HeightsIdx = g.ClipperHeights.GetIndex(heights);
+}
+
+void ImGuiListClipper::ClearItemHeights()
+{
+    ImGuiListClipperData* data = (ImGuiListClipperData*)TempData;
+    IM_ASSERT(data != NULL && data->HeightsIdx >= 0 && "Call after BeginVariableHeight().");
+    IM_ASSERT(data->StepNo == 0 && DisplayStart < 0);
+    GImGui->ClipperHeights.GetByIndex(data->HeightsIdx)->Clear();
+}
+
 void ImGuiListClipper::End()
 {
     // In theory here we should assert that we are already at the right position, but it seems saner to just seek at the end and not assert/crash the user.
-    ImGuiContext& g = *GImGui;
     if (ItemsCount >= 0 && ItemsCount < INT_MAX && DisplayStart >= 0)
         ImGuiListClipper_SeekCursorForItem(this, ItemsCount);
     ItemsCount = -1;
 
     // Restore temporary buffer and fix back pointers which may be invalidated when nesting
+    // (the context is only accessed here, so an ended clipper may be destroyed after the context, e.g. as a member of a static ImGuiVirtualTree)
     if (ImGuiListClipperData* data = (ImGuiListClipperData*)TempData)
     {
+        ImGuiContext& g = *GImGui;
         IM_ASSERT(data->ListClipper == this);
         data->StepNo = data->Ranges.Size;
         if (--g.ClipperTempDataStacked > 0)
@@ -2594,6 +3017,222 @@ void ImGuiListClipper::ForceDisplayRangeByIndices(int item_min, int item_max)
         data->Ranges.push_back(ImGuiListClipperRange::FromIndices(item_min, item_max));
 }
 
+// Variable height mode: position from the first item, of absolute position 'pos_y' in the current layout
+static double ImGuiListClipper_GetListPosFromScreenPos(ImGuiListClipper* clipper, ImGuiListClipperHeights* heights, float pos_y)
+{
+    ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    return heights->GetItemPos(data->ItemsFrozen) + (double)pos_y - clipper->StartPosY - data->LossynessOffset;
+}
+
+// Variable height mode: item at the position targeted by the pending scroll request, ItemsCount past the last item, -1 before the first one
+static int ImGuiListClipper_FindScrollTargetItem(ImGuiListClipper* clipper, ImGuiListClipperHeights* heights)
+{
+    ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    const float target_y = window->ScrollTarget.y - window->Scroll.y + window->Pos.y + window->TitleBarHeight() + window->MenuBarHeight(); // Reverse of SetScrollFromPosY()
+    const double pos = ImGuiListClipper_GetListPosFromScreenPos(clipper, heights, target_y);
+    if (pos < heights->GetItemPos(data->ItemsFrozen))
+        return -1;
+    if (pos >= heights->GetItemPos(clipper->ItemsCount))
+        return clipper->ItemsCount;
+    return heights->FindItemAtPos(pos);
+}
+
+// Variable height mode: anchor on the item targeted by a scroll request if any, otherwise on the first visible item.
+// Prefer the first item measured on a previous frame after it: items measured in this frame (e.g. the ones appearing when scrolling up) don't move it.
+static void ImGuiListClipper_SetupAnchor(ImGuiListClipper* clipper, ImGuiListClipperHeights* heights)
+{
+    ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    int anchor_n = -1;
+    if (window->ScrollTarget.y < FLT_MAX)
+        anchor_n = ImGuiListClipper_FindScrollTargetItem(clipper, heights);
+    else if (clipper->DisplayEnd < clipper->ItemsCount)
+        anchor_n = ImMax(heights->FindItemAtPos(ImGuiListClipper_GetListPosFromScreenPos(clipper, heights, window->ClipRect.Min.y)), clipper->DisplayEnd);
+    if (anchor_n >= 0 && anchor_n < clipper->ItemsCount)
+    {
+        const int anchor_max = heights->FindItemAtPos(heights->GetItemPos(anchor_n) + window->ClipRect.GetHeight());
+        int measured_n = anchor_n;
+        while (measured_n <= anchor_max && heights->Heights[measured_n] < 0.0f)
+            measured_n++;
+        if (measured_n <= anchor_max)
+            anchor_n = measured_n;
+    }
+    data->AnchorItem = anchor_n;
+    data->AnchorPos = (anchor_n >= 0) ? heights->GetItemPos(anchor_n) - data->AnchorShift : 0.0;
+    data->AnchorScrollTargetY = window->ScrollTarget.y;
+}
+
+// Variable height mode: until the anchor item is submitted, offset the positions of the next items by the heights measured above it in this frame,
+// so it stays in place. The offset is undone on the next frame by scrolling (see end of ImGuiListClipper_StepVariableHeight()). Return true when it changed.
+static bool ImGuiListClipper_UpdateAnchorShift(ImGuiListClipper* clipper, ImGuiListClipperHeights* heights)
+{
+    ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    if (data->AnchorItem < 0 || clipper->DisplayEnd > data->AnchorItem)
+        return false;
+    const float shift = (float)(heights->GetItemPos(data->AnchorItem) - data->AnchorPos);
+    if (shift == data->AnchorShift)
+        return false;
+    data->LossynessOffset -= shift - data->AnchorShift;
+    data->AnchorShift = shift;
+    return true;
+}
+
+static void ImGuiListClipper_ConvertRangeToIndices(ImGuiListClipper* clipper, ImGuiListClipperHeights* heights, ImGuiListClipperRange* range)
+{
+    if (!range->PosToIndexConvert)
+        return;
+    const int already_submitted = clipper->DisplayEnd;
+    const int m1 = heights->FindItemAtPos(ImGuiListClipper_GetListPosFromScreenPos(clipper, heights, (float)range->Min));
+    const int m2 = heights->FindItemAtPos(ImGuiListClipper_GetListPosFromScreenPos(clipper, heights, (float)range->Max)) + 1;
+    range->Min = ImClamp(m1 + range->PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
+    range->Max = ImClamp(m2 + range->PosToIndexOffsetMax, range->Min + 1, clipper->ItemsCount);
+    range->PosToIndexConvert = false;
+}
+
+// Variable height mode: move the remaining range starting first to Ranges[StepNo - 1]. Ranges of positions are only converted to indices
+// when they are reached, so they account for the items measured before them in this frame (e.g. from ForceDisplayRangeByIndices()).
+// Ranges may overlap, items already submitted are skipped.
+static void ImGuiListClipper_SetupNextRange(ImGuiListClipper* clipper, ImGuiListClipperHeights* heights)
+{
+    ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    ImGuiListClipper_UpdateAnchorShift(clipper, heights);
+    int best_n = -1;
+    int best_min = INT_MAX;
+    for (int n = data->StepNo - 1; n < data->Ranges.Size; n++)
+    {
+        ImGuiListClipperRange range = data->Ranges[n];
+        ImGuiListClipper_ConvertRangeToIndices(clipper, heights, &range);
+        if (range.Min < best_min)
+        {
+            best_n = n;
+            best_min = range.Min;
+        }
+    }
+    if (best_n < 0)
+        return;
+    ImSwap(data->Ranges[data->StepNo - 1], data->Ranges[best_n]);
+    ImGuiListClipper_ConvertRangeToIndices(clipper, heights, &data->Ranges[data->StepNo - 1]);
+}
+
+// Variable height mode: each step displays a single item, measured by the following step.
+static bool ImGuiListClipper_StepVariableHeight(ImGuiListClipper* clipper)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    ImGuiListClipperHeights* heights = g.ClipperHeights.GetByIndex(data->HeightsIdx);
+
+    // Measure the item submitted by the previous step
+    if (data->MeasureItem >= 0)
+    {
+        heights->SetHeight(data->MeasureItem, window->DC.CursorPos.y - data->MeasurePosY);
+        data->MeasureItem = -1;
+    }
+
+    // A scroll request made by the previous item (e.g. SetScrollHereY() on a forced item) targets the layout of this frame: anchor on the targeted item
+    if (data->StepNo > 0 && !g.LogEnabled && window->ScrollTarget.y != data->AnchorScrollTargetY)
+        ImGuiListClipper_SetupAnchor(clipper, heights);
+
+    if (data->StepNo == 0)
+    {
+        // Step 0: Until a height is known, submit items one by one from the top to measure them
+        if (clipper->DisplayEnd == data->ItemsFrozen)
+            clipper->StartPosY = window->DC.CursorPos.y;
+        if (heights->HeightEstimate <= 0.0f && clipper->DisplayEnd < clipper->ItemsCount)
+        {
+            clipper->DisplayStart = clipper->DisplayEnd;
+            clipper->DisplayEnd = clipper->DisplayStart + 1;
+            data->MeasureItem = clipper->DisplayStart;
+            data->MeasurePosY = window->DC.CursorPos.y;
+            return true;
+        }
+        clipper->ItemsHeight = heights->HeightEstimate;
+
+        // Ranges from ForceDisplayRangeByIndices() also include the items within a window height before them,
+        // so they are all measured and SetScrollHereY() called on a forced item uses its final position.
+        for (int i = 0; i < data->Ranges.Size; i++)
+            data->Ranges[i].Min = heights->FindItemAtPos(heights->GetItemPos(data->Ranges[i].Min) - window->ClipRect.GetHeight());
+
+        // Scroll anchoring: when items above the anchor get measured or the estimate changes, it moves: this is compensated by scrolling after the last step.
+        if (!g.LogEnabled)
+            ImGuiListClipper_SetupAnchor(clipper, heights);
+
+        // Add the ranges of items to display (same as fixed height mode, but positions are converted using the heights)
+        if (g.LogEnabled)
+        {
+            // If logging is active, do not perform any clipping
+            data->Ranges.push_back(ImGuiListClipperRange::FromIndices(0, clipper->ItemsCount));
+        }
+        else
+        {
+            const bool is_nav_request = (g.NavMoveScoringItems && g.NavWindow && g.NavWindow->RootWindowForNav == window->RootWindowForNav);
+            if (is_nav_request)
+                data->Ranges.push_back(ImGuiListClipperRange::FromPositions(g.NavScoringNoClipRect.Min.y, g.NavScoringNoClipRect.Max.y, 0, 0));
+            if (is_nav_request && (g.NavMoveFlags & ImGuiNavMoveFlags_Tabbing) && g.NavTabbingDir == -1)
+                data->Ranges.push_back(ImGuiListClipperRange::FromIndices(clipper->ItemsCount - 1, clipper->ItemsCount));
+            ImRect nav_rect_abs = ImGui::WindowRectRelToAbs(window, window->NavRectRel[0]);
+            if (g.NavId != 0 && window->NavLastIds[0] == g.NavId)
+                data->Ranges.push_back(ImGuiListClipperRange::FromPositions(nav_rect_abs.Min.y, nav_rect_abs.Max.y, 0, 0));
+            const int off_min = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Up) ? -1 : 0;
+            const int off_max = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Down) ? 1 : 0;
+            data->Ranges.push_back(ImGuiListClipperRange::FromPositions(window->ClipRect.Min.y, window->ClipRect.Max.y, off_min, off_max));
+        }
+        data->StepNo = 1;
+        ImGuiListClipper_SetupNextRange(clipper, heights);
+    }
+
+    // Step 1+: Display the next item of the current range (Ranges[StepNo - 1]).
+    // Ranges were calculated from heights partly estimated: when items turn out smaller than expected, extend the range
+    // that reached the clipping rectangle until it is filled.
+    while (data->StepNo - 1 < data->Ranges.Size)
+    {
+        ImGuiListClipperRange& range = data->Ranges[data->StepNo - 1];
+        const int already_submitted = clipper->DisplayEnd;
+        const int item_n = ImMax(range.Min, already_submitted);
+        if (item_n >= range.Max && item_n == already_submitted && item_n < clipper->ItemsCount && !g.LogEnabled)
+            if (window->DC.CursorPos.y >= window->ClipRect.Min.y && window->DC.CursorPos.y < window->ClipRect.Max.y)
+                range.Max = item_n + 1;
+        if (item_n >= ImMin(range.Max, clipper->ItemsCount))
+        {
+            data->StepNo++;
+            ImGuiListClipper_SetupNextRange(clipper, heights);
+            continue;
+        }
+        const bool anchor_shifted = (item_n == data->AnchorItem) && ImGuiListClipper_UpdateAnchorShift(clipper, heights);
+        if (item_n > already_submitted || anchor_shifted)
+            ImGuiListClipper_SeekCursorForItem(clipper, item_n);
+        clipper->DisplayStart = item_n;
+        clipper->DisplayEnd = item_n + 1;
+        data->MeasureItem = item_n;
+        data->MeasurePosY = window->DC.CursorPos.y;
+        return true;
+    }
+
+    // After the last step: update the estimate of items not measured yet with the average of measured ones, and scroll by
+    // how much the anchor item will have moved on the next frame, so it stays in place. This includes the heights measured
+    // in this frame and the change of the estimate. We don't modify window->Scroll directly, as it would desynchronize from
+    // the positions of items submitted in this frame.
+    if (heights->MeasuredCount > 0)
+        heights->HeightEstimate = (float)(heights->MeasuredSum / heights->MeasuredCount);
+    if (data->AnchorItem >= 0)
+    {
+        const float anchor_delta = (float)(heights->GetItemPos(data->AnchorItem) - data->AnchorPos);
+        if (anchor_delta != 0.0f)
+        {
+            if (window->ScrollTarget.y < FLT_MAX)
+                window->ScrollTarget.y += anchor_delta;
+            else
+                ImGui::SetScrollY(window, window->Scroll.y + anchor_delta);
+        }
+    }
+
+    // Advance the cursor to the end of the list and then returns 'false' to end the loop.
+    ImGuiListClipper_SeekCursorForItem(clipper, clipper->ItemsCount);
+    clipper->ItemsCount = -1;
+    return false;
+}
+
 bool ImGuiListClipper::Step()
 {
     ImGuiContext& g = *GImGui;
@@ -2620,6 +3259,9 @@ bool ImGuiListClipper::Step()
         return true;
     }
 
+    if (data->HeightsIdx >= 0)
+        return ImGuiListClipper_StepVariableHeight(this);
+
     // Step 0: Let you process the first element (regardless of it being visible or not, so we can measure the element height)
     bool calc_clipping = false;
     if (data->StepNo == 0)
@@ -3201,6 +3843,9 @@ void ImGui::RenderNavHighlight(const ImRect& bb, ImGuiID id, ImGuiNavHighlightFl
 ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name) : DrawListInst(NULL)
 {
     memset(this, 0, sizeof(*this));
+#ifdef IMGUI_USE_STORAGE_HASH_INDEX
+    StateStorage.UseHashIndex = true;
+#endif
     Name = ImStrdup(name);
     NameBufLen = (int)strlen(name) + 1;
     ID = ImHashStr(name);
@@ -3225,6 +3870,8 @@ ImGuiWindow::~ImGuiWindow()
 {
     IM_ASSERT(DrawList == &DrawListInst);
     IM_DELETE(Name);
+    if (DrawListCache)
+        IM_DELETE(DrawListCache);
     ColumnsStorage.clear_destruct();
 }
 
@@ -3329,6 +3976,12 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
+    if (window->DrawListCache)
+    {
+        IM_DELETE(window->DrawListCache);
+        window->DrawListCache = NULL;
+        window->DrawListCacheStable = false;
+    }
     window->DC.ChildWindows.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
@@ -3596,6 +4249,7 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
 }
 
 // IM_ALLOC() == ImGui::MemAlloc()
+// MetricsActiveAllocations is a plain counter: it may lose updates when worker threads allocate (BuildParallelForFn, detached draw lists).
 void* ImGui::MemAlloc(size_t size)
 {
     if (ImGuiContext* ctx = GImGui)
@@ -3734,6 +4388,61 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+void ImGui::SetMaxWaitBeforeNextFrame(float time)
+{
+    ImGuiContext& g = *GImGui;
+    g.MaxWaitBeforeNextFrame = ImMin(g.MaxWaitBeforeNextFrame, ImMax(time, 0.0f));
+}
+
+// Power saving: when nothing is animating, the platform backend may sleep until the next input event instead of rendering frames that would be identical.
+// On top of explicit SetMaxWaitBeforeNextFrame() requests, we keep rendering while the state of the previous frame requires follow-up frames:
+// - input events still queued (1.87 trickles some of them over multiple frames) and held keys/buttons (key repeat, ButtonRepeat, drag).
+// - one settling frame after the mouse moved or a key/button was released, as some layout changes (e.g. auto-resizing windows) lag by a frame.
+// - windows appearing or auto-fitting, pending scroll requests, navigation requests resolved on the next frame.
+// - windows using ImGuiWindowFlags_CacheDrawList which displayed stale cached output after a cache miss.
+// - dimming background and CTRL+Tab highlight fading, pending .ini saving.
+// - glyphs requested by ImFontAtlasFlags_DynamicGlyphs fonts (displayed with the fallback glyph until the next frame), texture updates not uploaded yet.
+float ImGui::GetEventWaitingTime()
+{
+    ImGuiContext& g = *GImGui;
+    if (g.FrameCount < 3 || g.InputEventsQueue.Size > 0 || g.IO.WantSetMousePos)
+        return 0.0f;
+    if (g.IO.MouseDelta.x != 0.0f || g.IO.MouseDelta.y != 0.0f)
+        return 0.0f;
+    for (int n = 0; n < IM_ARRAYSIZE(g.IO.MouseDown); n++)
+        if (g.IO.MouseDown[n] || g.IO.MouseReleased[n])
+            return 0.0f;
+    for (int n = 0; n < IM_ARRAYSIZE(g.IO.KeysData); n++)
+        if (g.IO.KeysData[n].Down || g.IO.KeysData[n].DownDurationPrev >= 0.0f)
+            return 0.0f;
+    for (int n = 0; n < IM_ARRAYSIZE(g.IO.NavInputs); n++)
+        if (g.IO.NavInputs[n] > 0.0f || g.IO.NavInputsDownDurationPrev[n] >= 0.0f)
+            return 0.0f;
+    if (g.NavMoveSubmitted || g.NavInitRequest || g.NavWindowingTarget != NULL || g.NavWindowingTargetAnim != NULL)
+        return 0.0f;
+    if (g.DimBgRatio > 0.0f && g.DimBgRatio < 1.0f)
+        return 0.0f;
+    if (ImFontAtlasHasPendingDynamicGlyphs(g.IO.Fonts) || g.IO.Fonts->TexUpdates.Size > 0)
+        return 0.0f;
+    for (int n = 0; n < g.Windows.Size; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        if (!window->WasActive)
+            continue;
+        if (window->Appearing || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0)
+            return 0.0f;
+        if (window->ScrollTarget.x < FLT_MAX || window->ScrollTarget.y < FLT_MAX)
+            return 0.0f;
+        if (window->DrawListCacheSkipping && !window->DrawListCacheStable) // Cache miss: stale output was displayed, next frame emits the new one
+            return 0.0f;
+    }
+
+    float wait_time = g.MaxWaitBeforeNextFrame;
+    if (g.SettingsDirtyTimer > 0.0f)
+        wait_time = ImMin(wait_time, g.SettingsDirtyTimer);
+    return wait_time;
+}
+
 static ImDrawList* GetViewportDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -4110,7 +4819,9 @@ void ImGui::UpdateMouseWheel()
         {
             float max_step = window->InnerRect.GetHeight() * 0.67f;
             float scroll_step = ImFloor(ImMin(5 * window->CalcFontSize(), max_step));
-            SetScrollY(window, window->Scroll.y - wheel_y * scroll_step);
+            // Add to a pending scroll request made on the previous frame (e.g. by a variable height clipper keeping items in place) rather than replacing it
+            float scroll_y = (window->ScrollTarget.y < FLT_MAX && window->ScrollTargetCenterRatio.y == 0.0f) ? window->ScrollTarget.y : window->Scroll.y;
+            SetScrollY(window, scroll_y - wheel_y * scroll_step);
         }
     }
 
@@ -4239,6 +4950,7 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    g.MaxWaitBeforeNextFrame = FLT_MAX;
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -4252,6 +4964,10 @@ void ImGui::NewFrame()
 
     UpdateViewportsNewFrame();
 
+    // Rasterize glyphs requested during the previous frame
+    if (g.IO.Fonts->DynamicGlyphs != NULL)
+        ImFontAtlasUpdateDynamicGlyphs(g.IO.Fonts);
+
     // Setup current font and draw list shared data
     g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
@@ -4272,6 +4988,18 @@ void ImGui::NewFrame()
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
 
+    // Setup glyph run cache, dropping text layouts made with outdated glyphs
+    ImFontGlyphRunCache* glyph_run_cache = &g.GlyphRunCache;
+    glyph_run_cache->Hits = glyph_run_cache->Misses = 0;
+    glyph_run_cache->MemoryBudget = ImMax(g.IO.ConfigGlyphRunCacheBudget, 0);
+    if (glyph_run_cache->MemoryBudget == 0 || glyph_run_cache->GlyphDataVersion != g.Font->ContainerAtlas->GlyphDataVersion)
+        glyph_run_cache->ClearFreeMemory();
+    glyph_run_cache->GlyphDataVersion = g.Font->ContainerAtlas->GlyphDataVersion;
+    while (glyph_run_cache->MemoryUsed > glyph_run_cache->MemoryBudget && glyph_run_cache->LruLast != -1)
+        glyph_run_cache->RemoveRun(glyph_run_cache->LruLast);
+    if (glyph_run_cache->MemoryBudget > 0)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_GlyphRunCache;
+
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     for (int n = 0; n < g.Viewports.Size; n++)
     {
@@ -4397,6 +5125,13 @@ void ImGui::NewFrame()
     for (int i = 0; i < g.TablesTempData.Size; i++)
         if (g.TablesTempData[i].LastTimeActive >= 0.0f && g.TablesTempData[i].LastTimeActive < memory_compact_start_time)
             TableGcCompactTransientBuffers(&g.TablesTempData[i]);
+
+    // Garbage collect item heights of recently unused variable height clippers (they would be measured again)
+    if (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer >= 0.0f)
+        for (int i = 0; i < g.ClipperHeights.GetMapSize(); i++)
+            if (ImGuiListClipperHeights* heights = g.ClipperHeights.TryGetMapData(i))
+                if (heights->LastTimeActive < memory_compact_start_time)
+                    g.ClipperHeights.Remove(heights->ID, heights);
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
@@ -4443,6 +5178,8 @@ void ImGui::Initialize(ImGuiContext* context)
         ini_handler.ReadLineFn = WindowSettingsHandler_ReadLine;
         ini_handler.ApplyAllFn = WindowSettingsHandler_ApplyAll;
         ini_handler.WriteAllFn = WindowSettingsHandler_WriteAll;
+        ini_handler.ReadBinaryFn = WindowSettingsHandler_ReadBinary;
+        ini_handler.WriteBinaryFn = WindowSettingsHandler_WriteBinary;
         g.SettingsHandlers.push_back(ini_handler);
     }
 
@@ -4476,6 +5213,7 @@ void ImGui::Shutdown(ImGuiContext* context)
         return;
 
     // Save settings (unless we haven't attempted to load them: CreateContext/DestroyContext without a call to NewFrame shouldn't save an empty file)
+    WaitIniSettingsSaveJob(&g);
     if (g.SettingsLoaded && g.IO.IniFilename != NULL)
     {
         ImGuiContext* backup_context = GImGui;
@@ -4510,6 +5248,7 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.ShrinkWidthBuffer.clear();
 
     g.ClipperTempData.clear_destruct();
+    g.ClipperHeights.Clear();
 
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
@@ -4518,8 +5257,15 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
     g.InputTextState.ClearFreeMemory();
+    g.GlyphRunCache.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsMap.Clear();
+    g.SettingsWindowsBinary.Clear();
+    g.SettingsTablesBinary.Clear();
+    g.SettingsBinaryLoadedData = NULL;
+    g.SettingsBinaryData.clear();
+    g.SettingsBinaryDataPrev.clear();
     g.SettingsHandlers.clear();
 
     if (g.LogFile)
@@ -4598,12 +5344,87 @@ static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* d
     out_list->push_back(draw_list);
 }
 
+// Compare output of two draw lists, ignoring a trailing unused draw command (which the cached list had removed when it was rendered)
+static bool DrawListOutputEquals(const ImDrawList* a, const ImDrawList* b)
+{
+    int cmd_count_a = a->CmdBuffer.Size;
+    int cmd_count_b = b->CmdBuffer.Size;
+    if (cmd_count_a > 0 && a->CmdBuffer.back().ElemCount == 0 && a->CmdBuffer.back().UserCallback == NULL)
+        cmd_count_a--;
+    if (cmd_count_b > 0 && b->CmdBuffer.back().ElemCount == 0 && b->CmdBuffer.back().UserCallback == NULL)
+        cmd_count_b--;
+    if (cmd_count_a != cmd_count_b || a->IdxBuffer.Size != b->IdxBuffer.Size || a->VtxBuffer.Size != b->VtxBuffer.Size)
+        return false;
+    for (int n = 0; n < cmd_count_a; n++)
+    {
+        const ImDrawCmd* cmd_a = &a->CmdBuffer[n];
+        const ImDrawCmd* cmd_b = &b->CmdBuffer[n];
+        if (memcmp(&cmd_a->ClipRect, &cmd_b->ClipRect, sizeof(ImVec4)) != 0 || cmd_a->TextureId != cmd_b->TextureId || cmd_a->VtxOffset != cmd_b->VtxOffset || cmd_a->IdxOffset != cmd_b->IdxOffset || cmd_a->ElemCount != cmd_b->ElemCount)
+            return false;
+        if (cmd_a->UserCallback != cmd_b->UserCallback || cmd_a->UserCallbackData != cmd_b->UserCallbackData)
+            return false;
+    }
+    return memcmp(a->IdxBuffer.Data, b->IdxBuffer.Data, (size_t)a->IdxBuffer.size_in_bytes()) == 0 && memcmp(a->VtxBuffer.Data, b->VtxBuffer.Data, (size_t)a->VtxBuffer.size_in_bytes()) == 0;
+}
+
+// Windows using ImGuiWindowFlags_CacheDrawList render window->DrawListCache, which holds the output of the last frame that emitted geometry.
+// - When two consecutive frames emitting geometry have the same content hash, the next frame only hashes its draw calls (ImDrawListFlags_SkipGeometry)
+//   and the cached output is reused for as long as the hash keeps matching.
+// - When the hash of a skipping frame doesn't match, the cached output is displayed one frame late, and the next frame emits geometry again.
+static ImDrawList* UpdateWindowDrawListCache(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImDrawList* draw_list = window->DrawList;
+    if (draw_list->_PrimHashVtxStart >= 0)
+        draw_list->_HashPrimWrites();
+    const bool hash_match = (window->DrawListCache != NULL) && (draw_list->_ContentHash == window->DrawListCacheHash);
+    if (window->DrawListCacheSkipping)
+    {
+        if (hash_match)
+            g.IO.MetricsDrawListCacheHits++;
+        else
+            g.IO.MetricsDrawListCacheMisses++;
+        window->DrawListCacheStable = hash_match;
+        return window->DrawListCache;
+    }
+
+    if (window->DrawListCache == NULL)
+    {
+        window->DrawListCache = IM_NEW(ImDrawList)(&g.DrawListSharedData);
+        window->DrawListCache->_OwnerName = window->Name;
+    }
+    ImDrawList* cache = window->DrawListCache;
+    if (hash_match && g.IO.ConfigDrawListCacheVerify)
+    {
+        g.IO.MetricsDrawListCacheHits++;
+        if (!DrawListOutputEquals(draw_list, cache))
+            g.IO.MetricsDrawListCacheErrors++;
+    }
+    else
+    {
+        g.IO.MetricsDrawListCacheMisses++;
+    }
+    window->DrawListCacheHash = draw_list->_ContentHash;
+    window->DrawListCacheStable = hash_match;
+
+    // Move output to the cache. The previous cache buffers are given back to the window draw list, to be reused on next frame.
+    cache->CmdBuffer.swap(draw_list->CmdBuffer);
+    cache->IdxBuffer.swap(draw_list->IdxBuffer);
+    cache->VtxBuffer.swap(draw_list->VtxBuffer);
+    ImSwap(cache->_VtxCurrentIdx, draw_list->_VtxCurrentIdx);
+    ImSwap(cache->_VtxWritePtr, draw_list->_VtxWritePtr);
+    ImSwap(cache->_IdxWritePtr, draw_list->_IdxWritePtr);
+    cache->Flags = draw_list->Flags;
+    return cache;
+}
+
 static void AddWindowToDrawData(ImGuiWindow* window, int layer)
 {
     ImGuiContext& g = *GImGui;
     ImGuiViewportP* viewport = g.Viewports[0];
     g.IO.MetricsRenderWindows++;
-    AddDrawListToDrawData(&viewport->DrawDataBuilder.Layers[layer], window->DrawList);
+    ImDrawList* draw_list = (window->DrawList->Flags & ImDrawListFlags_HashContents) ? UpdateWindowDrawListCache(window) : window->DrawList;
+    AddDrawListToDrawData(&viewport->DrawDataBuilder.Layers[layer], draw_list);
     for (int i = 0; i < window->DC.ChildWindows.Size; i++)
     {
         ImGuiWindow* child = window->DC.ChildWindows[i];
@@ -4857,6 +5678,10 @@ void ImGui::Render()
     const bool first_render_of_frame = (g.FrameCountRendered != g.FrameCount);
     g.FrameCountRendered = g.FrameCount;
     g.IO.MetricsRenderWindows = 0;
+    g.IO.MetricsDrawListCacheHits = g.IO.MetricsDrawListCacheMisses = g.IO.MetricsDrawListCacheErrors = 0;
+    g.IO.MetricsGlyphRunCacheHits = g.GlyphRunCache.Hits;
+    g.IO.MetricsGlyphRunCacheMisses = g.GlyphRunCache.Misses;
+    g.IO.MetricsGlyphRunCacheMemory = g.GlyphRunCache.MemoryUsed;
 
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
 
@@ -4928,7 +5753,34 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+
+    // Reuse size from glyph run cache
+    ImVec2 text_size;
+    if ((g.DrawListSharedData.InitialFlags & ImDrawListFlags_GlyphRunCache) && g.WithinFrameScope)
+    {
+        if (text_display_end == NULL)
+            text_display_end = text + strlen(text);
+        if (text_display_end - text >= IM_FONTGLYPHRUN_CACHE_MIN_LEN && text_display_end - text <= IM_FONTGLYPHRUN_CACHE_MAX_LEN)
+        {
+            ImFontGlyphRunCache* cache = &g.GlyphRunCache;
+            ImFontGlyphRun* run = cache->GetRun(font, font_size, wrap_width, text, text_display_end);
+            if (run->HasTextSize)
+            {
+                cache->Hits++;
+            }
+            else
+            {
+                cache->Misses++;
+                run->TextSize = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+                run->HasTextSize = true;
+                cache->UpdateMemorySize(run);
+            }
+            text_size = run->TextSize;
+            text_size.x = IM_FLOOR(text_size.x + 0.99999f);
+            return text_size;
+        }
+    }
+    text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
     // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
@@ -6098,6 +6950,25 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DrawList->_ResetForNewFrame();
         window->DC.CurrentTableIdx = -1;
 
+        // Hash draw calls of windows using a cached draw list, skip emitting geometry while the cached output can be reused (see AddWindowToDrawData())
+        window->DrawListCacheSkipping = false;
+        if (flags & ImGuiWindowFlags_CacheDrawList)
+        {
+            // Dynamic glyphs may have been evicted or moved: drop cached vertices with outdated UV, as the glyph run cache does in NewFrame()
+            const int glyph_data_version = g.Font->ContainerAtlas->GlyphDataVersion;
+            if (window->DrawListCacheGlyphDataVersion != glyph_data_version)
+                window->DrawListCacheStable = false;
+            window->DrawListCacheGlyphDataVersion = glyph_data_version;
+            window->DrawListCacheSkipping = window->DrawListCacheStable && window->WasActive && !g.IO.ConfigDrawListCacheVerify;
+            window->DrawList->Flags |= ImDrawListFlags_HashContents | (window->DrawListCacheSkipping ? ImDrawListFlags_SkipGeometry : 0);
+        }
+        else if (window->DrawListCache)
+        {
+            IM_DELETE(window->DrawListCache);
+            window->DrawListCache = NULL;
+            window->DrawListCacheStable = false;
+        }
+
         // Restore buffer capacity when woken from a compacted state, to avoid
         if (window->MemoryCompacted)
             GcAwakeTransientWindowBuffers(window);
@@ -6424,7 +7295,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
                 // - We disable this when the parent window has zero vertices, which is a common pattern leading to laying out multiple overlapping childs
                 ImGuiWindow* previous_child = parent_window->DC.ChildWindows.Size >= 2 ? parent_window->DC.ChildWindows[parent_window->DC.ChildWindows.Size - 2] : NULL;
                 bool previous_child_overlapping = previous_child ? previous_child->Rect().Overlaps(window->Rect()) : false;
-                bool parent_is_empty = parent_window->DrawList->VtxBuffer.Size > 0;
+                // - We disable this when the parent window uses a cached draw list, as its vertices may not be emitted this frame
+                bool parent_is_empty = parent_window->DrawList->VtxBuffer.Size > 0 && !(parent_window->DrawList->Flags & ImDrawListFlags_HashContents);
                 if (window->DrawList->CmdBuffer.back().ElemCount == 0 && parent_is_empty && !previous_child_overlapping)
                     render_decorations_in_parent = true;
             }
@@ -6547,6 +7419,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     {
         // Append
         SetCurrentWindow(window);
+        if (window->DrawListCacheSkipping)
+            window->DrawList->Flags |= ImDrawListFlags_SkipGeometry;
     }
 
     // Pull/inherit current state
@@ -6629,6 +7503,7 @@ void ImGui::End()
     if (window->DC.CurrentColumns)
         EndColumns();
     PopClipRect();   // Inner window clip rectangle
+    window->DrawList->Flags &= ~ImDrawListFlags_SkipGeometry; // Anything drawn after End() is emitted (and hashed), e.g. RenderDimmedBackgrounds()
 
     // Stop logging
     if (!(window->Flags & ImGuiWindowFlags_ChildWindow))    // FIXME: add more options for scope of logging
@@ -7944,6 +8819,7 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     IM_ASSERT(g.Style.Alpha >= 0.0f && g.Style.Alpha <= 1.0f            && "Invalid style setting!"); // Allows us to avoid a few clamps in color computations
     IM_ASSERT(g.Style.WindowMinSize.x >= 1.0f && g.Style.WindowMinSize.y >= 1.0f && "Invalid style setting.");
     IM_ASSERT(g.Style.WindowMenuButtonPosition == ImGuiDir_None || g.Style.WindowMenuButtonPosition == ImGuiDir_Left || g.Style.WindowMenuButtonPosition == ImGuiDir_Right);
+    IM_ASSERT((!(g.IO.Fonts->Flags & ImFontAtlasFlags_DynamicGlyphs) || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates)) && "ImFontAtlasFlags_DynamicGlyphs requires a renderer backend uploading io.Fonts->TexUpdates[]!");
 #ifndef IMGUI_DISABLE_OBSOLETE_KEYIO
     for (int n = ImGuiKey_NamedKey_BEGIN; n < ImGuiKey_COUNT; n++)
         IM_ASSERT(g.IO.KeyMap[n] >= -1 && g.IO.KeyMap[n] < IM_ARRAYSIZE(g.IO.KeysDown) && "io.KeyMap[] contains an out of bound value (need to be 0..511, or -1 for unmapped key)");
@@ -11478,7 +12354,16 @@ void ImGui::LogButtons()
 // - LoadIniSettingsFromDisk()
 // - LoadIniSettingsFromMemory()
 // - SaveIniSettingsToDisk()
+// - SaveIniSettingsToDiskAsync() [Internal]
 // - SaveIniSettingsToMemory()
+// - AppendIniSettingsCache() [Internal]
+// - UpdateIniSettingsCache() [Internal]
+// - LoadIniSettingsFromBinary()
+// - SaveIniSettingsToBinary()
+// - ImGuiSettingsBinaryRecords
+// - BeginBinarySettingsRecords() [Internal]
+// - AppendBinarySettingsRecords() [Internal]
+// - SortBinarySettingsRecords() [Internal]
 // - WindowSettingsHandler_***() [Internal]
 //-----------------------------------------------------------------------------
 
@@ -11501,11 +12386,17 @@ void ImGui::UpdateSettings()
         g.SettingsDirtyTimer -= g.IO.DeltaTime;
         if (g.SettingsDirtyTimer <= 0.0f)
         {
-            if (g.IO.IniFilename != NULL)
+            if (g.IO.IniFilename != NULL && g.IO.IniSavingAsyncFn != NULL)
+            {
+                if (!SaveIniSettingsToDiskAsync(g.IO.IniFilename))
+                    g.SettingsDirtyTimer = FLT_MIN; // Previous save is still being written: retry next frame
+            }
+            else if (g.IO.IniFilename != NULL)
                 SaveIniSettingsToDisk(g.IO.IniFilename);
             else
                 g.IO.WantSaveIniSettings = true;  // Let user know they can call SaveIniSettingsToMemory(). user will need to clear io.WantSaveIniSettings themselves.
-            g.SettingsDirtyTimer = 0.0f;
+            if (g.SettingsDirtyTimer <= 0.0f)
+                g.SettingsDirtyTimer = 0.0f;
         }
     }
 }
@@ -11543,16 +12434,49 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
+    g.SettingsWindowsMap.SetInt(settings->ID, g.SettingsWindows.offset_from_ptr(settings));
+
+    return settings;
+}
 
+// Create settings from a record of the data given to LoadIniSettingsFromBinary()
+static ImGuiWindowSettings* WindowSettingsUnpackBinary(const ImGuiWindowSettingsRecord* record)
+{
+    ImGuiContext& g = *GImGui;
+    if (record->NameOffset >= (ImU32)g.SettingsWindowsBinary.ExtraSize)
+        return NULL;
+    ImGuiWindowSettings* settings = ImGui::CreateNewWindowSettings(g.SettingsWindowsBinary.Extra + record->NameOffset);
+    settings->Pos = record->Pos;
+    settings->Size = record->Size;
+    settings->Collapsed = (record->Collapsed != 0);
     return settings;
 }
 
+// Create settings for all records which haven't been used yet, then stop referencing the binary data
+static void WindowSettingsUnpackAllBinary(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiSettingsBinaryRecords* binary = &g.SettingsWindowsBinary;
+    for (int n = 0; n < binary->Count; n++)
+    {
+        const ImGuiWindowSettingsRecord* record = (const ImGuiWindowSettingsRecord*)(binary->Data + n * binary->Stride);
+        if (g.SettingsWindowsMap.GetInt(record->ID, 0) == 0)
+            WindowSettingsUnpackBinary(record);
+    }
+    binary->Clear();
+}
+
+// Settings of windows which haven't been submitted yet may still be in binary data: they are unpacked here on first use.
 ImGuiWindowSettings* ImGui::FindWindowSettings(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
+    const int offset = g.SettingsWindowsMap.GetInt(id, 0); // Offsets are never 0 (chunk header)
+    if (offset != 0)
+        return g.SettingsWindows.ptr_from_offset(offset);
+    if (g.SettingsWindowsBinary.Count > 0)
+        if (const ImGuiWindowSettingsRecord* record = (const ImGuiWindowSettingsRecord*)g.SettingsWindowsBinary.Find(id))
+            if (ImGuiWindowSettings* settings = WindowSettingsUnpackBinary(record))
+                return (settings->ID == id) ? settings : NULL;
     return NULL;
 }
 
@@ -11584,15 +12508,30 @@ void ImGui::ClearIniSettings()
 
 void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
 {
-    size_t file_data_size = 0;
-    char* file_data = (char*)ImFileLoadToMemory(ini_filename, "rb", &file_data_size);
-    if (!file_data)
+    // Read the file straight into g.SettingsIniData, LoadIniSettingsFromMemory() then parses it in place without another copy
+    ImGuiContext& g = *GImGui;
+    ImFileHandle f = ImFileOpen(ini_filename, "rb");
+    if (!f)
+        return;
+    const size_t file_size = (size_t)ImFileGetSize(f);
+    if (file_size == (size_t)-1)
+    {
+        ImFileClose(f);
+        return;
+    }
+    g.SettingsIniData.Buf.resize((int)file_size + 1);
+    const bool ok = ImFileRead(g.SettingsIniData.Buf.Data, 1, file_size, f) == file_size;
+    ImFileClose(f);
+    if (!ok || file_size == 0)
+    {
+        g.SettingsIniData.clear();
         return;
-    LoadIniSettingsFromMemory(file_data, (size_t)file_data_size);
-    IM_FREE(file_data);
+    }
+    LoadIniSettingsFromMemory(g.SettingsIniData.Buf.Data, file_size);
 }
 
 // Zero-tolerance, no error reporting, cheap .ini parsing
+// Lines are handed to the handlers as zero-terminated pointers into the buffer: each line end is temporarily overwritten then restored.
 void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
 {
     ImGuiContext& g = *GImGui;
@@ -11601,14 +12540,20 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
     //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
 
     // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
-    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
+    // We need a writable buffer to write zero-terminators into, so unless we are given g.SettingsIniData (loaded from disk, or the output
+    // of SaveIniSettingsToMemory()) make one copy, which is also kept for browsing in Metrics.
     if (ini_size == 0)
         ini_size = strlen(ini_data);
-    g.SettingsIniData.Buf.resize((int)ini_size + 1);
+    if (ini_data != g.SettingsIniData.Buf.Data)
+    {
+        g.SettingsIniData.Buf.resize((int)ini_size + 1);
+        memcpy(g.SettingsIniData.Buf.Data, ini_data, ini_size);
+    }
+    IM_ASSERT((size_t)g.SettingsIniData.Buf.Size > ini_size);
     char* const buf = g.SettingsIniData.Buf.Data;
     char* const buf_end = buf + ini_size;
-    memcpy(buf, ini_data, ini_size);
     buf_end[0] = 0;
+    g.SettingsIniSaveCount++; // g.SettingsIniData doesn't hold the last saved output anymore
 
     // Call pre-read handlers
     // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
@@ -11628,41 +12573,96 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
         line_end = line;
         while (line_end < buf_end && *line_end != '\n' && *line_end != '\r')
             line_end++;
-        line_end[0] = 0;
         if (line[0] == ';')
             continue;
+        const char line_end_c = line_end[0];
+        line_end[0] = 0;
         if (line[0] == '[' && line_end > line && line_end[-1] == ']')
         {
             // Parse "[Type][Name]". Note that 'Name' can itself contains [] characters, which is acceptable with the current format and parsing code.
-            line_end[-1] = 0;
             const char* name_end = line_end - 1;
             const char* type_start = line + 1;
             char* type_end = (char*)(void*)ImStrchrRange(type_start, name_end, ']');
             const char* name_start = type_end ? ImStrchrRange(type_end + 1, name_end, '[') : NULL;
-            if (!type_end || !name_start)
-                continue;
-            *type_end = 0; // Overwrite first ']'
-            name_start++;  // Skip second '['
-            entry_handler = FindSettingsHandler(type_start);
-            entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
+            if (type_end && name_start)
+            {
+                line_end[-1] = 0;
+                *type_end = 0; // Overwrite first ']'
+                name_start++;  // Skip second '['
+                entry_handler = FindSettingsHandler(type_start);
+                entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
+                *type_end = ']';
+                line_end[-1] = ']';
+            }
         }
         else if (entry_handler != NULL && entry_data != NULL)
         {
             // Let type handler parse the line
             entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
         }
+        line_end[0] = line_end_c;
     }
     g.SettingsLoaded = true;
 
-    // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
-    memcpy(buf, ini_data, ini_size);
-
     // Call post-read handlers
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
         if (g.SettingsHandlers[handler_n].ApplyAllFn)
             g.SettingsHandlers[handler_n].ApplyAllFn(&g, &g.SettingsHandlers[handler_n]);
 }
 
+// The only state shared with the thread running the io.IniSavingAsyncFn() job is g.SettingsIniSaveBusy (read/written with ImAtomicLoad()/ImAtomicStore())
+
+// Wait for the io.IniSavingAsyncFn() job to finish writing (only happens when saving again right away, or on shutdown).
+// Writing a .ini file takes milliseconds: poll every millisecond rather than spinning.
+static void WaitIniSettingsSaveJob(ImGuiContext* ctx)
+{
+    while (ImAtomicLoad(&ctx->SettingsIniSaveBusy) != 0)
+        ImSleepMilliseconds(1);
+}
+
+// Copy the output of SaveIniSettingsToMemory() to g.SettingsIniSaveData, and the destination + temporary filenames to g.SettingsIniSaveFilenames
+static void PrepareIniSettingsSave(ImGuiContext* ctx, const char* ini_filename, const char* ini_data, size_t ini_data_size)
+{
+    ImGuiContext& g = *ctx;
+    g.SettingsIniSaveData.resize((int)ini_data_size);
+    memcpy(g.SettingsIniSaveData.Data, ini_data, ini_data_size);
+    const int filename_size = (int)strlen(ini_filename) + 1;
+    g.SettingsIniSaveFilenames.resize(filename_size * 2 + 4);
+    memcpy(g.SettingsIniSaveFilenames.Data, ini_filename, (size_t)filename_size);
+    memcpy(g.SettingsIniSaveFilenames.Data + filename_size, ini_filename, (size_t)filename_size - 1);
+    memcpy(g.SettingsIniSaveFilenames.Data + filename_size * 2 - 1, ".tmp", 5);
+}
+
+// Write to a temporary file then rename it over the destination, so an interrupted save never leaves a truncated .ini file.
+// Only reads g.SettingsIniSaveData and g.SettingsIniSaveFilenames, so this may run on another thread.
+static void WriteIniSettingsSave(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    const char* ini_filename = g.SettingsIniSaveFilenames.Data;
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    const char* write_filename = ini_filename + strlen(ini_filename) + 1;
+#else
+    const char* write_filename = ini_filename; // No ImFileRename() with user-provided file functions: write in place
+#endif
+    ImFileHandle f = ImFileOpen(write_filename, "wt");
+    if (!f)
+        return;
+    const size_t ini_data_size = (size_t)g.SettingsIniSaveData.Size;
+    const bool ok = ImFileWrite(g.SettingsIniSaveData.Data, sizeof(char), ini_data_size, f) == ini_data_size;
+    if (!ImFileClose(f) || !ok)
+        return;
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    ImFileRename(write_filename, ini_filename);
+#endif
+}
+
+static void SaveIniSettingsJobFunc(void* data)
+{
+    ImGuiContext* ctx = (ImGuiContext*)data;
+    WriteIniSettingsSave(ctx);
+    ImAtomicStore(&ctx->SettingsIniSaveBusy, 0);
+}
+
 void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 {
     ImGuiContext& g = *GImGui;
@@ -11672,18 +12672,38 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
-    ImFileHandle f = ImFileOpen(ini_filename, "wt");
-    if (!f)
-        return;
-    ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
-    ImFileClose(f);
+    WaitIniSettingsSaveJob(&g);
+    PrepareIniSettingsSave(&g, ini_filename, ini_data, ini_data_size);
+    WriteIniSettingsSave(&g);
+}
+
+// Same as SaveIniSettingsToDisk() but the file is written by io.IniSavingAsyncFn(): the UI thread only serializes and copies the settings.
+bool ImGui::SaveIniSettingsToDiskAsync(const char* ini_filename)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.IO.IniSavingAsyncFn != NULL);
+    if (ImAtomicLoad(&g.SettingsIniSaveBusy) != 0)
+        return false;
+    g.SettingsDirtyTimer = 0.0f;
+    if (!ini_filename)
+        return true;
+
+    size_t ini_data_size = 0;
+    const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
+    PrepareIniSettingsSave(&g, ini_filename, ini_data, ini_data_size);
+    ImAtomicStore(&g.SettingsIniSaveBusy, 1);
+    g.IO.IniSavingAsyncFn(SaveIniSettingsJobFunc, &g, g.IO.IniSavingAsyncUserData);
+    return true;
 }
 
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
+// The previous output is kept in g.SettingsIniDataPrev so handlers can copy their unchanged entries from it (see AppendIniSettingsCache()).
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
     ImGuiContext& g = *GImGui;
     g.SettingsDirtyTimer = 0.0f;
+    g.SettingsIniData.Buf.swap(g.SettingsIniDataPrev.Buf);
+    g.SettingsIniSaveCount++;
     g.SettingsIniData.Buf.resize(0);
     g.SettingsIniData.Buf.push_back(0);
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
@@ -11696,12 +12716,197 @@ const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
     return g.SettingsIniData.c_str();
 }
 
+bool ImGui::AppendIniSettingsCache(ImGuiSettingsIniCache* cache, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *GImGui;
+    if (buf != &g.SettingsIniData || cache->Size == 0 || cache->SaveCount != g.SettingsIniSaveCount - 1)
+        return false;
+    const char* entry_begin = g.SettingsIniDataPrev.begin() + cache->Offset;
+    cache->Offset = buf->size();
+    cache->SaveCount = g.SettingsIniSaveCount;
+    buf->append(entry_begin, entry_begin + cache->Size);
+    return true;
+}
+
+void ImGui::UpdateIniSettingsCache(ImGuiSettingsIniCache* cache, ImGuiTextBuffer* buf, int entry_begin)
+{
+    ImGuiContext& g = *GImGui;
+    cache->Offset = entry_begin;
+    cache->Size = (buf == &g.SettingsIniData) ? buf->size() - entry_begin : 0;
+    cache->SaveCount = g.SettingsIniSaveCount;
+}
+
+// Binary settings data:
+//   Header: ImU32 magic, ImU32 version, ImU32 blocks count
+//   Blocks: ImGuiID handler TypeHash, ImU32 size, then 'size' bytes written by the handler WriteBinaryFn (padded to 4 bytes)
+// Blocks written with AppendBinarySettingsRecords() are: ImU32 records count, ImU32 extra size, records sorted by ID, extra data.
+static const ImU32 IMGUI_SETTINGS_BINARY_MAGIC = 0x42494D49; // "IMIB"
+static const ImU32 IMGUI_SETTINGS_BINARY_VERSION = 2;
+
+// Zero-tolerance: invalid data or blocks are ignored.
+// Handlers only validate and reference their block here, so the cost doesn't depend on the number of entries.
+void ImGui::LoadIniSettingsFromBinary(const void* data, size_t data_size)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    IM_ASSERT(((size_t)data & 3) == 0 && "Binary settings data must be 4-bytes aligned.");
+    g.SettingsLoaded = true;
+
+    const ImU32* header = (const ImU32*)data;
+    if (data == NULL || data_size < 3 * sizeof(ImU32) || header[0] != IMGUI_SETTINGS_BINARY_MAGIC || header[1] != IMGUI_SETTINGS_BINARY_VERSION)
+        return;
+    g.SettingsBinaryLoadedData = data;
+
+    // Call pre-read handlers
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        if (g.SettingsHandlers[handler_n].ReadInitFn)
+            g.SettingsHandlers[handler_n].ReadInitFn(&g, &g.SettingsHandlers[handler_n]);
+
+    // Every handler with a ReadBinaryFn is called once, with NULL if there is no block for it
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+    {
+        ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
+        if (handler->ReadBinaryFn == NULL)
+            continue;
+        const char* block_data = NULL;
+        size_t block_size = 0;
+        size_t offset = 3 * sizeof(ImU32);
+        for (ImU32 block_n = 0; block_n < header[2] && offset + 2 * sizeof(ImU32) <= data_size; block_n++)
+        {
+            const ImU32* block_header = (const ImU32*)((const char*)data + offset);
+            offset += 2 * sizeof(ImU32);
+            if (block_header[1] > data_size - offset)
+                break;
+            if (block_header[0] == handler->TypeHash)
+            {
+                block_data = (const char*)data + offset;
+                block_size = block_header[1];
+                break;
+            }
+            offset += (block_header[1] + 3) & ~3;
+        }
+        handler->ReadBinaryFn(&g, handler, block_data, block_size);
+    }
+
+    // Call post-read handlers
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        if (g.SettingsHandlers[handler_n].ApplyAllFn)
+            g.SettingsHandlers[handler_n].ApplyAllFn(&g, &g.SettingsHandlers[handler_n]);
+}
+
+// Call registered handlers with a WriteBinaryFn to write their block
+const void* ImGui::SaveIniSettingsToBinary(size_t* out_data_size)
+{
+    ImGuiContext& g = *GImGui;
+    g.SettingsDirtyTimer = 0.0f;
+
+    // Our previous output may have been loaded back, in which case handlers are still referencing it
+    if (g.SettingsBinaryLoadedData != NULL && g.SettingsBinaryLoadedData == g.SettingsBinaryData.Data)
+        g.SettingsBinaryData.swap(g.SettingsBinaryDataPrev);
+
+    ImVector<char>& buf = g.SettingsBinaryData;
+    buf.resize(3 * sizeof(ImU32));
+    ImU32 blocks_count = 0;
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+    {
+        ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
+        if (handler->WriteBinaryFn == NULL)
+            continue;
+        const int block_offset = buf.Size;
+        buf.resize(block_offset + 2 * (int)sizeof(ImU32));
+        handler->WriteBinaryFn(&g, handler, &buf);
+        const int block_size = buf.Size - block_offset - 2 * (int)sizeof(ImU32);
+        buf.resize(buf.Size + ((4 - (block_size & 3)) & 3), 0);
+        ImU32* block_header = (ImU32*)(void*)(buf.Data + block_offset);
+        block_header[0] = handler->TypeHash;
+        block_header[1] = (ImU32)block_size;
+        blocks_count++;
+    }
+    ImU32* header = (ImU32*)(void*)buf.Data;
+    header[0] = IMGUI_SETTINGS_BINARY_MAGIC;
+    header[1] = IMGUI_SETTINGS_BINARY_VERSION;
+    header[2] = blocks_count;
+    if (out_data_size)
+        *out_data_size = (size_t)buf.Size;
+    return buf.Data;
+}
+
+// Binary search (records are sorted by ID)
+const void* ImGuiSettingsBinaryRecords::Find(ImGuiID id) const
+{
+    int first = 0;
+    int count = Count;
+    while (count > 0)
+    {
+        const int count2 = count >> 1;
+        const ImGuiID mid_id = *(const ImGuiID*)(const void*)(Data + (first + count2) * Stride);
+        if (mid_id < id)
+        {
+            first += count2 + 1;
+            count -= count2 + 1;
+        }
+        else
+        {
+            count = count2;
+        }
+    }
+    if (first < Count)
+    {
+        const char* record = Data + first * Stride;
+        if (*(const ImGuiID*)(const void*)record == id)
+            return record;
+    }
+    return NULL;
+}
+
+bool ImGui::BeginBinarySettingsRecords(ImGuiSettingsBinaryRecords* records, const void* data, size_t data_size, int stride)
+{
+    records->Clear();
+    if (data == NULL || data_size < 2 * sizeof(ImU32))
+        return false;
+    const ImU32* header = (const ImU32*)data;
+    const size_t records_size = data_size - 2 * sizeof(ImU32);
+    if (header[0] > records_size / (size_t)stride || header[1] > records_size - header[0] * (size_t)stride)
+        return false;
+    records->Data = (const char*)data + 2 * sizeof(ImU32);
+    records->Count = (int)header[0];
+    records->Stride = stride;
+    records->Extra = records->Data + records->Count * stride;
+    records->ExtraSize = (int)header[1];
+    return true;
+}
+
+int ImGui::AppendBinarySettingsRecords(ImVector<char>* buf, int count, int stride, int extra_size)
+{
+    IM_ASSERT((buf->Size & 3) == 0 && (stride & 3) == 0);
+    const int offset = buf->Size;
+    buf->resize(offset + 2 * (int)sizeof(ImU32) + count * stride + extra_size);
+    ImU32* header = (ImU32*)(void*)(buf->Data + offset);
+    header[0] = (ImU32)count;
+    header[1] = (ImU32)extra_size;
+    return offset + 2 * (int)sizeof(ImU32);
+}
+
+static int IMGUI_CDECL BinarySettingsRecordComparerByID(const void* lhs, const void* rhs)
+{
+    const ImGuiID lhs_id = *(const ImGuiID*)lhs;
+    const ImGuiID rhs_id = *(const ImGuiID*)rhs;
+    return (lhs_id > rhs_id) ? +1 : (lhs_id < rhs_id) ? -1 : 0;
+}
+
+void ImGui::SortBinarySettingsRecords(ImVector<char>* buf, int records_offset, int count, int stride)
+{
+    ImQsort(buf->Data + records_offset, (size_t)count, (size_t)stride, BinarySettingsRecordComparerByID);
+}
+
 static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
 {
     ImGuiContext& g = *ctx;
     for (int i = 0; i != g.Windows.Size; i++)
         g.Windows[i]->SettingsOffset = -1;
     g.SettingsWindows.clear();
+    g.SettingsWindowsMap.Clear();
+    g.SettingsWindowsBinary.Clear();
 }
 
 static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
@@ -11737,10 +12942,10 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
-static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather data from windows that were active during this session
+// (if a window wasn't opened in this session we preserve its settings)
+static void WindowSettingsHandler_UpdateFromWindows(ImGuiContext* ctx)
 {
-    // Gather data from windows that were active during this session
-    // (if a window wasn't opened in this session we preserve its settings)
     ImGuiContext& g = *ctx;
     for (int i = 0; i != g.Windows.Size; i++)
     {
@@ -11755,23 +12960,124 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
             window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
         }
         IM_ASSERT(settings->ID == window->ID);
-        settings->Pos = ImVec2ih(window->Pos);
-        settings->Size = ImVec2ih(window->SizeFull);
+        const ImVec2ih pos(window->Pos);
+        const ImVec2ih size(window->SizeFull);
+        if (settings->Pos.x != pos.x || settings->Pos.y != pos.y || settings->Size.x != size.x || settings->Size.y != size.y || settings->Collapsed != window->Collapsed)
+            settings->IniCache.Size = 0;
+        settings->Pos = pos;
+        settings->Size = size;
 
         settings->Collapsed = window->Collapsed;
     }
+}
+
+static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_UpdateFromWindows(ctx);
+    WindowSettingsUnpackAllBinary(ctx); // Text output has every entry
 
-    // Write to text buffer
+    // Write to text buffer (copying entries that haven't changed since the last save)
     buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
     {
+        if (ImGui::AppendIniSettingsCache(&settings->IniCache, buf))
+            continue;
+        const int entry_begin = buf->size();
         const char* settings_name = settings->GetName();
         buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
         buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
         buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
         buf->appendf("Collapsed=%d\n", settings->Collapsed);
         buf->append("\n");
+        ImGui::UpdateIniSettingsCache(&settings->IniCache, buf, entry_begin);
+    }
+}
+
+static void WindowSettingsHandler_ReadBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, const void* data, size_t data_size)
+{
+    // Unpack what is left of previously loaded data, which may not stay valid
+    ImGuiContext& g = *ctx;
+    WindowSettingsUnpackAllBinary(ctx);
+
+    ImGuiSettingsBinaryRecords* binary = &g.SettingsWindowsBinary;
+    if (!ImGui::BeginBinarySettingsRecords(binary, data, data_size, sizeof(ImGuiWindowSettingsRecord)))
+        return;
+    if (binary->Count > 0 && (binary->ExtraSize == 0 || binary->Extra[binary->ExtraSize - 1] != 0)) // Names must be zero-terminated
+    {
+        binary->Clear();
+        return;
+    }
+
+    // Override existing settings (as LoadIniSettingsFromMemory() does), and unpack settings of existing windows so ApplyAll applies them
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+        if (const ImGuiWindowSettingsRecord* record = (const ImGuiWindowSettingsRecord*)binary->Find(settings->ID))
+        {
+            settings->Pos = record->Pos;
+            settings->Size = record->Size;
+            settings->Collapsed = (record->Collapsed != 0);
+            settings->WantApply = true;
+            settings->IniCache.Size = 0;
+        }
+    for (int i = 0; i != g.Windows.Size; i++)
+        if (g.Windows[i]->SettingsOffset == -1 && !(g.Windows[i]->Flags & ImGuiWindowFlags_NoSavedSettings))
+            if (ImGuiWindowSettings* settings = ImGui::FindWindowSettings(g.Windows[i]->ID))
+                settings->WantApply = true;
+}
+
+static void WindowSettingsHandler_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImVector<char>* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_UpdateFromWindows(ctx);
+
+    // Records come from settings entries, and from loaded binary data for windows which haven't been submitted
+    const ImGuiSettingsBinaryRecords* binary = &g.SettingsWindowsBinary;
+    int count = 0;
+    int names_size = 0;
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings), count++)
+        names_size += (int)strlen(settings->GetName()) + 1;
+    for (int n = 0; n < binary->Count; n++)
+    {
+        const ImGuiWindowSettingsRecord* record = (const ImGuiWindowSettingsRecord*)(binary->Data + n * binary->Stride);
+        if (g.SettingsWindowsMap.GetInt(record->ID, 0) == 0 && record->NameOffset < (ImU32)binary->ExtraSize)
+        {
+            names_size += (int)strlen(binary->Extra + record->NameOffset) + 1;
+            count++;
+        }
+    }
+
+    const int records_offset = ImGui::AppendBinarySettingsRecords(buf, count, sizeof(ImGuiWindowSettingsRecord), names_size);
+    ImGuiWindowSettingsRecord* records = (ImGuiWindowSettingsRecord*)(void*)(buf->Data + records_offset);
+    ImGuiWindowSettingsRecord* dst = records;
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings), dst++)
+    {
+        memset(dst, 0, sizeof(*dst));
+        dst->ID = settings->ID;
+        dst->Pos = settings->Pos;
+        dst->Size = settings->Size;
+        dst->Collapsed = settings->Collapsed ? 1 : 0;
+    }
+    for (int n = 0; n < binary->Count; n++)
+    {
+        const ImGuiWindowSettingsRecord* record = (const ImGuiWindowSettingsRecord*)(binary->Data + n * binary->Stride);
+        if (g.SettingsWindowsMap.GetInt(record->ID, 0) == 0 && record->NameOffset < (ImU32)binary->ExtraSize)
+            *dst++ = *record; // Keep NameOffset in the loaded data for now
+    }
+
+    // Write names in records order so equal settings always give the same output
+    ImGui::SortBinarySettingsRecords(buf, records_offset, count, sizeof(ImGuiWindowSettingsRecord));
+    char* names = (char*)(records + count);
+    int name_offset = 0;
+    for (int n = 0; n < count; n++)
+    {
+        const int settings_offset = g.SettingsWindowsMap.GetInt(records[n].ID, 0);
+        const char* name = settings_offset ? g.SettingsWindows.ptr_from_offset(settings_offset)->GetName() : binary->Extra + records[n].NameOffset;
+        const int name_size = (int)strlen(name) + 1;
+        memcpy(names + name_offset, name, name_size);
+        records[n].NameOffset = (ImU32)name_offset;
+        name_offset += name_size;
     }
+    IM_ASSERT(name_offset == names_size);
 }
 
 
@@ -12103,6 +13409,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     Text("%d visible windows, %d active allocations", io.MetricsRenderWindows, io.MetricsActiveAllocations);
+    if (io.MetricsDrawListCacheHits + io.MetricsDrawListCacheMisses > 0)
+        Text("%d cached draw lists reused, %d rebuilt, %d errors", io.MetricsDrawListCacheHits, io.MetricsDrawListCacheMisses, io.MetricsDrawListCacheErrors);
+    if (io.ConfigGlyphRunCacheBudget > 0)
+        Text("Glyph run cache: %d hits, %d misses, %d/%d bytes", io.MetricsGlyphRunCacheHits, io.MetricsGlyphRunCacheMisses, io.MetricsGlyphRunCacheMemory, io.ConfigGlyphRunCacheBudget);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -12352,6 +13662,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         else
             TextUnformatted("<NULL>");
         Text("SettingsDirtyTimer %.2f", g.SettingsDirtyTimer);
+        Text("Binary data loaded: %d windows, %d tables (unpacked on use)", g.SettingsWindowsBinary.Count, g.SettingsTablesBinary.Count);
         if (TreeNode("SettingsHandlers", "Settings handlers: (%d)", g.SettingsHandlers.Size))
         {
             for (int n = 0; n < g.SettingsHandlers.Size; n++)
@@ -12738,7 +14049,7 @@ void ImGui::DebugNodeFont(ImFont* font)
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
-    if (!TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+    if (!TreeNode(label, "%s: %d entries, %d bytes%s", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->HashIndex.size_in_bytes(), storage->UseHashIndex ? " (hash index)" : ""))
         return;
     for (int n = 0; n < storage->Data.Size; n++)
     {
@@ -12835,6 +14146,11 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
 
     ImGuiWindowFlags flags = window->Flags;
     DebugNodeDrawList(window, window->DrawList, "DrawList");
+    if (window->DrawListCache)
+    {
+        DebugNodeDrawList(window, window->DrawListCache, "DrawListCache");
+        BulletText("DrawListCache: Hash 0x%08X, Stable: %d, Skipping: %d", window->DrawListCacheHash, window->DrawListCacheStable, window->DrawListCacheSkipping);
+    }
     BulletText("Pos: (%.1f,%.1f), Size: (%.1f,%.1f), ContentSize (%.1f,%.1f) Ideal (%.1f,%.1f)", window->Pos.x, window->Pos.y, window->Size.x, window->Size.y, window->ContentSize.x, window->ContentSize.y, window->ContentSizeIdeal.x, window->ContentSizeIdeal.y);
     BulletText("Flags: 0x%08X (%s%s%s%s%s%s%s%s%s..)", flags,
         (flags & ImGuiWindowFlags_ChildWindow)  ? "Child " : "",      (flags & ImGuiWindowFlags_Tooltip)     ? "Tooltip "   : "",  (flags & ImGuiWindowFlags_Popup) ? "Popup " : "",
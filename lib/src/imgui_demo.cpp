@@ -874,6 +874,73 @@ static void ShowDemoWindowWidgets()
                 ImGui::Indent(ImGui::GetTreeNodeToLabelSpacing());
             ImGui::TreePop();
         }
+
+        IMGUI_DEMO_MARKER("Widgets/Trees/Virtual tree");
+        if (ImGui::TreeNode("Virtual tree"))
+        {
+            HelpMarker(
+                "ImGuiVirtualTree displays a hierarchy of 1010100 nodes (100 drives of 100 folders of 100 files), "
+                "reading nodes through callbacks and only submitting the visible tree nodes.\n"
+                "Opening a node only reads its children. Use the arrow keys to navigate, Left jumps back to the parent node.");
+
+            // Nodes are made of their level (0 for the root) and their index in the level: the children of node N are N*100..N*100+99
+            struct Funcs
+            {
+                static int      GetLevel(ImU64 node)                            { return (int)(node >> 32); }
+                static int      GetIndex(ImU64 node)                            { return (int)(node & 0xFFFFFFFF); }
+                static ImU64    MakeNode(int level, int index)                  { return ((ImU64)level << 32) | (ImU64)index; }
+                static int      GetChildrenCount(ImU64 node, void*)             { return GetLevel(node) < 3 ? 100 : 0; }
+                static ImU64    GetChild(ImU64 node, int child_n, void*)        { return MakeNode(GetLevel(node) + 1, GetIndex(node) * 100 + child_n); }
+                static bool     IsLeaf(ImU64 node, void*)                       { return GetLevel(node) == 3; }
+                static bool     IsSelected(ImU64 node, void* user_data)         { return node == *(ImU64*)user_data; }
+                static const char* GetLabel(ImU64 node, void*)
+                {
+                    static char label[32];
+                    static const char* level_names[] = { "Root", "Drive", "Folder", "File" };
+                    snprintf(label, IM_ARRAYSIZE(label), "%s %d", level_names[GetLevel(node)], GetIndex(node));
+                    return label;
+                }
+            };
+            static ImGuiVirtualTree tree;
+            static ImU64 selected_node = 0;
+            if (tree.GetLabelFn == NULL)
+            {
+                tree.GetChildrenCountFn = Funcs::GetChildrenCount;
+                tree.GetChildFn = Funcs::GetChild;
+                tree.GetLabelFn = Funcs::GetLabel;
+                tree.IsLeafFn = Funcs::IsLeaf;
+                tree.IsSelectedFn = Funcs::IsSelected;
+                tree.UserData = &selected_node;
+                tree.RootNode = Funcs::MakeNode(0, 0);
+            }
+
+            static int scroll_to_file = 424242;
+            ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+            ImGui::DragInt("##file", &scroll_to_file, 100.0f, 0, 100 * 100 * 100 - 1, "File %d", ImGuiSliderFlags_AlwaysClamp);
+            ImGui::SameLine();
+            if (ImGui::Button("Scroll to file"))
+            {
+                ImU64 path[3] = { Funcs::MakeNode(1, scroll_to_file / 10000), Funcs::MakeNode(2, scroll_to_file / 100), Funcs::MakeNode(3, scroll_to_file) };
+                tree.ScrollToNode(path, 3);
+                selected_node = path[2];
+            }
+            ImGui::SameLine();
+            ImGui::Text("%d rows", tree.Rows.Size);
+
+            const ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_NavLeftJumpsBackHere;
+            if (ImGui::BeginChild("##tree", ImVec2(0.0f, ImGui::GetFontSize() * 20), true))
+            {
+                if (tree.Begin("##tree", flags))
+                {
+                    while (tree.Step())
+                        if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen())
+                            selected_node = tree.Node;
+                    tree.End();
+                }
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
         ImGui::TreePop();
     }
 
@@ -1693,6 +1760,29 @@ static void ShowDemoWindowWidgets()
         ImGui::PlotHistogram("Histogram", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::Separator();
 
+        // Use ImGuiPlotBuffer for very large number of values: each pixel column shows the min/max of its values,
+        // so rare spikes are never missed, and the cost doesn't depend on the number of values.
+        IMGUI_DEMO_MARKER("Widgets/Plotting/ImGuiPlotBuffer");
+        static ImGuiPlotBuffer buffer;
+        if (buffer.GetCapacity() == 0)
+            buffer.Init(1000000);
+        if (animate || buffer.Count == 0)
+        {
+            static float phase = 0.0f;
+            static unsigned int seed = 1;
+            float samples[1000];
+            for (int n = 0; n < IM_ARRAYSIZE(samples); n++, phase += 0.0001f)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                samples[n] = sinf(phase) + (float)(seed >> 24) / 2560.0f + (((seed >> 8) & 0xFFFF) == 0 ? 1.0f : 0.0f);
+            }
+            buffer.Append(samples, IM_ARRAYSIZE(samples));
+        }
+        char buffer_overlay[32];
+        sprintf(buffer_overlay, "%d values", buffer.Count);
+        ImGui::PlotLines("Buffer", &buffer, buffer_overlay, FLT_MAX, FLT_MAX, ImVec2(0, 80.0f));
+        ImGui::Separator();
+
         // Animate a simple progress bar
         IMGUI_DEMO_MARKER("Widgets/Plotting/ProgressBar");
         static float progress = 0.0f, progress_dir = 1.0f;
@@ -4310,6 +4400,65 @@ static void ShowDemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Vertical scrolling, with variable height rows");
+    if (ImGui::TreeNode("Vertical scrolling, with variable height rows"))
+    {
+        HelpMarker("Using ImGuiListClipper::BeginVariableHeight() to virtualize rows of different heights.\n\nThe height of each row is measured when it is first displayed, rows not displayed yet use an estimated height.");
+        static ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable;
+        static ImVector<bool> rows_expanded;
+        static int scroll_to_row = 50000;
+        bool scroll_to_row_requested = false;
+        if (rows_expanded.Size == 0)
+            rows_expanded.resize(100000, false);
+
+        PushStyleCompact();
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+        ImGui::InputInt("##row", &scroll_to_row);
+        scroll_to_row = IM_CLAMP(scroll_to_row, 0, rows_expanded.Size - 1);
+        ImGui::SameLine();
+        scroll_to_row_requested = ImGui::Button("Scroll to row");
+        PopStyleCompact();
+
+        ImVec2 outer_size = ImVec2(0.0f, TEXT_BASE_HEIGHT * 12);
+        if (ImGui::BeginTable("table_scrolly_variable", 2, flags, outer_size))
+        {
+            ImGui::TableSetupScrollFreeze(0, 1); // Make top row always visible
+            ImGui::TableSetupColumn("Row", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Contents", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableHeadersRow();
+
+            ImGuiListClipper clipper;
+            clipper.BeginVariableHeight("rows", rows_expanded.Size);
+            if (scroll_to_row_requested)
+                clipper.ForceDisplayRangeByIndices(scroll_to_row, scroll_to_row + 1);
+            while (clipper.Step())
+            {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    ImGui::PushID(row);
+                    ImGui::TableNextRow();
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::Checkbox("##expand", &rows_expanded[row]);
+                    ImGui::SameLine();
+                    ImGui::Text("%d", row);
+                    ImGui::TableSetColumnIndex(1);
+                    const int lines_count = 1 + (row % 3);
+                    for (int line = 0; line < lines_count; line++)
+                        ImGui::Text("Row %d, line %d", row, line);
+                    if (rows_expanded[row])
+                        ImGui::TextWrapped("Expanded contents: the quick brown fox jumps over the lazy dog, then sits down for a while and watches the clouds go by.");
+                    if (scroll_to_row_requested && row == scroll_to_row)
+                        ImGui::SetScrollHereY(0.0f);
+                    ImGui::PopID();
+                }
+            }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+
     if (open_action != -1)
         ImGui::SetNextItemOpen(open_action != 0);
     IMGUI_DEMO_MARKER("Tables/Horizontal scrolling");
@@ -5113,6 +5262,90 @@ static void ShowDemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Sorting and filtering with an index view");
+    if (ImGui::TreeNode("Sorting and filtering with an index view"))
+    {
+        HelpMarker(
+            "ImGuiTableIndexView keeps a sorted and filtered list of row indices, leaving your data in place.\n"
+            "Typing more characters in the filter only re-tests the rows that passed, and added rows are merged "
+            "in the sorted view without sorting everything again.");
+
+        // Our data is never reordered: the view only refers to items by index
+        struct Funcs
+        {
+            static int CompareRows(const ImGuiTableColumnSortSpecs* spec, int row_a, int row_b, void* user_data)
+            {
+                const MyItem* a = &(*(ImVector<MyItem>*)user_data)[row_a];
+                const MyItem* b = &(*(ImVector<MyItem>*)user_data)[row_b];
+                switch (spec->ColumnUserID)
+                {
+                case MyItemColumnID_ID:         return a->ID - b->ID;
+                case MyItemColumnID_Name:       return strcmp(a->Name, b->Name);
+                case MyItemColumnID_Quantity:   return a->Quantity - b->Quantity;
+                default: IM_ASSERT(0); return 0;
+                }
+            }
+            static const char* GetRowText(int row, void* user_data) { return (*(ImVector<MyItem>*)user_data)[row].Name; }
+        };
+        static ImVector<MyItem> items;
+        static ImGuiTableIndexView view;
+        static ImGuiTextFilter filter;
+        if (view.CompareFn == NULL)
+        {
+            view.CompareFn = Funcs::CompareRows;
+            view.GetRowTextFn = Funcs::GetRowText;
+            view.UserData = &items;
+        }
+        if (items.Size == 0 || ImGui::Button("Add 1000 items"))
+        {
+            const int add_count = (items.Size == 0) ? 10000 : 1000;
+            for (int n = 0; n < add_count; n++)
+            {
+                MyItem item;
+                item.ID = items.Size;
+                item.Name = template_items_names[(item.ID * 7) % IM_ARRAYSIZE(template_items_names)];
+                item.Quantity = (item.ID * item.ID - item.ID) % 20;
+                items.push_back(item);
+            }
+            view.AddRows(add_count);
+        }
+        ImGui::SameLine();
+        filter.Draw("Filter", -FLT_MIN);
+
+        const ImGuiTableFlags flags = ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY;
+        if (ImGui::BeginTable("table_index_view", 3, flags, ImVec2(0.0f, TEXT_BASE_HEIGHT * 15), 0.0f))
+        {
+            ImGui::TableSetupColumn("ID",       ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_WidthFixed,   0.0f, MyItemColumnID_ID);
+            ImGui::TableSetupColumn("Name",                                         ImGuiTableColumnFlags_WidthFixed,   0.0f, MyItemColumnID_Name);
+            ImGui::TableSetupColumn("Quantity",                                     ImGuiTableColumnFlags_WidthStretch, 0.0f, MyItemColumnID_Quantity);
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableHeadersRow();
+
+            // Apply sort specs, filter and added rows
+            view.Update(&filter);
+
+            ImGuiListClipper clipper;
+            clipper.Begin(view.Rows.Size);
+            while (clipper.Step())
+                for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                {
+                    const MyItem* item = &items[view.Rows[row_n]];
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%04d", item->ID);
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(item->Name);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d", item->Quantity);
+                }
+            ImGui::EndTable();
+        }
+        ImGui::Text("%d/%d items", view.Rows.Size, items.Size);
+        ImGui::TreePop();
+    }
+
     // In this example we'll expose most table flags and settings.
     // For specific flags and settings refer to the corresponding section for more detailed explanation.
     // This section is mostly useful to experiment with combining certain flags or settings with each others.
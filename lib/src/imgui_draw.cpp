@@ -39,6 +39,9 @@ Index of this file:
 #endif
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#if defined(_MSC_VER)
+#include <intrin.h>     // __cpuid, __cpuidex
+#endif
 #if !defined(alloca)
 #if defined(__GLIBC__) || defined(__sun) || defined(__APPLE__) || defined(__NEWLIB__)
 #include <alloca.h>     // alloca (glibc uses <alloca.h>. Note that Cygwin may have _WIN32 defined, so the order matters here)
@@ -381,6 +384,7 @@ ImDrawListSharedData::ImDrawListSharedData()
         ArcFastVtx[i] = ImVec2(ImCos(a), ImSin(a));
     }
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
+    SimdLevel = ImDrawGetMaxSimdLevel();
 }
 
 void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
@@ -420,6 +424,8 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = 1.0f;
+    _ContentHash = 0;
+    _PrimHashVtxStart = -1;
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -435,6 +441,7 @@ void ImDrawList::_ClearFreeMemory()
     _TextureIdStack.clear();
     _Path.clear();
     _Splitter.ClearFreeMemory();
+    _PrimHashVtxStart = -1;
 }
 
 ImDrawList* ImDrawList::CloneOutput() const
@@ -447,6 +454,135 @@ ImDrawList* ImDrawList::CloneOutput() const
     return dst;
 }
 
+// Must be called from the thread owning the ImGui context, after NewFrame(), as it uses the shared data setup for the frame.
+// Draw lists of windows using ImGuiWindowFlags_CacheDrawList hash the arguments of their draw calls along with the current render state
+// (ImDrawListFlags_HashContents), the result is compared with the previous frame output to decide if it can be reused (see AddWindowToDrawData()).
+// Only leaf functions emitting vertices are hashed, and the hash must not depend on whether geometry is being skipped.
+// Hashing happens for every draw call of cached windows, so fold in 4 bytes at a time with ImHashDataMurmur3() rather than going through ImHashData().
+// The hash is only ever compared with itself from one frame to the next, it doesn't need to match anything else.
+// Data written by user code through PrimReserve() is not known until the next hashing point, where it gets hashed first (see _HashPrimWrites()).
+static inline void DrawListHash(ImDrawList* draw_list, const void* data, size_t data_size)
+{
+    if (draw_list->_PrimHashVtxStart >= 0)
+        draw_list->_HashPrimWrites();
+    draw_list->_ContentHash = ImHashDataMurmur3(data, data_size, draw_list->_ContentHash);
+}
+
+// Hash vertices and indices written since the last PrimReserve() call made outside of a hashed draw call (e.g. ColorPicker4() SV triangle).
+// This includes later in-place edits such as ShadeVertsLinearColorGradientKeepAlpha(). Indices are hashed relative to the first vertex,
+// as _VtxCurrentIdx differs between frames emitting geometry and frames skipping it. Those writes are not skipped with ImDrawListFlags_SkipGeometry.
+void ImDrawList::_HashPrimWrites()
+{
+    IM_ASSERT(_PrimHashVtxStart >= 0);
+    const int vtx_start = ImMin(_PrimHashVtxStart, VtxBuffer.Size); // PrimUnreserve() may have given back some of the reservation
+    const int idx_start = ImMin(_PrimHashIdxStart, IdxBuffer.Size);
+    _PrimHashVtxStart = -1;
+    const int counts[2] = { VtxBuffer.Size - vtx_start, IdxBuffer.Size - idx_start };
+    _ContentHash = ImHashDataMurmur3(counts, sizeof(counts), _ContentHash);
+    _ContentHash = ImHashDataMurmur3(VtxBuffer.Data + vtx_start, (size_t)counts[0] * sizeof(ImDrawVert), _ContentHash);
+    for (int n = idx_start; n < IdxBuffer.Size; n++)
+    {
+        const unsigned int idx = (unsigned int)IdxBuffer.Data[n] - _PrimHashVtxBase;
+        _ContentHash = ImHashDataMurmur3(&idx, sizeof(idx), _ContentHash);
+    }
+}
+
+// Hash arguments of a draw call and current ClipRect/TextureId. Return true when the geometry should not be emitted (ImDrawListFlags_SkipGeometry).
+static bool DrawListHashCall(ImDrawList* draw_list, const void* args, size_t args_size)
+{
+    const ImDrawListFlags hashed_flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedFill;
+    struct { ImVec4 ClipRect; ImTextureID TextureId; ImDrawListFlags Flags; float FringeScale; } state;
+    memset(&state, 0, sizeof(state)); // Padding
+    state.ClipRect = draw_list->_CmdHeader.ClipRect;
+    state.TextureId = draw_list->_CmdHeader.TextureId;
+    state.Flags = draw_list->Flags & hashed_flags;
+    state.FringeScale = draw_list->_FringeScale;
+    DrawListHash(draw_list, &state, sizeof(state));
+    DrawListHash(draw_list, args, args_size);
+    return (draw_list->Flags & ImDrawListFlags_SkipGeometry) != 0;
+}
+
+void ImDrawList::ResetDetached()
+{
+    _ResetForNewFrame();
+    Flags &= ~ImDrawListFlags_GlyphRunCache; // Cache is not thread-safe
+    PushTextureID(_Data->Font->ContainerAtlas->TexID);
+    PushClipRectFullScreen();
+}
+
+// Append the output of another list: our vertices/indices buffers grow by the size of the source ones, commands are copied.
+// Indices are rebased onto our current VtxOffset when they remain addressable by ImDrawIdx, otherwise copied commands use
+// their own VtxOffset (which requires the renderer to set ImGuiBackendFlags_RendererHasVtxOffset, as for regular lists past 64K vertices).
+void ImDrawList::AddDrawList(const ImDrawList* src_list)
+{
+    IM_ASSERT(src_list != this && src_list->_Data == _Data && "Draw lists need to share the same ImDrawListSharedData!");
+    IM_ASSERT(src_list->_Splitter._Count <= 1 && "Merge channels of the source list first!");
+
+    if (Flags & ImDrawListFlags_HashContents)
+    {
+        DrawListHash(this, src_list->CmdBuffer.Data, (size_t)src_list->CmdBuffer.size_in_bytes());
+        DrawListHash(this, src_list->IdxBuffer.Data, (size_t)src_list->IdxBuffer.size_in_bytes());
+        if (DrawListHashCall(this, src_list->VtxBuffer.Data, (size_t)src_list->VtxBuffer.size_in_bytes()))
+            return;
+    }
+
+    _PopUnusedDrawCmd();
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const unsigned int vtx_base = (unsigned int)VtxBuffer.Size;
+    const unsigned int idx_base = (unsigned int)IdxBuffer.Size;
+    const unsigned int vtx_rebase = vtx_base - _CmdHeader.VtxOffset;
+    const bool rebase_indices = sizeof(ImDrawIdx) == 4 || vtx_rebase + (unsigned int)src_list->VtxBuffer.Size <= (1 << 16);
+    IM_ASSERT((rebase_indices || (Flags & ImDrawListFlags_AllowVtxOffset)) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
+
+    VtxBuffer.resize(VtxBuffer.Size + src_list->VtxBuffer.Size);
+    IdxBuffer.resize(IdxBuffer.Size + src_list->IdxBuffer.Size);
+    if (src_list->VtxBuffer.Size > 0)
+        memcpy(VtxBuffer.Data + vtx_base, src_list->VtxBuffer.Data, (size_t)src_list->VtxBuffer.Size * sizeof(ImDrawVert));
+    if (!rebase_indices && src_list->IdxBuffer.Size > 0)
+        memcpy(IdxBuffer.Data + idx_base, src_list->IdxBuffer.Data, (size_t)src_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+
+    for (int cmd_n = 0; cmd_n < src_list->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd* src_cmd = &src_list->CmdBuffer.Data[cmd_n];
+        if (src_cmd->ElemCount == 0 && src_cmd->UserCallback == NULL)
+            continue;
+        if (rebase_indices)
+        {
+            const ImDrawIdx* idx_read = src_list->IdxBuffer.Data + src_cmd->IdxOffset;
+            ImDrawIdx* idx_write = IdxBuffer.Data + idx_base + src_cmd->IdxOffset;
+            const unsigned int idx_add = vtx_rebase + src_cmd->VtxOffset;
+            for (unsigned int n = 0; n < src_cmd->ElemCount; n++)
+                idx_write[n] = (ImDrawIdx)(idx_read[n] + idx_add);
+        }
+
+        ImDrawCmd cmd = *src_cmd;
+        cmd.ClipRect.x = ImMax(cmd.ClipRect.x, clip_rect.x);
+        cmd.ClipRect.y = ImMax(cmd.ClipRect.y, clip_rect.y);
+        cmd.ClipRect.z = ImMax(cmd.ClipRect.x, ImMin(cmd.ClipRect.z, clip_rect.z));
+        cmd.ClipRect.w = ImMax(cmd.ClipRect.y, ImMin(cmd.ClipRect.w, clip_rect.w));
+        cmd.VtxOffset = rebase_indices ? _CmdHeader.VtxOffset : vtx_base + src_cmd->VtxOffset;
+        cmd.IdxOffset = idx_base + src_cmd->IdxOffset;
+        CmdBuffer.push_back(cmd);
+        if (CmdBuffer.Size > 1)
+            _TryMergeDrawCmds();
+    }
+
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+    if (rebase_indices)
+    {
+        _VtxCurrentIdx = vtx_rebase + (unsigned int)src_list->VtxBuffer.Size;
+    }
+    else
+    {
+        _CmdHeader.VtxOffset = VtxBuffer.Size;
+        _VtxCurrentIdx = 0;
+    }
+
+    // Ensure there's always a draw command with our current settings trailing the command-buffer
+    AddDrawCmd();
+}
+
 void ImDrawList::AddDrawCmd()
 {
     ImDrawCmd draw_cmd;
@@ -473,6 +609,11 @@ void ImDrawList::_PopUnusedDrawCmd()
 void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
 {
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
+    if (Flags & ImDrawListFlags_HashContents)
+    {
+        DrawListHash(this, &callback, sizeof(callback));
+        DrawListHashCall(this, &callback_data, sizeof(callback_data));
+    }
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     IM_ASSERT(curr_cmd->UserCallback == NULL);
     if (curr_cmd->ElemCount != 0)
@@ -629,6 +770,24 @@ void ImDrawList::PopTextureID()
 // You must finish filling your reserved data before calling PrimReserve() again, as it may reallocate or
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
+{
+    if (!(Flags & ImDrawListFlags_HashContents))
+    {
+        _PrimReserve(idx_count, vtx_count);
+        return;
+    }
+
+    // The data is not written yet: remember where it goes, it is hashed at the next hashing point
+    if (_PrimHashVtxStart >= 0)
+        _HashPrimWrites();
+    _PrimReserve(idx_count, vtx_count);
+    _PrimHashVtxStart = VtxBuffer.Size - vtx_count;
+    _PrimHashIdxStart = IdxBuffer.Size - idx_count;
+    _PrimHashVtxBase = _VtxCurrentIdx;
+}
+
+// Same as PrimReserve(), used by draw calls which hashed their arguments already when ImDrawListFlags_HashContents is set.
+void ImDrawList::_PrimReserve(int idx_count, int vtx_count)
 {
     // Large mesh support (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
@@ -716,12 +875,245 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// AddPolyline() helpers for anti-aliased lines, computing segment normals and offsetting points along averaged normals.
+// - The SSE2/AVX2 versions process 2/4 points per register stored as (x,y,x,y..) and run the same float operations as
+//   IM_NORMALIZE2F_OVER_ZERO()/IM_FIXNORMAL2F() in each lane (_mm_rsqrt_ps matches the _mm_rsqrt_ss used by ImRsqrt()),
+//   so all levels output the same vertices. Unless the compiler is allowed to contract mul+add into FMA differently for each.
+// - Vector versions return the index they stopped at, the scalar version finishes the remaining points.
+// - Offsets are written as 'N' points per input point: out[i * N + n] = points[i] + normal * scales[n].
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_DISABLE_AVX2) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define IMGUI_ENABLE_AVX2_DISPATCH
+#if defined(__GNUC__) || defined(__clang__)
+#define IM_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define IM_TARGET_AVX2
+#endif
+#endif
+
+ImDrawSimdLevel ImDrawGetMaxSimdLevel()
+{
+#ifdef IMGUI_ENABLE_AVX2_DISPATCH
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    const int max_leaf = info[0];
+    __cpuid(info, 1);
+    const bool os_avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && ((_xgetbv(0) & 0x06) == 0x06); // OSXSAVE, AVX, XMM/YMM state enabled by OS
+    bool has_avx2 = false;
+    if (os_avx && max_leaf >= 7)
+    {
+        __cpuidex(info, 7, 0);
+        has_avx2 = (info[1] & (1 << 5)) != 0;
+    }
+#else
+    const bool has_avx2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+    if (has_avx2)
+        return ImDrawSimdLevel_AVX2;
+#endif
+#ifdef IMGUI_ENABLE_SSE
+    return ImDrawSimdLevel_SSE2;
+#else
+    return ImDrawSimdLevel_Scalar;
+#endif
+}
+
+// Normals of segments [i_begin..i_end), segment i going from points[i] to points[i+1]
+static inline void PolylineNormals_Scalar(const ImVec2* points, ImVec2* normals, int i_begin, int i_end)
+{
+    for (int i1 = i_begin; i1 < i_end; i1++)
+    {
+        float dx = points[i1 + 1].x - points[i1].x;
+        float dy = points[i1 + 1].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        normals[i1].x = dy;
+        normals[i1].y = -dx;
+    }
+}
+
+// Offset points[i2] along the average of normals[i1] and normals[i2]
+template<int N>
+static inline void PolylineOffsetPoint_Scalar(const ImVec2* points, const ImVec2* normals, ImVec2* out, int i1, int i2, const float* scales)
+{
+    float dm_x = (normals[i1].x + normals[i2].x) * 0.5f;
+    float dm_y = (normals[i1].y + normals[i2].y) * 0.5f;
+    IM_FIXNORMAL2F(dm_x, dm_y);
+    ImVec2* out_vtx = &out[i2 * N];
+    for (int n = 0; n < N; n++)
+    {
+        out_vtx[n].x = points[i2].x + dm_x * scales[n];
+        out_vtx[n].y = points[i2].y + dm_y * scales[n];
+    }
+}
+
+#ifdef IMGUI_ENABLE_SSE
+static int PolylineNormals_SSE2(const ImVec2* points, ImVec2* normals, int i_begin, int i_end)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 sign_y = _mm_castsi128_ps(_mm_set_epi32((int)0x80000000, 0, (int)0x80000000, 0));
+    int i = i_begin;
+    for (; i + 2 <= i_end; i += 2)
+    {
+        __m128 d = _mm_sub_ps(_mm_loadu_ps(&points[i + 1].x), _mm_loadu_ps(&points[i].x));
+        __m128 sq = _mm_mul_ps(d, d);
+        __m128 d2 = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+        __m128 mask = _mm_cmpgt_ps(d2, zero);
+        d = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(d, _mm_rsqrt_ps(d2))), _mm_andnot_ps(mask, d));
+        _mm_storeu_ps(&normals[i].x, _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)), sign_y)); // (dx,dy) -> (dy,-dx)
+    }
+    return i;
+}
+
+template<int N>
+static int PolylineOffsets_SSE2(const ImVec2* points, const ImVec2* normals, ImVec2* out, int i_begin, int i_end, const float* scales)
+{
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 min_len2 = _mm_set1_ps(0.000001f);
+    const __m128 max_invlen2 = _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+    __m128 scale[N];
+    for (int n = 0; n < N; n++)
+        scale[n] = _mm_set1_ps(scales[n]);
+    int i2 = i_begin;
+    for (; i2 + 2 <= i_end; i2 += 2)
+    {
+        __m128 dm = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&normals[i2 - 1].x), _mm_loadu_ps(&normals[i2].x)), half);
+        __m128 sq = _mm_mul_ps(dm, dm);
+        __m128 d2 = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+        __m128 mask = _mm_cmpgt_ps(d2, min_len2);
+        __m128 inv_len2 = _mm_min_ps(_mm_div_ps(one, d2), max_invlen2);
+        dm = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(dm, inv_len2)), _mm_andnot_ps(mask, dm));
+        __m128 p = _mm_loadu_ps(&points[i2].x);
+        __m128 o[N];
+        for (int n = 0; n < N; n++)
+            o[n] = _mm_add_ps(p, _mm_mul_ps(dm, scale[n]));
+        float* dst = &out[i2 * N].x;
+        for (int n = 0; n < N; n += 2)
+        {
+            _mm_storeu_ps(dst + n * 2, _mm_movelh_ps(o[n], o[n + 1]));         // First point
+            _mm_storeu_ps(dst + n * 2 + N * 2, _mm_movehl_ps(o[n + 1], o[n])); // Second point
+        }
+    }
+    return i2;
+}
+#endif
+
+#ifdef IMGUI_ENABLE_AVX2_DISPATCH
+IM_TARGET_AVX2 static int PolylineNormals_AVX2(const ImVec2* points, ImVec2* normals, int i_begin, int i_end)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 sign_y = _mm256_castsi256_ps(_mm256_set_epi32((int)0x80000000, 0, (int)0x80000000, 0, (int)0x80000000, 0, (int)0x80000000, 0));
+    int i = i_begin;
+    for (; i + 4 <= i_end; i += 4)
+    {
+        __m256 d = _mm256_sub_ps(_mm256_loadu_ps(&points[i + 1].x), _mm256_loadu_ps(&points[i].x));
+        __m256 sq = _mm256_mul_ps(d, d);
+        __m256 d2 = _mm256_add_ps(sq, _mm256_permute_ps(sq, _MM_SHUFFLE(2, 3, 0, 1)));
+        __m256 mask = _mm256_cmp_ps(d2, zero, _CMP_GT_OQ);
+        d = _mm256_blendv_ps(d, _mm256_mul_ps(d, _mm256_rsqrt_ps(d2)), mask);
+        _mm256_storeu_ps(&normals[i].x, _mm256_xor_ps(_mm256_permute_ps(d, _MM_SHUFFLE(2, 3, 0, 1)), sign_y));
+    }
+    return i;
+}
+
+template<int N>
+IM_TARGET_AVX2 static int PolylineOffsets_AVX2(const ImVec2* points, const ImVec2* normals, ImVec2* out, int i_begin, int i_end, const float* scales)
+{
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 min_len2 = _mm256_set1_ps(0.000001f);
+    const __m256 max_invlen2 = _mm256_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+    __m256 scale[N];
+    for (int n = 0; n < N; n++)
+        scale[n] = _mm256_set1_ps(scales[n]);
+    int i2 = i_begin;
+    for (; i2 + 4 <= i_end; i2 += 4)
+    {
+        __m256 dm = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(&normals[i2 - 1].x), _mm256_loadu_ps(&normals[i2].x)), half);
+        __m256 sq = _mm256_mul_ps(dm, dm);
+        __m256 d2 = _mm256_add_ps(sq, _mm256_permute_ps(sq, _MM_SHUFFLE(2, 3, 0, 1)));
+        __m256 mask = _mm256_cmp_ps(d2, min_len2, _CMP_GT_OQ);
+        __m256 inv_len2 = _mm256_min_ps(_mm256_div_ps(one, d2), max_invlen2);
+        dm = _mm256_blendv_ps(dm, _mm256_mul_ps(dm, inv_len2), mask);
+        __m256 p = _mm256_loadu_ps(&points[i2].x);
+        __m256 o[N];
+        for (int n = 0; n < N; n++)
+            o[n] = _mm256_add_ps(p, _mm256_mul_ps(dm, scale[n]));
+
+        // Transpose from one register per offset (4 points) to N consecutive offsets per point
+        float* dst = &out[i2 * N].x;
+        if (N == 2)
+        {
+            __m256 lo = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(o[0]), _mm256_castps_pd(o[1]))); // Points 0,2
+            __m256 hi = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(o[0]), _mm256_castps_pd(o[1]))); // Points 1,3
+            _mm256_storeu_ps(dst + 0, _mm256_permute2f128_ps(lo, hi, 0x20));
+            _mm256_storeu_ps(dst + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+        }
+        else
+        {
+            for (int n = 0; n < N; n += 4)
+            {
+                __m256 lo01 = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(o[n + 0]), _mm256_castps_pd(o[n + 1])));
+                __m256 lo23 = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(o[n + 2]), _mm256_castps_pd(o[n + 3])));
+                __m256 hi01 = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(o[n + 0]), _mm256_castps_pd(o[n + 1])));
+                __m256 hi23 = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(o[n + 2]), _mm256_castps_pd(o[n + 3])));
+                _mm256_storeu_ps(dst + n * 2 + N * 0, _mm256_permute2f128_ps(lo01, lo23, 0x20));
+                _mm256_storeu_ps(dst + n * 2 + N * 2, _mm256_permute2f128_ps(hi01, hi23, 0x20));
+                _mm256_storeu_ps(dst + n * 2 + N * 4, _mm256_permute2f128_ps(lo01, lo23, 0x31));
+                _mm256_storeu_ps(dst + n * 2 + N * 6, _mm256_permute2f128_ps(hi01, hi23, 0x31));
+            }
+        }
+    }
+    return i2;
+}
+#endif
+
+static void PolylineNormals(ImDrawSimdLevel simd_level, const ImVec2* points, ImVec2* normals, int i_begin, int i_end)
+{
+    int i = i_begin;
+#ifdef IMGUI_ENABLE_AVX2_DISPATCH
+    if (simd_level >= ImDrawSimdLevel_AVX2)
+        i = PolylineNormals_AVX2(points, normals, i, i_end);
+#endif
+#ifdef IMGUI_ENABLE_SSE
+    if (simd_level >= ImDrawSimdLevel_SSE2)
+        i = PolylineNormals_SSE2(points, normals, i, i_end);
+#endif
+    IM_UNUSED(simd_level);
+    PolylineNormals_Scalar(points, normals, i, i_end);
+}
+
+// Offset points [i_begin..i_end) along the average of their previous and own segment normals (i_begin must be >= 1)
+template<int N>
+static void PolylineOffsets(ImDrawSimdLevel simd_level, const ImVec2* points, const ImVec2* normals, ImVec2* out, int i_begin, int i_end, const float* scales)
+{
+    int i2 = i_begin;
+#ifdef IMGUI_ENABLE_AVX2_DISPATCH
+    if (simd_level >= ImDrawSimdLevel_AVX2)
+        i2 = PolylineOffsets_AVX2<N>(points, normals, out, i2, i_end, scales);
+#endif
+#ifdef IMGUI_ENABLE_SSE
+    if (simd_level >= ImDrawSimdLevel_SSE2)
+        i2 = PolylineOffsets_SSE2<N>(points, normals, out, i2, i_end, scales);
+#endif
+    IM_UNUSED(simd_level);
+    for (; i2 < i_end; i2++)
+        PolylineOffsetPoint_Scalar<N>(points, normals, out, i2 - 1, i2, scales);
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
 {
     if (points_count < 2)
         return;
+    if (Flags & ImDrawListFlags_HashContents)
+    {
+        const struct { ImU32 Col; ImDrawFlags Flags; float Thickness; } args = { col, flags, thickness };
+        DrawListHash(this, points, points_count * sizeof(ImVec2));
+        if (DrawListHashCall(this, &args, sizeof(args)))
+            return;
+    }
 
     const bool closed = (flags & ImDrawFlags_Closed) != 0;
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
@@ -749,7 +1141,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
 
         const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
-        PrimReserve(idx_count, vtx_count);
+        _PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
         // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
@@ -757,17 +1149,20 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         ImVec2* temp_points = temp_normals + points_count;
 
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
+        const ImDrawSimdLevel simd_level = _Data->SimdLevel;
+        PolylineNormals(simd_level, points, temp_normals, 0, points_count - 1);
+        if (closed)
         {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
+            float dx = points[0].x - points[points_count - 1].x;
+            float dy = points[0].y - points[points_count - 1].y;
             IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
+            temp_normals[points_count - 1].x = dy;
+            temp_normals[points_count - 1].y = -dx;
         }
-        if (!closed)
+        else
+        {
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
+        }
 
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
         if (use_texture || !thick_line)
@@ -791,29 +1186,19 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Add temporary vertexes for the outer edges, offsetting each point along the average of its two segment normals
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
+            const float offset_scales[2] = { half_draw_size, -half_draw_size }; // Offset to the outer edge of the AA area
+            PolylineOffsets<2>(simd_level, points, temp_normals, temp_points, 1, points_count, offset_scales);
+            if (closed)
+                PolylineOffsetPoint_Scalar<2>(points, temp_normals, temp_points, points_count - 1, 0, offset_scales);
+
+            // Generate the indices to form a number of triangles for each line segment
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -887,35 +1272,20 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Add temporary vertices for the outer and inner edges, offsetting each point along the average of its two segment normals
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
+            const float offset_scales[4] = { half_inner_thickness + AA_SIZE, half_inner_thickness, -half_inner_thickness, -(half_inner_thickness + AA_SIZE) };
+            PolylineOffsets<4>(simd_level, points, temp_normals, temp_points, 1, points_count, offset_scales);
+            if (closed)
+                PolylineOffsetPoint_Scalar<4>(points, temp_normals, temp_points, points_count - 1, 0, offset_scales);
+
+            // Generate the indices to form a number of triangles for each line segment
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
@@ -945,7 +1315,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         // [PATH 4] Non texture-based, Non anti-aliased lines
         const int idx_count = count * 6;
         const int vtx_count = count * 4;    // FIXME-OPT: Not sharing edges
-        PrimReserve(idx_count, vtx_count);
+        _PrimReserve(idx_count, vtx_count);
 
         for (int i1 = 0; i1 < count; i1++)
         {
@@ -978,6 +1348,12 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
 {
     if (points_count < 3)
         return;
+    if (Flags & ImDrawListFlags_HashContents)
+    {
+        DrawListHash(this, points, points_count * sizeof(ImVec2));
+        if (DrawListHashCall(this, &col, sizeof(col)))
+            return;
+    }
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
 
@@ -988,7 +1364,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         const ImU32 col_trans = col & ~IM_COL32_A_MASK;
         const int idx_count = (points_count - 2)*3 + points_count * 6;
         const int vtx_count = (points_count * 2);
-        PrimReserve(idx_count, vtx_count);
+        _PrimReserve(idx_count, vtx_count);
 
         // Add indexes for fill
         unsigned int vtx_inner_idx = _VtxCurrentIdx;
@@ -1040,7 +1416,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         // Non Anti-aliased Fill
         const int idx_count = (points_count - 2)*3;
         const int vtx_count = points_count;
-        PrimReserve(idx_count, vtx_count);
+        _PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
         {
             _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
@@ -1407,7 +1783,13 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
         return;
     if (rounding <= 0.0f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
-        PrimReserve(6, 4);
+        if (Flags & ImDrawListFlags_HashContents)
+        {
+            const struct { ImVec2 Min, Max; ImU32 Col; } args = { p_min, p_max, col };
+            if (DrawListHashCall(this, &args, sizeof(args)))
+                return;
+        }
+        _PrimReserve(6, 4);
         PrimRect(p_min, p_max, col);
     }
     else
@@ -1422,9 +1804,15 @@ void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_ma
 {
     if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
         return;
+    if (Flags & ImDrawListFlags_HashContents)
+    {
+        const struct { ImVec2 Min, Max; ImU32 Cols[4]; } args = { p_min, p_max, { col_upr_left, col_upr_right, col_bot_right, col_bot_left } };
+        if (DrawListHashCall(this, &args, sizeof(args)))
+            return;
+    }
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
-    PrimReserve(6, 4);
+    _PrimReserve(6, 4);
     PrimWriteIdx((ImDrawIdx)(_VtxCurrentIdx)); PrimWriteIdx((ImDrawIdx)(_VtxCurrentIdx + 1)); PrimWriteIdx((ImDrawIdx)(_VtxCurrentIdx + 2));
     PrimWriteIdx((ImDrawIdx)(_VtxCurrentIdx)); PrimWriteIdx((ImDrawIdx)(_VtxCurrentIdx + 2)); PrimWriteIdx((ImDrawIdx)(_VtxCurrentIdx + 3));
     PrimWriteVtx(p_min, uv, col_upr_left);
@@ -1591,6 +1979,16 @@ void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos,
 
     IM_ASSERT(font->ContainerAtlas->TexID == _CmdHeader.TextureId);  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
 
+    if (Flags & ImDrawListFlags_HashContents)
+    {
+        const ImVec4 fine_clip_rect = cpu_fine_clip_rect ? *cpu_fine_clip_rect : ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
+        const struct { float FontSize; ImVec2 Pos; ImU32 Col; float WrapWidth; int FineClip; ImVec4 FineClipRect; } args = { font_size, pos, col, wrap_width, cpu_fine_clip_rect != NULL, fine_clip_rect };
+        DrawListHash(this, &font, sizeof(font));
+        DrawListHash(this, text_begin, (size_t)(text_end - text_begin));
+        if (DrawListHashCall(this, &args, sizeof(args)))
+            return;
+    }
+
     ImVec4 clip_rect = _CmdHeader.ClipRect;
     if (cpu_fine_clip_rect)
     {
@@ -1611,12 +2009,19 @@ void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, cons
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (Flags & ImDrawListFlags_HashContents)
+    {
+        const struct { ImVec2 Min, Max, UvMin, UvMax; ImU32 Col; } args = { p_min, p_max, uv_min, uv_max, col };
+        DrawListHash(this, &user_texture_id, sizeof(user_texture_id));
+        if (DrawListHashCall(this, &args, sizeof(args)))
+            return;
+    }
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
     if (push_texture_id)
         PushTextureID(user_texture_id);
 
-    PrimReserve(6, 4);
+    _PrimReserve(6, 4);
     PrimRectUV(p_min, p_max, uv_min, uv_max, col);
 
     if (push_texture_id)
@@ -1627,12 +2032,19 @@ void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, con
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (Flags & ImDrawListFlags_HashContents)
+    {
+        const struct { ImVec2 P[4], Uv[4]; ImU32 Col; } args = { { p1, p2, p3, p4 }, { uv1, uv2, uv3, uv4 }, col };
+        DrawListHash(this, &user_texture_id, sizeof(user_texture_id));
+        if (DrawListHashCall(this, &args, sizeof(args)))
+            return;
+    }
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
     if (push_texture_id)
         PushTextureID(user_texture_id);
 
-    PrimReserve(6, 4);
+    _PrimReserve(6, 4);
     PrimQuadUV(p1, p2, p3, p4, uv1, uv2, uv3, uv4, col);
 
     if (push_texture_id)
@@ -1655,6 +2067,12 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
     if (push_texture_id)
         PushTextureID(user_texture_id);
 
+    // UV are applied after emitting the shape: hash them here, the shape itself is hashed (and possibly skipped) by AddConvexPolyFilled().
+    if (Flags & ImDrawListFlags_HashContents)
+    {
+        const ImVec2 uv_args[2] = { uv_min, uv_max };
+        DrawListHash(this, uv_args, sizeof(uv_args));
+    }
     int vert_start_idx = VtxBuffer.Size;
     PathRect(p_min, p_max, rounding, flags);
     PathFillConvex(col);
@@ -1790,6 +2208,8 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
 {
     IM_ASSERT(idx >= 0 && idx < _Count);
+    if (draw_list->Flags & ImDrawListFlags_HashContents)
+        DrawListHash(draw_list, &idx, sizeof(idx));
     if (_Current == idx)
         return;
 
@@ -1988,6 +2408,7 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDestroyDynamicGlyphs(this); // Needs font data
     for (int i = 0; i < ConfigData.Size; i++)
         if (ConfigData[i].FontData && ConfigData[i].FontDataOwnedByAtlas)
         {
@@ -2011,6 +2432,7 @@ void    ImFontAtlas::ClearInputData()
 void    ImFontAtlas::ClearTexData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDestroyDynamicGlyphs(this); // Needs texture data
     if (TexPixelsAlpha8)
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
@@ -2024,8 +2446,10 @@ void    ImFontAtlas::ClearTexData()
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDestroyDynamicGlyphs(this);
     Fonts.clear_delete();
     TexReady = false;
+    GlyphDataVersion++;
 }
 
 void    ImFontAtlas::Clear()
@@ -2282,8 +2706,24 @@ bool    ImFontAtlas::Build()
 #endif
     }
 
+    // Load from cache file if it was written from the same input
+    // (custom builders may rely on state we don't know about, so they never use the cache)
+    const bool use_cache_file = (BuildCacheFilename != NULL && FontBuilderIO == NULL && !(Flags & ImFontAtlasFlags_DynamicGlyphs));
+    ImU32 cache_key = 0;
+    if (use_cache_file)
+    {
+        ImFontAtlasBuildInit(this);
+        cache_key = ImFontAtlasBuildCalcCacheKey(this);
+        if (ImFontAtlasBuildLoadCacheFile(this, BuildCacheFilename, cache_key))
+            return true;
+    }
+
     // Build
-    return builder_io->FontBuilder_Build(this);
+    if (!builder_io->FontBuilder_Build(this))
+        return false;
+    if (use_cache_file)
+        ImFontAtlasBuildSaveCacheFile(this, BuildCacheFilename, cache_key);
+    return true;
 }
 
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
@@ -2329,6 +2769,51 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// Rasterize a span of glyphs from one source font into their packed rectangles.
+// Rectangles are disjoint and each glyph only depends on its source, so spans can be rendered in any order and from any thread.
+struct ImFontBuildRenderTask
+{
+    int                 SrcIndex;
+    int                 GlyphsBegin;
+    int                 GlyphsEnd;
+};
+
+struct ImFontBuildRenderData
+{
+    ImFontAtlas*                    Atlas;
+    const stbtt_pack_context*       PackContext;
+    ImFontBuildSrcData*             SrcTmpArray;
+    const ImFontBuildRenderTask*    Tasks;
+};
+
+static void ImFontAtlasBuildRenderGlyphsTask(void* data, int task_n)
+{
+    ImFontBuildRenderData* render_data = (ImFontBuildRenderData*)data;
+    const ImFontBuildRenderTask& task = render_data->Tasks[task_n];
+    ImFontAtlas* atlas = render_data->Atlas;
+    ImFontConfig& cfg = atlas->ConfigData[task.SrcIndex];
+    ImFontBuildSrcData& src_tmp = render_data->SrcTmpArray[task.SrcIndex];
+
+    // stbtt_PackFontRangesRenderIntoRects() temporarily writes to the pack context, so each task uses its own copy
+    stbtt_pack_context spc = *render_data->PackContext;
+    stbtt_pack_range range = src_tmp.PackRange;
+    range.array_of_unicode_codepoints += task.GlyphsBegin;
+    range.chardata_for_range += task.GlyphsBegin;
+    range.num_chars = task.GlyphsEnd - task.GlyphsBegin;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &range, 1, src_tmp.Rects + task.GlyphsBegin);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        stbrp_rect* r = &src_tmp.Rects[task.GlyphsBegin];
+        for (int glyph_i = task.GlyphsBegin; glyph_i < task.GlyphsEnd; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+    }
+}
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2341,6 +2826,376 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+//-------------------------------------------------------------------------
+// Glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+//-------------------------------------------------------------------------
+// - Build() only rasterizes codepoints 0x00-0xFF and U+FFFD. Other glyphs are requested by FindGlyph() the first time they are
+//   looked up, which returns the fallback glyph until ImFontAtlasUpdateDynamicGlyphs() rasterizes them in the next NewFrame().
+// - Lookups may happen on threads filling detached draw lists (see ImDrawList::ResetDetached()), so they never reallocate or push to
+//   shared vectors: Build() sizes IndexLookup[] for the whole glyph ranges, and requests go to a fixed-size buffer reserved with atomics.
+//   Only ImFontAtlasUpdateDynamicGlyphs() modifies glyphs, from NewFrame() when no other thread may be rendering text.
+// - They are allocated in shelves (rows of glyphs of similar height) in the texture area left free by Build().
+//   When it is full, the least recently used shelf is evicted: its glyphs are removed, and will be requested again if they are looked up.
+// - Every modified region is added to ImFontAtlas::TexUpdates[] for the renderer backend to upload.
+//-------------------------------------------------------------------------
+
+// Requests over this number in one frame are dropped, and made again by the next lookups of their codepoint
+#define IM_FONTGLYPH_DYNAMIC_MAX_REQUESTS   1024
+
+struct ImFontDynamicGlyphRef
+{
+    ImFont*             Font;
+    ImWchar             Codepoint;
+};
+
+struct ImFontDynamicGlyphSlot
+{
+    ImFont*             Font;
+    int                 GlyphIndex;         // Index in Font->Glyphs[]
+};
+
+struct ImFontDynamicGlyphShelf
+{
+    int                 Y, Height;          // Texture rows
+    int                 Width;              // Allocated so far, glyphs are added left to right
+    int                 LastUsedFrame;      // Last ImFontAtlasDynamicGlyphs::Frame any of its glyphs was looked up
+    ImVector<ImFontDynamicGlyphRef> Glyphs;
+};
+
+struct ImFontAtlasDynamicGlyphs
+{
+    ImVector<stbtt_fontinfo>            FontInfos;          // Per entry of ImFontAtlas::ConfigData[] (pointing to its FontData)
+    ImVector<ImFontDynamicGlyphRef>     Requests;           // Codepoints to rasterize in the next ImFontAtlasUpdateDynamicGlyphs() call. Fixed size (IM_FONTGLYPH_DYNAMIC_MAX_REQUESTS)
+    volatile int                        RequestsCount;      // Entries of Requests[] reserved by lookups (atomic increment), may exceed Requests.Size when some were dropped
+    ImVector<ImFontDynamicGlyphShelf>   Shelves;
+    ImVector<int>                       ShelfIndexByRow;    // Per texture row, -1 outside of shelves
+    ImVector<ImFontDynamicGlyphSlot>    FreeSlots;          // Entries of ImFont::Glyphs[] left by evicted glyphs, to reuse
+    int                                 AreaY;              // First texture row which isn't used by a shelf
+    int                                 Frame;              // Incremented by ImFontAtlasUpdateDynamicGlyphs()
+
+    ImFontAtlasDynamicGlyphs()          { RequestsCount = AreaY = Frame = 0; }
+};
+
+static bool ImFontAtlasDynamicGlyphsIsInRanges(const ImFontAtlas* atlas, const ImFontConfig& cfg, unsigned int codepoint)
+{
+    const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : ((ImFontAtlas*)atlas)->GetGlyphRangesDefault();
+    for (; ranges[0] && ranges[1]; ranges += 2)
+        if (codepoint >= ranges[0] && codepoint <= ranges[1])
+            return true;
+    return false;
+}
+
+static void ImFontAtlasBuildInitDynamicGlyphs(ImFontAtlas* atlas, const ImFontBuildSrcData* src_tmp_array, int area_y)
+{
+    IM_ASSERT(atlas->DynamicGlyphs == NULL && atlas->TexPixelsAlpha8 != NULL);
+    ImFontAtlasDynamicGlyphs* dg = IM_NEW(ImFontAtlasDynamicGlyphs)();
+    dg->FontInfos.resize(atlas->ConfigData.Size);
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+        dg->FontInfos[src_i] = src_tmp_array[src_i].FontInfo;
+    dg->Requests.resize(IM_FONTGLYPH_DYNAMIC_MAX_REQUESTS);
+    dg->ShelfIndexByRow.resize(atlas->TexHeight, -1);
+    dg->AreaY = area_y;
+    atlas->DynamicGlyphs = dg;
+}
+
+// Called after BuildLookupTable(): extend IndexLookup[] to the last codepoint of the glyph ranges, so lookups never need to grow it.
+// Codepoints outside of the ranges are marked IM_FONTGLYPH_INDEX_PENDING, so (ImWchar)-1 only remains on codepoints to request.
+static void ImFontAtlasBuildDynamicGlyphsIndex(ImFontAtlas* atlas, ImFont* font)
+{
+    unsigned int max_codepoint = 0;
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+        if (atlas->ConfigData[src_i].DstFont == font)
+        {
+            const ImFontConfig& cfg = atlas->ConfigData[src_i];
+            for (const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault(); ranges[0] && ranges[1]; ranges += 2)
+                max_codepoint = ImMax(max_codepoint, (unsigned int)ranges[1]);
+        }
+    max_codepoint = ImMin(max_codepoint, (unsigned int)IM_UNICODE_CODEPOINT_MAX);
+    font->GrowIndex((int)max_codepoint + 1);
+    for (int c = 0; c < font->IndexLookup.Size; c++)
+    {
+        if (font->IndexAdvanceX[c] < 0.0f)
+            font->IndexAdvanceX[c] = font->FallbackAdvanceX;
+        if (font->IndexLookup[c] != (ImWchar)-1)
+            continue;
+        bool in_ranges = false;
+        for (int src_i = 0; src_i < atlas->ConfigData.Size && !in_ranges; src_i++)
+            if (atlas->ConfigData[src_i].DstFont == font)
+                in_ranges = ImFontAtlasDynamicGlyphsIsInRanges(atlas, atlas->ConfigData[src_i], (unsigned int)c);
+        if (!in_ranges)
+            font->IndexLookup[c] = IM_FONTGLYPH_INDEX_PENDING;
+    }
+}
+
+bool ImFontAtlasHasPendingDynamicGlyphs(const ImFontAtlas* atlas)
+{
+    return atlas->DynamicGlyphs != NULL && ImAtomicLoad(&atlas->DynamicGlyphs->RequestsCount) > 0;
+}
+
+void ImFontAtlasDestroyDynamicGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicGlyphs* dg = atlas->DynamicGlyphs;
+    if (dg == NULL)
+        return;
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+        atlas->Fonts[font_n]->UseDynamicGlyphs = false;
+    dg->Shelves.clear_destruct();
+    IM_DELETE(dg);
+    atlas->DynamicGlyphs = NULL;
+    atlas->TexUpdates.clear();
+}
+
+// Mirror a region of TexPixelsAlpha8 to TexPixelsRGBA32 (when GetTexDataAsRGBA32() was used) and queue it for upload.
+static void ImFontAtlasDynamicGlyphsUpdateTexRect(ImFontAtlas* atlas, int x, int y, int w, int h)
+{
+    if (atlas->TexPixelsRGBA32)
+        for (int row = y; row < y + h; row++)
+        {
+            const unsigned char* src = atlas->TexPixelsAlpha8 + x + row * atlas->TexWidth;
+            unsigned int* dst = atlas->TexPixelsRGBA32 + x + row * atlas->TexWidth;
+            for (int n = 0; n < w; n++)
+                dst[n] = IM_COL32(255, 255, 255, (unsigned int)src[n]);
+        }
+
+    // Glyphs are added left to right in a shelf, extend the previous region when possible
+    if (atlas->TexUpdates.Size > 0)
+    {
+        ImFontAtlasTexUpdate& last = atlas->TexUpdates.back();
+        if (last.Y == y && last.Height == h && last.X + last.Width == x)
+        {
+            last.Width = (unsigned short)(last.Width + w);
+            return;
+        }
+    }
+    ImFontAtlasTexUpdate update;
+    update.X = (unsigned short)x;
+    update.Y = (unsigned short)y;
+    update.Width = (unsigned short)w;
+    update.Height = (unsigned short)h;
+    atlas->TexUpdates.push_back(update);
+}
+
+static void ImFontAtlasDynamicGlyphsEvictShelf(ImFontAtlas* atlas, ImFontDynamicGlyphShelf* shelf)
+{
+    ImFontAtlasDynamicGlyphs* dg = atlas->DynamicGlyphs;
+    for (int n = 0; n < shelf->Glyphs.Size; n++)
+    {
+        ImFont* font = shelf->Glyphs[n].Font;
+        const ImWchar c = shelf->Glyphs[n].Codepoint;
+        ImFontDynamicGlyphSlot slot;
+        slot.Font = font;
+        slot.GlyphIndex = font->IndexLookup[c];
+        font->Glyphs[slot.GlyphIndex].Visible = 0;
+        font->IndexLookup[c] = (ImWchar)-1;
+        font->IndexAdvanceX[c] = font->FallbackAdvanceX;
+        dg->FreeSlots.push_back(slot);
+    }
+    for (int row = shelf->Y; row < shelf->Y + shelf->Height; row++)
+        memset(atlas->TexPixelsAlpha8 + row * atlas->TexWidth, 0, (size_t)shelf->Width);
+    if (shelf->Width > 0)
+        ImFontAtlasDynamicGlyphsUpdateTexRect(atlas, 0, shelf->Y, shelf->Width, shelf->Height);
+    shelf->Glyphs.resize(0);
+    shelf->Width = 0;
+}
+
+// Find room for a w*h rectangle: in the tightest shelf of a similar height, else in a new shelf, else by evicting the least recently used shelf.
+// Return the shelf index or -1 if the glyph can't be allocated.
+static int ImFontAtlasDynamicGlyphsAllocRect(ImFontAtlas* atlas, int w, int h, int* out_x, int* out_y)
+{
+    ImFontAtlasDynamicGlyphs* dg = atlas->DynamicGlyphs;
+    if (w > atlas->TexWidth)
+        return -1;
+    const int max_height = h + ImMax(h / 4, 2);
+    int shelf_n = -1;
+    for (int n = 0; n < dg->Shelves.Size; n++)
+    {
+        const ImFontDynamicGlyphShelf& shelf = dg->Shelves[n];
+        if (shelf.Height >= h && shelf.Height <= max_height && shelf.Width + w <= atlas->TexWidth)
+            if (shelf_n == -1 || shelf.Height < dg->Shelves[shelf_n].Height)
+                shelf_n = n;
+    }
+    if (shelf_n == -1 && dg->AreaY + h <= atlas->TexHeight)
+    {
+        ImFontDynamicGlyphShelf new_shelf;
+        new_shelf.Y = dg->AreaY;
+        new_shelf.Height = ImMin((h + 3) & ~3, atlas->TexHeight - dg->AreaY);
+        new_shelf.Width = 0;
+        new_shelf.LastUsedFrame = dg->Frame;
+        shelf_n = dg->Shelves.Size;
+        dg->Shelves.push_back(new_shelf);
+        for (int row = new_shelf.Y; row < new_shelf.Y + new_shelf.Height; row++)
+            dg->ShelfIndexByRow[row] = shelf_n;
+        dg->AreaY += new_shelf.Height;
+    }
+    if (shelf_n == -1)
+    {
+        // Shelves which received glyphs during this update have LastUsedFrame == Frame and are never evicted
+        for (int n = 0; n < dg->Shelves.Size; n++)
+        {
+            const ImFontDynamicGlyphShelf& shelf = dg->Shelves[n];
+            if (shelf.Height >= h && shelf.LastUsedFrame != dg->Frame)
+                if (shelf_n == -1 || shelf.LastUsedFrame < dg->Shelves[shelf_n].LastUsedFrame || (shelf.LastUsedFrame == dg->Shelves[shelf_n].LastUsedFrame && shelf.Height < dg->Shelves[shelf_n].Height))
+                    shelf_n = n;
+        }
+        if (shelf_n == -1)
+            return -1;
+        ImFontAtlasDynamicGlyphsEvictShelf(atlas, &dg->Shelves[shelf_n]);
+    }
+    ImFontDynamicGlyphShelf& shelf = dg->Shelves[shelf_n];
+    *out_x = shelf.Width;
+    *out_y = shelf.Y;
+    shelf.Width += w;
+    shelf.LastUsedFrame = dg->Frame;
+    return shelf_n;
+}
+
+// Called by ImFont::FindGlyph() on fonts using dynamic glyphs, possibly from several threads at once (see ImDrawList::ResetDetached()).
+// Shared state is only written with atomics: a codepoint is marked PENDING by the one lookup which then writes its request.
+const ImFontGlyph* ImFontFindDynamicGlyph(const ImFont* font, ImWchar c)
+{
+    if (c >= (size_t)font->IndexLookup.Size)
+        return font->FallbackGlyph;
+    ImFontAtlas* atlas = font->ContainerAtlas;
+    ImFontAtlasDynamicGlyphs* dg = atlas->DynamicGlyphs;
+    volatile ImWchar* index = (volatile ImWchar*)&font->IndexLookup.Data[c];
+    const ImWchar i = ImAtomicLoad(index);
+    if (i < IM_FONTGLYPH_INDEX_PENDING)
+    {
+        // Mark shelf as used (glyphs prebuilt by Build() are outside of shelves)
+        const ImFontGlyph* glyph = &font->Glyphs.Data[i];
+        const int shelf_n = dg->ShelfIndexByRow[(int)(glyph->V0 * atlas->TexHeight + 0.5f)];
+        if (shelf_n != -1 && ImAtomicLoad(&dg->Shelves[shelf_n].LastUsedFrame) != dg->Frame)
+            ImAtomicStore(&dg->Shelves[shelf_n].LastUsedFrame, dg->Frame);
+        return glyph;
+    }
+    if (i == IM_FONTGLYPH_INDEX_PENDING || !ImAtomicCompareExchange(index, (ImWchar)-1, IM_FONTGLYPH_INDEX_PENDING))
+        return font->FallbackGlyph;
+
+    // Request the codepoint (it is within the font glyph ranges, see ImFontAtlasBuildDynamicGlyphsIndex())
+    const int request_n = ImAtomicFetchAdd(&dg->RequestsCount, 1);
+    if (request_n < dg->Requests.Size)
+    {
+        dg->Requests.Data[request_n].Font = (ImFont*)font;
+        dg->Requests.Data[request_n].Codepoint = c;
+    }
+    else
+    {
+        ImAtomicStore(index, (ImWchar)-1); // Too many requests this frame: request again on a later lookup
+    }
+    return font->FallbackGlyph;
+}
+
+// Rasterize glyphs requested since the last call. Called by NewFrame().
+void ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicGlyphs* dg = atlas->DynamicGlyphs;
+    if (dg == NULL)
+        return;
+    dg->Frame++;
+    const int requests_count = ImMin(dg->RequestsCount, dg->Requests.Size);
+    if (requests_count == 0)
+        return;
+
+    stbtt_pack_context spc = {};
+    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, atlas->TexHeight, 0, atlas->TexGlyphPadding, NULL); // Passing pixels would clear them
+    spc.pixels = atlas->TexPixelsAlpha8;
+    bool glyphs_changed = false;
+    for (int request_n = 0; request_n < requests_count; request_n++)
+    {
+        ImFont* font = dg->Requests[request_n].Font;
+        const ImWchar c = dg->Requests[request_n].Codepoint;
+        if (c >= (size_t)font->IndexLookup.Size || font->IndexLookup[c] != IM_FONTGLYPH_INDEX_PENDING)
+            continue;
+
+        // Use the first source which has the glyph, same as Build().
+        // Codepoints that aren't found stay PENDING, so they are not requested again.
+        int src_i = 0;
+        int glyph_index_in_font = 0;
+        for (; src_i < atlas->ConfigData.Size; src_i++)
+            if (atlas->ConfigData[src_i].DstFont == font && ImFontAtlasDynamicGlyphsIsInRanges(atlas, atlas->ConfigData[src_i], c))
+                if ((glyph_index_in_font = stbtt_FindGlyphIndex(&dg->FontInfos[src_i], c)) != 0)
+                    break;
+        if (glyph_index_in_font == 0)
+            continue;
+        int free_slot_n = -1;
+        for (int n = dg->FreeSlots.Size - 1; n >= 0 && free_slot_n == -1; n--)
+            if (dg->FreeSlots[n].Font == font)
+                free_slot_n = n;
+        if (free_slot_n == -1 && font->Glyphs.Size + 1 >= IM_FONTGLYPH_INDEX_PENDING)
+            continue;
+
+        // Allocate and render (same as Build() steps 4 and 8, for a single glyph)
+        ImFontConfig& cfg = atlas->ConfigData[src_i];
+        const stbtt_fontinfo* font_info = &dg->FontInfos[src_i];
+        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(font_info, -cfg.SizePixels);
+        int x0, y0, x1, y1;
+        stbtt_GetGlyphBitmapBoxSubpixel(font_info, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+        const int rect_w = x1 - x0 + atlas->TexGlyphPadding + cfg.OversampleH - 1;
+        const int rect_h = y1 - y0 + atlas->TexGlyphPadding + cfg.OversampleV - 1;
+        int rect_x, rect_y;
+        const int shelf_n = ImFontAtlasDynamicGlyphsAllocRect(atlas, rect_w, rect_h, &rect_x, &rect_y);
+        if (shelf_n == -1)
+            continue;
+        stbrp_rect rect = {};
+        rect.x = (stbrp_coord)rect_x;
+        rect.y = (stbrp_coord)rect_y;
+        rect.w = (stbrp_coord)rect_w;
+        rect.h = (stbrp_coord)rect_h;
+        rect.was_packed = 1;
+
+        int codepoint = (int)c;
+        stbtt_packedchar packed_char;
+        stbtt_pack_range range = {};
+        range.font_size = cfg.SizePixels;
+        range.array_of_unicode_codepoints = &codepoint;
+        range.num_chars = 1;
+        range.chardata_for_range = &packed_char;
+        range.h_oversample = (unsigned char)cfg.OversampleH;
+        range.v_oversample = (unsigned char)cfg.OversampleV;
+        stbtt_PackFontRangesRenderIntoRects(&spc, (stbtt_fontinfo*)font_info, &range, 1, &rect);
+        if (cfg.RasterizerMultiply != 1.0f)
+        {
+            unsigned char multiply_table[256];
+            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+            ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, rect.x, rect.y, rect.w, rect.h, atlas->TexWidth * 1);
+        }
+        ImFontAtlasDynamicGlyphsUpdateTexRect(atlas, rect_x, dg->Shelves[shelf_n].Y, rect_w, dg->Shelves[shelf_n].Height);
+
+        // Register glyph (same as Build() step 9), reusing an evicted entry of Glyphs[] when possible
+        const int fallback_glyph_n = (int)(font->FallbackGlyph - font->Glyphs.Data);
+        const float font_off_x = cfg.GlyphOffset.x;
+        const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(font->Ascent);
+        stbtt_aligned_quad q;
+        float unused_x = 0.0f, unused_y = 0.0f;
+        stbtt_GetPackedQuad(&packed_char, atlas->TexWidth, atlas->TexHeight, 0, &unused_x, &unused_y, &q, 0);
+        font->AddGlyph(&cfg, c, q.x0 + font_off_x, q.y0 + font_off_y, q.x1 + font_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, packed_char.xadvance);
+        font->DirtyLookupTables = false;
+        int glyph_n = font->Glyphs.Size - 1;
+        if (free_slot_n != -1)
+        {
+            glyph_n = dg->FreeSlots[free_slot_n].GlyphIndex;
+            font->Glyphs[glyph_n] = font->Glyphs.back();
+            font->Glyphs.pop_back();
+            dg->FreeSlots.erase(dg->FreeSlots.Data + free_slot_n);
+        }
+        font->FallbackGlyph = &font->Glyphs[fallback_glyph_n];
+        font->IndexLookup[c] = (ImWchar)glyph_n;
+        font->IndexAdvanceX[c] = font->Glyphs[glyph_n].AdvanceX;
+        const int page_n = c / 4096;
+        font->Used4kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
+
+        ImFontDynamicGlyphRef glyph_ref = { font, c };
+        dg->Shelves[shelf_n].Glyphs.push_back(glyph_ref);
+        glyphs_changed = true;
+    }
+    stbtt_PackEnd(&spc);
+    dg->RequestsCount = 0;
+
+    // Invalidate text layouts made with the fallback glyph or evicted glyphs
+    if (glyphs_changed)
+        atlas->GlyphDataVersion++;
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2395,6 +3250,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 2. For every requested codepoint, check for their presence in the font data, and handle redundancy or overlaps between source fonts to avoid unused glyphs.
+    const bool dynamic_glyphs = (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) != 0;
     int total_glyphs_count = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
@@ -2411,6 +3267,8 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
                     continue;
                 if (!stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
                     continue;
+                if (dynamic_glyphs && codepoint > 0xFF && codepoint != IM_UNICODE_CODEPOINT_INVALID && dst_tmp.GlyphsCount > 0)
+                    continue; // Rasterized on demand (but every font gets at least one glyph, to have a fallback glyph)
 
                 // Add to avail set/counters
                 src_tmp.GlyphsCount++;
@@ -2517,6 +3375,9 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 7. Allocate texture
+    const int packed_height = atlas->TexHeight;
+    if (dynamic_glyphs)
+        atlas->TexHeight = ImMax(atlas->TexHeight * 2, atlas->TexWidth); // Leave room for glyphs rasterized on demand
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
@@ -2525,27 +3386,30 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    // Split sources into spans of glyphs so that a large source (e.g. CJK) can be spread over multiple threads with BuildParallelForFn.
+    const int GLYPHS_PER_TASK = 64;
+    ImVector<ImFontBuildRenderTask> render_tasks;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsCount; glyph_i += GLYPHS_PER_TASK)
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            ImFontBuildRenderTask task;
+            task.SrcIndex = src_i;
+            task.GlyphsBegin = glyph_i;
+            task.GlyphsEnd = ImMin(glyph_i + GLYPHS_PER_TASK, src_tmp_array[src_i].GlyphsCount);
+            render_tasks.push_back(task);
         }
-        src_tmp.Rects = NULL;
-    }
+    ImFontBuildRenderData render_data;
+    render_data.Atlas = atlas;
+    render_data.PackContext = &spc;
+    render_data.SrcTmpArray = src_tmp_array.Data;
+    render_data.Tasks = render_tasks.Data;
+    if (atlas->BuildParallelForFn && render_tasks.Size > 1)
+        atlas->BuildParallelForFn(render_tasks.Size, ImFontAtlasBuildRenderGlyphsTask, &render_data, atlas->BuildParallelForUserData);
+    else
+        for (int task_n = 0; task_n < render_tasks.Size; task_n++)
+            ImFontAtlasBuildRenderGlyphsTask(&render_data, task_n);
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
 
     // End packing
     stbtt_PackEnd(&spc);
@@ -2586,10 +3450,21 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         }
     }
 
+    // Keep what we need to rasterize other glyphs later
+    if (dynamic_glyphs)
+        ImFontAtlasBuildInitDynamicGlyphs(atlas, src_tmp_array.Data, packed_height);
+
     // Cleanup
     src_tmp_array.clear_destruct();
 
     ImFontAtlasBuildFinish(atlas);
+    if (atlas->DynamicGlyphs)
+        for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+            if (atlas->Fonts[font_n]->ContainerAtlas == atlas)
+            {
+                ImFontAtlasBuildDynamicGlyphsIndex(atlas, atlas->Fonts[font_n]);
+                atlas->Fonts[font_n]->UseDynamicGlyphs = true;
+            }
     return true;
 }
 
@@ -2600,6 +3475,14 @@ const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
     return &io;
 }
 
+#else
+
+// Glyphs rasterized on demand are only supported by the stb_truetype builder
+void ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas*) {}
+void ImFontAtlasDestroyDynamicGlyphs(ImFontAtlas*) {}
+const ImFontGlyph* ImFontFindDynamicGlyph(const ImFont* font, ImWchar) { return font->FallbackGlyph; }
+bool ImFontAtlasHasPendingDynamicGlyphs(const ImFontAtlas*) { return false; }
+
 #endif // IMGUI_ENABLE_STB_TRUETYPE
 
 void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent)
@@ -2806,6 +3689,307 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     atlas->TexReady = true;
 }
 
+// Atlas cache file (see ImFontAtlas::BuildCacheFilename)
+// - Layout: ImFontAtlasCacheHeader, metadata block (custom rects positions, UVs, per-font data), texture pixels.
+// - The key hashes everything the builder reads: font data, ImFontConfig settings, glyph ranges, custom rects and atlas settings.
+// - Glyphs are stored in memory layout, so the file is only valid for the same version/configuration of Dear ImGui (see LayoutKey).
+#define IM_FONTATLAS_CACHE_MAGIC    0x41464D49  // "IMFA" when read on a little-endian machine
+#define IM_FONTATLAS_CACHE_VERSION  1
+
+struct ImFontAtlasCacheHeader
+{
+    ImU32           Magic;
+    ImU32           Version;
+    ImU32           LayoutKey;          // Hash of Dear ImGui version and sizes of serialized structures
+    ImU32           Key;                // ImFontAtlasBuildCalcCacheKey()
+    ImU32           DataSize;           // Size of metadata block following the header
+    ImU32           DataChecksum;       // Hash of metadata block
+    int             FontsCount;
+    int             CustomRectsCount;
+    int             TexWidth;
+    int             TexHeight;
+    int             TexBytesPerPixel;   // 1 (TexPixelsAlpha8) or 4 (TexPixelsRGBA32)
+    int             TexPixelsUseColors;
+};
+
+struct ImFontAtlasCacheFont
+{
+    float           FontSize, Ascent, Descent, FallbackAdvanceX;
+    int             MetricsTotalSurface;
+    int             ConfigDataCount;    // Sources which contributed glyphs
+    int             FallbackGlyphIndex;
+    int             GlyphsCount;        // Followed by GlyphsCount x ImFontGlyph
+    int             IndexCount;         // Followed by IndexCount x float (IndexAdvanceX) then IndexCount x ImWchar (IndexLookup)
+    ImWchar         FallbackChar, EllipsisChar, DotChar;
+    ImU8            Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX + 1) / 4096 / 8];
+};
+
+static ImU32 ImFontAtlasCacheLayoutKey()
+{
+    const int layout[] = { IMGUI_VERSION_NUM, (int)sizeof(ImWchar), (int)sizeof(ImFontGlyph), (int)sizeof(ImFontAtlasCacheFont), (int)sizeof(ImFontAtlasCacheHeader), IM_DRAWLIST_TEX_LINES_WIDTH_MAX };
+    return ImHashData(layout, sizeof(layout));
+}
+
+static int ImFontAtlasCacheFindFontIndex(ImFontAtlas* atlas, const ImFont* font)
+{
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+        if (atlas->Fonts[n] == font)
+            return n;
+    return -1;
+}
+
+// Hash all inputs of the build. Fields are hashed one by one to not depend on struct padding.
+ImU32 ImFontAtlasBuildCalcCacheKey(ImFontAtlas* atlas)
+{
+    int atlas_params[] = { atlas->Flags, atlas->TexDesiredWidth, atlas->TexGlyphPadding, (int)atlas->FontBuilderFlags, atlas->Fonts.Size, atlas->ConfigData.Size, atlas->CustomRects.Size };
+#ifdef IMGUI_ENABLE_FREETYPE
+    atlas_params[0] |= 1 << 30;
+#endif
+    ImU32 key = ImHashData(atlas_params, sizeof(atlas_params));
+    for (int cfg_n = 0; cfg_n < atlas->ConfigData.Size; cfg_n++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[cfg_n];
+        const int cfg_ints[] = { cfg.FontDataSize, cfg.FontNo, cfg.OversampleH, cfg.OversampleV, cfg.PixelSnapH, cfg.MergeMode, (int)cfg.FontBuilderFlags, (int)cfg.EllipsisChar, ImFontAtlasCacheFindFontIndex(atlas, cfg.DstFont) };
+        const float cfg_floats[] = { cfg.SizePixels, cfg.GlyphExtraSpacing.x, cfg.GlyphExtraSpacing.y, cfg.GlyphOffset.x, cfg.GlyphOffset.y, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX, cfg.RasterizerMultiply };
+        key = ImHashData(cfg_ints, sizeof(cfg_ints), key);
+        key = ImHashData(cfg_floats, sizeof(cfg_floats), key);
+        key = ImHashData(cfg.FontData, (size_t)cfg.FontDataSize, key);
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        int ranges_count = 0;
+        while (ranges[ranges_count] != 0)
+            ranges_count++;
+        key = ImHashData(ranges, sizeof(ImWchar) * ranges_count, key);
+    }
+    for (int rect_n = 0; rect_n < atlas->CustomRects.Size; rect_n++)
+    {
+        const ImFontAtlasCustomRect& r = atlas->CustomRects[rect_n];
+        const int rect_ints[] = { r.Width, r.Height, (int)r.GlyphID, ImFontAtlasCacheFindFontIndex(atlas, r.Font) };
+        const float rect_floats[] = { r.GlyphAdvanceX, r.GlyphOffset.x, r.GlyphOffset.y };
+        key = ImHashData(rect_ints, sizeof(rect_ints), key);
+        key = ImHashData(rect_floats, sizeof(rect_floats), key);
+    }
+    return key;
+}
+
+static void ImFontAtlasCacheWrite(ImVector<char>* buf, const void* data, size_t size)
+{
+    const int pos = buf->Size;
+    buf->resize(pos + (int)size);
+    if (size > 0)
+        memcpy(buf->Data + pos, data, size);
+}
+
+// Return a pointer to the next 'size' bytes of the metadata block, or NULL if the block is too small.
+static const char* ImFontAtlasCacheRead(const ImVector<char>& buf, int* pos, size_t size)
+{
+    if (size > (size_t)(buf.Size - *pos))
+        return NULL;
+    const char* p = buf.Data + *pos;
+    *pos += (int)size;
+    return p;
+}
+
+// Load a cache file written by ImFontAtlasBuildSaveCacheFile() with the same key.
+// Everything is validated before the atlas is modified, so this returns false and leaves the atlas untouched on a missing, stale or corrupt file.
+bool ImFontAtlasBuildLoadCacheFile(ImFontAtlas* atlas, const char* filename, ImU32 key)
+{
+    ImFileHandle f = ImFileOpen(filename, "rb");
+    if (!f)
+        return false;
+
+    // Validate header
+    ImFontAtlasCacheHeader header;
+    const ImU64 file_size = ImFileGetSize(f);
+    bool ok = ImFileRead(&header, sizeof(header), 1, f) == 1;
+    ok = ok && header.Magic == IM_FONTATLAS_CACHE_MAGIC && header.Version == IM_FONTATLAS_CACHE_VERSION && header.LayoutKey == ImFontAtlasCacheLayoutKey() && header.Key == key;
+    ok = ok && header.FontsCount == atlas->Fonts.Size && header.CustomRectsCount == atlas->CustomRects.Size;
+    ok = ok && header.TexWidth > 0 && header.TexWidth <= 0x8000 && header.TexHeight > 0 && header.TexHeight <= 0x8000 && (header.TexBytesPerPixel == 1 || header.TexBytesPerPixel == 4);
+    const ImU64 tex_size = ok ? (ImU64)header.TexWidth * (ImU64)header.TexHeight * (ImU64)header.TexBytesPerPixel : 0;
+    ok = ok && header.DataSize < 0x7FFFFFFF && file_size == sizeof(header) + (ImU64)header.DataSize + tex_size;
+
+    // Read and validate metadata block
+    ImVector<char> data;
+    if (ok)
+    {
+        data.resize((int)header.DataSize);
+        ok = ImFileRead(data.Data, 1, (ImU64)data.Size, f) == (ImU64)data.Size && ImHashData(data.Data, (size_t)data.Size) == header.DataChecksum;
+    }
+    int pos = 0;
+    const ImU16* rects_pos = ok ? (const ImU16*)(const void*)ImFontAtlasCacheRead(data, &pos, sizeof(ImU16) * 2 * header.CustomRectsCount) : NULL;
+    const char* tex_uvs = ok ? ImFontAtlasCacheRead(data, &pos, sizeof(ImVec2) + sizeof(atlas->TexUvLines)) : NULL;
+    ok = ok && rects_pos != NULL && tex_uvs != NULL;
+    ImVector<int> fonts_pos;
+    for (int font_n = 0; ok && font_n < header.FontsCount; font_n++)
+    {
+        const char* font_data = ImFontAtlasCacheRead(data, &pos, sizeof(ImFontAtlasCacheFont));
+        ImFontAtlasCacheFont font_info;
+        if (!(ok = (font_data != NULL)))
+            break;
+        fonts_pos.push_back((int)(font_data - data.Data));
+        memcpy(&font_info, font_data, sizeof(font_info));
+        ok = font_info.GlyphsCount > 0 && font_info.GlyphsCount < 0xFFFF && font_info.IndexCount >= 0 && font_info.IndexCount <= IM_UNICODE_CODEPOINT_MAX + 1;
+        ok = ok && font_info.ConfigDataCount >= 1 && font_info.ConfigDataCount <= atlas->ConfigData.Size;
+        ok = ok && font_info.FallbackGlyphIndex >= 0 && font_info.FallbackGlyphIndex < font_info.GlyphsCount;
+        ok = ok && ImFontAtlasCacheRead(data, &pos, sizeof(ImFontGlyph) * font_info.GlyphsCount) != NULL;
+        ok = ok && ImFontAtlasCacheRead(data, &pos, sizeof(float) * font_info.IndexCount) != NULL;
+        const char* index_lookup = ok ? ImFontAtlasCacheRead(data, &pos, sizeof(ImWchar) * font_info.IndexCount) : NULL;
+        ok = ok && index_lookup != NULL;
+        for (int n = 0; ok && n < font_info.IndexCount; n++)
+        {
+            ImWchar glyph_index;
+            memcpy(&glyph_index, index_lookup + sizeof(ImWchar) * n, sizeof(ImWchar));
+            ok = (glyph_index == (ImWchar)-1 || (int)glyph_index < font_info.GlyphsCount);
+        }
+    }
+    ok = ok && pos == data.Size;
+
+    // Read pixels directly into the texture buffer
+    void* pixels = NULL;
+    if (ok)
+    {
+        pixels = IM_ALLOC((size_t)tex_size);
+        ok = ImFileRead(pixels, 1, tex_size, f) == tex_size;
+    }
+    ImFileClose(f);
+    if (!ok)
+    {
+        if (pixels)
+            IM_FREE(pixels);
+        return false;
+    }
+
+    // Setup texture
+    atlas->ClearTexData();
+    atlas->TexID = (ImTextureID)NULL;
+    atlas->TexWidth = header.TexWidth;
+    atlas->TexHeight = header.TexHeight;
+    atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+    if (header.TexBytesPerPixel == 1)
+        atlas->TexPixelsAlpha8 = (unsigned char*)pixels;
+    else
+        atlas->TexPixelsRGBA32 = (unsigned int*)pixels;
+    atlas->TexPixelsUseColors = header.TexPixelsUseColors != 0;
+    memcpy(&atlas->TexUvWhitePixel, tex_uvs, sizeof(ImVec2));
+    memcpy(atlas->TexUvLines, tex_uvs + sizeof(ImVec2), sizeof(atlas->TexUvLines));
+    for (int rect_n = 0; rect_n < atlas->CustomRects.Size; rect_n++)
+    {
+        ImU16 xy[2];
+        memcpy(xy, rects_pos + rect_n * 2, sizeof(xy));
+        atlas->CustomRects[rect_n].X = xy[0];
+        atlas->CustomRects[rect_n].Y = xy[1];
+    }
+
+    // Setup fonts (same as ImFontAtlasBuildSetupFont() + AddGlyph() + BuildLookupTable())
+    for (int cfg_n = 0; cfg_n < atlas->ConfigData.Size; cfg_n++)
+        if (!atlas->ConfigData[cfg_n].MergeMode)
+        {
+            ImFont* font = atlas->ConfigData[cfg_n].DstFont;
+            font->ClearOutputData();
+            font->ConfigData = &atlas->ConfigData[cfg_n];
+            font->ContainerAtlas = atlas;
+        }
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        ImFont* font = atlas->Fonts[font_n];
+        const char* p = data.Data + fonts_pos[font_n];
+        ImFontAtlasCacheFont font_info;
+        memcpy(&font_info, p, sizeof(font_info));
+        p += sizeof(font_info);
+        font->FontSize = font_info.FontSize;
+        font->ConfigDataCount = (short)font_info.ConfigDataCount;
+        font->Ascent = font_info.Ascent;
+        font->Descent = font_info.Descent;
+        font->MetricsTotalSurface = font_info.MetricsTotalSurface;
+        font->Glyphs.resize(font_info.GlyphsCount);
+        memcpy(font->Glyphs.Data, p, (size_t)font->Glyphs.size_in_bytes());
+        p += font->Glyphs.size_in_bytes();
+        font->IndexAdvanceX.resize(font_info.IndexCount);
+        memcpy(font->IndexAdvanceX.Data, p, (size_t)font->IndexAdvanceX.size_in_bytes());
+        p += font->IndexAdvanceX.size_in_bytes();
+        font->IndexLookup.resize(font_info.IndexCount);
+        memcpy(font->IndexLookup.Data, p, (size_t)font->IndexLookup.size_in_bytes());
+        font->FallbackGlyph = &font->Glyphs[font_info.FallbackGlyphIndex];
+        font->FallbackAdvanceX = font_info.FallbackAdvanceX;
+        font->FallbackChar = font_info.FallbackChar;
+        font->EllipsisChar = font_info.EllipsisChar;
+        font->DotChar = font_info.DotChar;
+        memcpy(font->Used4kPagesMap, font_info.Used4kPagesMap, sizeof(font->Used4kPagesMap));
+        font->DirtyLookupTables = false;
+    }
+    atlas->GlyphDataVersion++;
+    atlas->TexReady = true;
+    return true;
+}
+
+// Write the output of a successful build. Must be called right after building, before any custom rect pixels are written by the user.
+bool ImFontAtlasBuildSaveCacheFile(ImFontAtlas* atlas, const char* filename, ImU32 key)
+{
+    IM_ASSERT(atlas->TexReady && (atlas->TexPixelsAlpha8 != NULL || atlas->TexPixelsRGBA32 != NULL));
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+        if (atlas->Fonts[font_n]->Glyphs.Size == 0 || atlas->Fonts[font_n]->DirtyLookupTables || atlas->Fonts[font_n]->ContainerAtlas != atlas)
+            return false;
+
+    // Metadata block
+    ImVector<char> data;
+    for (int rect_n = 0; rect_n < atlas->CustomRects.Size; rect_n++)
+    {
+        const ImU16 xy[2] = { atlas->CustomRects[rect_n].X, atlas->CustomRects[rect_n].Y };
+        ImFontAtlasCacheWrite(&data, xy, sizeof(xy));
+    }
+    ImFontAtlasCacheWrite(&data, &atlas->TexUvWhitePixel, sizeof(ImVec2));
+    ImFontAtlasCacheWrite(&data, atlas->TexUvLines, sizeof(atlas->TexUvLines));
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        const ImFont* font = atlas->Fonts[font_n];
+        ImFontAtlasCacheFont font_info;
+        memset(&font_info, 0, sizeof(font_info)); // Clear padding so the checksum is stable
+        font_info.FontSize = font->FontSize;
+        font_info.Ascent = font->Ascent;
+        font_info.Descent = font->Descent;
+        font_info.FallbackAdvanceX = font->FallbackAdvanceX;
+        font_info.MetricsTotalSurface = font->MetricsTotalSurface;
+        font_info.ConfigDataCount = font->ConfigDataCount;
+        font_info.FallbackGlyphIndex = (int)(font->FallbackGlyph - font->Glyphs.Data);
+        font_info.GlyphsCount = font->Glyphs.Size;
+        font_info.IndexCount = font->IndexLookup.Size;
+        font_info.FallbackChar = font->FallbackChar;
+        font_info.EllipsisChar = font->EllipsisChar;
+        font_info.DotChar = font->DotChar;
+        memcpy(font_info.Used4kPagesMap, font->Used4kPagesMap, sizeof(font_info.Used4kPagesMap));
+        IM_ASSERT(font->IndexAdvanceX.Size == font->IndexLookup.Size);
+        ImFontAtlasCacheWrite(&data, &font_info, sizeof(font_info));
+        ImFontAtlasCacheWrite(&data, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+        ImFontAtlasCacheWrite(&data, font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.size_in_bytes());
+        ImFontAtlasCacheWrite(&data, font->IndexLookup.Data, (size_t)font->IndexLookup.size_in_bytes());
+    }
+
+    ImFontAtlasCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    header.Magic = IM_FONTATLAS_CACHE_MAGIC;
+    header.Version = IM_FONTATLAS_CACHE_VERSION;
+    header.LayoutKey = ImFontAtlasCacheLayoutKey();
+    header.Key = key;
+    header.DataSize = (ImU32)data.Size;
+    header.DataChecksum = ImHashData(data.Data, (size_t)data.Size);
+    header.FontsCount = atlas->Fonts.Size;
+    header.CustomRectsCount = atlas->CustomRects.Size;
+    header.TexWidth = atlas->TexWidth;
+    header.TexHeight = atlas->TexHeight;
+    header.TexBytesPerPixel = atlas->TexPixelsAlpha8 ? 1 : 4;
+    header.TexPixelsUseColors = atlas->TexPixelsUseColors ? 1 : 0;
+    const void* pixels = atlas->TexPixelsAlpha8 ? (const void*)atlas->TexPixelsAlpha8 : (const void*)atlas->TexPixelsRGBA32;
+    const ImU64 tex_size = (ImU64)header.TexWidth * (ImU64)header.TexHeight * (ImU64)header.TexBytesPerPixel;
+
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    bool ok = ImFileWrite(&header, sizeof(header), 1, f) == 1;
+    ok = ok && ImFileWrite(data.Data, 1, (ImU64)data.Size, f) == (ImU64)data.Size;
+    ok = ok && ImFileWrite(pixels, 1, tex_size, f) == tex_size;
+    ImFileClose(f);
+    return ok;
+}
+
 // Retrieve list of range (2 int per range, values are inclusive)
 const ImWchar*   ImFontAtlas::GetGlyphRangesDefault()
 {
@@ -3114,6 +4298,7 @@ ImFont::ImFont()
     ConfigData = NULL;
     ConfigDataCount = 0;
     DirtyLookupTables = false;
+    UseDynamicGlyphs = false;
     Scale = 1.0f;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -3135,6 +4320,7 @@ void    ImFont::ClearOutputData()
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
+    UseDynamicGlyphs = false;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
 }
@@ -3154,10 +4340,12 @@ void ImFont::BuildLookupTable()
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
 
     // Build lookup table
-    IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
+    IM_ASSERT(Glyphs.Size < 0xFFFE); // -1 and -2 are reserved (see IM_FONTGLYPH_INDEX_PENDING)
     IndexAdvanceX.clear();
     IndexLookup.clear();
     DirtyLookupTables = false;
+    if (ContainerAtlas)
+        ContainerAtlas->GlyphDataVersion++;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
     GrowIndex(max_codepoint + 1);
     for (int i = 0; i < Glyphs.Size; i++)
@@ -3311,10 +4499,12 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
+    if (UseDynamicGlyphs)
+        return ImFontFindDynamicGlyph(this, c);
     if (c >= (size_t)IndexLookup.Size)
         return FallbackGlyph;
     const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
+    if (i >= IM_FONTGLYPH_INDEX_PENDING)
         return FallbackGlyph;
     return &Glyphs.Data[i];
 }
@@ -3324,7 +4514,7 @@ const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
     if (c >= (size_t)IndexLookup.Size)
         return NULL;
     const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
+    if (i >= IM_FONTGLYPH_INDEX_PENDING)
         return NULL;
     return &Glyphs.Data[i];
 }
@@ -3533,10 +4723,297 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
     pos.x = IM_FLOOR(pos.x);
     pos.y = IM_FLOOR(pos.y);
-    draw_list->PrimReserve(6, 4);
+    if (draw_list->Flags & ImDrawListFlags_HashContents)
+    {
+        const ImFont* font = this;
+        const struct { float Size; ImVec2 Pos; ImU32 Col; unsigned int Char; } args = { size, pos, col, (unsigned int)c };
+        DrawListHash(draw_list, &font, sizeof(font));
+        if (DrawListHashCall(draw_list, &args, sizeof(args)))
+            return;
+    }
+    draw_list->_PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(pos.x + glyph->X0 * scale, pos.y + glyph->Y0 * scale), ImVec2(pos.x + glyph->X1 * scale, pos.y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
 }
 
+ImFontGlyphRun* ImFontGlyphRunCache::GetRun(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end)
+{
+    const int text_len = (int)(text_end - text_begin);
+    const struct { const ImFont* Font; float Size; float WrapWidth; } key = { font, size, wrap_width };
+    ImU32 hash = ImHashDataMurmur3(text_begin, (size_t)text_len, ImHashDataMurmur3(&key, sizeof(key), 0));
+    hash ^= hash >> 16; hash *= 0x85EBCA6B; hash ^= hash >> 13; // Finalize so that low bits can be used as a bucket index
+    if (Buckets.Size == 0)
+        RebuildBuckets(256);
+
+    // Lookup
+    int* bucket = &Buckets[hash & (Buckets.Size - 1)];
+    int run_idx = *bucket;
+    while (run_idx != -1)
+    {
+        ImFontGlyphRun* run = &Runs[run_idx];
+        if (run->Hash == hash && run->Font == font && run->Size == size && run->WrapWidth == wrap_width && run->Text.Size == text_len && memcmp(run->Text.Data, text_begin, (size_t)text_len) == 0)
+            break;
+        run_idx = run->HashNext;
+    }
+
+    // Create
+    if (run_idx == -1)
+    {
+        if (RunsCount >= Buckets.Size)
+        {
+            RebuildBuckets(Buckets.Size * 2);
+            bucket = &Buckets[hash & (Buckets.Size - 1)];
+        }
+        if (FreeFirst != -1)
+        {
+            run_idx = FreeFirst;
+            FreeFirst = Runs[run_idx].HashNext;
+        }
+        else
+        {
+            run_idx = Runs.Size;
+            Runs.resize(Runs.Size + 1);
+            memset(&Runs[run_idx], 0, sizeof(ImFontGlyphRun));
+        }
+        ImFontGlyphRun* run = &Runs[run_idx];
+        run->Hash = hash;
+        run->Font = font;
+        run->Size = size;
+        run->WrapWidth = wrap_width;
+        run->Text.resize(text_len);
+        memcpy(run->Text.Data, text_begin, (size_t)text_len);
+        run->Vtx.resize(0);
+        run->HasTextSize = run->HasQuads = false;
+        run->MemorySize = 0;
+        run->HashNext = *bucket;
+        run->LruPrev = run->LruNext = -1;
+        *bucket = run_idx;
+        RunsCount++;
+        if (LruLast == -1)
+            LruLast = run_idx;
+        else
+            Runs[LruFirst].LruPrev = run_idx;
+        run->LruNext = LruFirst;
+        LruFirst = run_idx;
+        UpdateMemorySize(run);
+        return run;
+    }
+
+    // Move to front of LRU list
+    ImFontGlyphRun* run = &Runs[run_idx];
+    if (LruFirst != run_idx)
+    {
+        Runs[run->LruPrev].LruNext = run->LruNext;
+        if (run->LruNext != -1)
+            Runs[run->LruNext].LruPrev = run->LruPrev;
+        else
+            LruLast = run->LruPrev;
+        Runs[LruFirst].LruPrev = run_idx;
+        run->LruPrev = -1;
+        run->LruNext = LruFirst;
+        LruFirst = run_idx;
+    }
+    return run;
+}
+
+void ImFontGlyphRunCache::UpdateMemorySize(ImFontGlyphRun* run)
+{
+    const int memory_size = (int)sizeof(ImFontGlyphRun) + run->Text.Capacity + run->Vtx.Capacity * (int)sizeof(ImDrawVert);
+    MemoryUsed += memory_size - run->MemorySize;
+    run->MemorySize = memory_size;
+
+    // Evict least recently used runs, except the one we are working on
+    const int run_idx = (int)(run - Runs.Data);
+    while (MemoryUsed > MemoryBudget && LruLast != -1 && LruLast != run_idx)
+        RemoveRun(LruLast);
+}
+
+void ImFontGlyphRunCache::RemoveRun(int run_idx)
+{
+    ImFontGlyphRun* run = &Runs[run_idx];
+    int* p_idx = &Buckets[run->Hash & (Buckets.Size - 1)];
+    while (*p_idx != run_idx)
+        p_idx = &Runs[*p_idx].HashNext;
+    *p_idx = run->HashNext;
+    if (run->LruPrev != -1) Runs[run->LruPrev].LruNext = run->LruNext; else LruFirst = run->LruNext;
+    if (run->LruNext != -1) Runs[run->LruNext].LruPrev = run->LruPrev; else LruLast = run->LruPrev;
+    MemoryUsed -= run->MemorySize;
+    run->MemorySize = 0;
+    run->Text.clear();
+    run->Vtx.clear();
+    run->HashNext = FreeFirst;
+    FreeFirst = run_idx;
+    RunsCount--;
+}
+
+void ImFontGlyphRunCache::RebuildBuckets(int buckets_count)
+{
+    IM_ASSERT((buckets_count & (buckets_count - 1)) == 0);
+    Buckets.resize(buckets_count);
+    for (int n = 0; n < buckets_count; n++)
+        Buckets[n] = -1;
+    for (int run_idx = LruFirst; run_idx != -1; run_idx = Runs[run_idx].LruNext)
+    {
+        ImFontGlyphRun* run = &Runs[run_idx];
+        int* bucket = &Buckets[run->Hash & (buckets_count - 1)];
+        run->HashNext = *bucket;
+        *bucket = run_idx;
+    }
+}
+
+void ImFontGlyphRunCache::ClearFreeMemory()
+{
+    for (int n = 0; n < Runs.Size; n++)
+    {
+        Runs[n].Text.clear();
+        Runs[n].Vtx.clear();
+    }
+    Runs.clear();
+    Buckets.clear();
+    RunsCount = MemoryUsed = 0;
+    LruFirst = LruLast = FreeFirst = -1;
+}
+
+// Lay out text at (0,0) without clipping, following the same steps as ImFont::RenderText().
+static void ImFontBuildGlyphRunQuads(const ImFont* font, ImFontGlyphRun* run, const char* text_begin, const char* text_end)
+{
+    const float scale = run->Size / font->FontSize;
+    const float line_height = font->FontSize * scale;
+    const float wrap_width = run->WrapWidth;
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    const char* word_wrap_eol = NULL;
+
+    float x = 0.0f;
+    float y = 0.0f;
+    ImRect bounds(0.0f, 0.0f, 0.0f, line_height);
+    run->Vtx.resize(0);
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        if (word_wrap_enabled)
+        {
+            if (!word_wrap_eol)
+            {
+                word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - x);
+                if (word_wrap_eol == s)
+                    word_wrap_eol++;
+            }
+            if (s >= word_wrap_eol)
+            {
+                x = 0.0f;
+                y += line_height;
+                word_wrap_eol = NULL;
+                while (s < text_end)
+                {
+                    const char c = *s;
+                    if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+                }
+                continue;
+            }
+        }
+
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+        {
+            s += 1;
+        }
+        else
+        {
+            s += ImTextCharFromUtf8(&c, s, text_end);
+            if (c == 0)
+                break;
+        }
+
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                x = 0.0f;
+                y += line_height;
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+
+        const ImFontGlyph* glyph = font->FindGlyph((ImWchar)c);
+        if (glyph == NULL)
+            continue;
+        if (glyph->Visible)
+        {
+            const float x1 = x + glyph->X0 * scale;
+            const float x2 = x + glyph->X1 * scale;
+            const float y1 = y + glyph->Y0 * scale;
+            const float y2 = y + glyph->Y1 * scale;
+            const ImU32 col_mask = glyph->Colored ? ~IM_COL32_A_MASK : 0;
+            run->Vtx.resize(run->Vtx.Size + 4);
+            ImDrawVert* vtx = &run->Vtx.Data[run->Vtx.Size - 4];
+            vtx[0].pos = ImVec2(x1, y1); vtx[0].uv = ImVec2(glyph->U0, glyph->V0); vtx[0].col = col_mask;
+            vtx[1].pos = ImVec2(x2, y1); vtx[1].uv = ImVec2(glyph->U1, glyph->V0); vtx[1].col = col_mask;
+            vtx[2].pos = ImVec2(x2, y2); vtx[2].uv = ImVec2(glyph->U1, glyph->V1); vtx[2].col = col_mask;
+            vtx[3].pos = ImVec2(x1, y2); vtx[3].uv = ImVec2(glyph->U0, glyph->V1); vtx[3].col = col_mask;
+            bounds.Add(ImVec2(x1, y1));
+            bounds.Add(ImVec2(x2, y2));
+        }
+        x += glyph->AdvanceX * scale;
+    }
+    bounds.Add(ImVec2(0.0f, y + line_height));
+    run->Bounds = bounds;
+    run->HasQuads = true;
+}
+
+// Emit text from the glyph run cache. Return false when the text is not entirely within clip_rect, in which case the caller needs to clip it.
+// Vertices positions may differ from the uncached path by floating-point rounding, glyphs being offset by 'pos' after being laid out.
+static bool ImFontRenderTextCached(const ImFont* font, ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width)
+{
+    ImFontGlyphRunCache* cache = draw_list->_Data->GlyphRunCache;
+    ImFontGlyphRun* run = cache->GetRun(font, size, wrap_width, text_begin, text_end);
+    if (run->HasQuads)
+    {
+        cache->Hits++;
+    }
+    else
+    {
+        cache->Misses++;
+        ImFontBuildGlyphRunQuads(font, run, text_begin, text_end);
+        cache->UpdateMemorySize(run);
+    }
+    if (pos.x + run->Bounds.Min.x < clip_rect.x || pos.y + run->Bounds.Min.y < clip_rect.y || pos.x + run->Bounds.Max.x > clip_rect.z || pos.y + run->Bounds.Max.y > clip_rect.w)
+        return false;
+
+    // Reserve and give back the same amount as RenderText() would, so VtxOffset changes happen at the same place
+    const int text_len = (int)(text_end - text_begin);
+    const int idx_expected_size = draw_list->IdxBuffer.Size + text_len * 6;
+    draw_list->_PrimReserve(text_len * 6, text_len * 4);
+
+    // Copy vertices then translate and tint them in place
+    const int vtx_count = run->Vtx.Size;
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
+    const float pos_x = pos.x, pos_y = pos.y; // Copy to locals, vertices writes could otherwise alias them
+    memcpy(vtx_write, run->Vtx.Data, (size_t)vtx_count * sizeof(ImDrawVert));
+    for (int n = 0; n < vtx_count; n++)
+    {
+        vtx_write[n].pos.x += pos_x;
+        vtx_write[n].pos.y += pos_y;
+        vtx_write[n].col |= col;
+    }
+    for (int n = 0; n < vtx_count; n += 4, vtx_current_idx += 4, idx_write += 6)
+    {
+        idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
+        idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
+    }
+    vtx_write += vtx_count;
+
+    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data);
+    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_current_idx;
+    return true;
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
 {
@@ -3550,6 +5027,9 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     float y = pos.y;
     if (y > clip_rect.w)
         return;
+    if ((draw_list->Flags & ImDrawListFlags_GlyphRunCache) && !UseDynamicGlyphs && x >= clip_rect.x && y >= clip_rect.y && text_end - text_begin >= IM_FONTGLYPHRUN_CACHE_MIN_LEN && text_end - text_begin <= IM_FONTGLYPHRUN_CACHE_MAX_LEN)
+        if (ImFontRenderTextCached(this, draw_list, size, pos, col, clip_rect, text_begin, text_end, wrap_width))
+            return;
 
     const float scale = size / FontSize;
     const float line_height = FontSize * scale;
@@ -3587,7 +5067,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     const int vtx_count_max = (int)(text_end - s) * 4;
     const int idx_count_max = (int)(text_end - s) * 6;
     const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
-    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    draw_list->_PrimReserve(idx_count_max, vtx_count_max);
 
     ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
@@ -8,6 +8,7 @@
 //  [X] Platform: Gamepad support. Enable with 'io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad'.
 //  [X] Platform: Mouse cursor shape and visibility. Disable with 'io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange' (note: the resizing cursors requires GLFW 3.4+).
 //  [X] Platform: Keyboard arrays indexed using GLFW_KEY_* codes, e.g. ImGui::IsKeyPressed(GLFW_KEY_SPACE).
+//  [X] Platform: Optional power saving mode (block waiting for events while idle instead of rendering continuously). Enable with ImGui_ImplGlfw_SetPowerSaving(), see ImGui_ImplGlfw_WaitForEvents().
 
 // You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
@@ -15,6 +16,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-17: Misc: Added power saving mode: ImGui_ImplGlfw_SetPowerSaving(), ImGui_ImplGlfw_WaitForEvents() (wraps glfwWaitEventsTimeout() using ImGui::GetEventWaitingTime()), ImGui_ImplGlfw_RequestRedraw() and ImGui_ImplGlfw_GetStats().
 //  2020-01-17: Inputs: Disable error callback while assigning mouse cursors because some X11 setup don't have them and it generates errors.
 //  2019-12-05: Inputs: Added support for new mouse cursors added in GLFW 3.4+ (resizing cursors, not allowed cursor).
 //  2019-10-18: Misc: Previously installed user callbacks are now restored on shutdown.
@@ -52,6 +54,7 @@
 #define GLFW_HAS_WINDOW_ALPHA         (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3300) // 3.3+ glfwSetWindowOpacity
 #define GLFW_HAS_PER_MONITOR_DPI      (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3300) // 3.3+ glfwGetMonitorContentScale
 #define GLFW_HAS_VULKAN               (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3200) // 3.2+ glfwCreateWindowSurface
+#define GLFW_HAS_WAIT_EVENTS_TIMEOUT  (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3200) // 3.2+ glfwWaitEventsTimeout
 #ifdef GLFW_RESIZE_NESW_CURSOR  // let's be nice to people who pulled GLFW between 2019-04-16 (3.4 define) and 2019-11-29 (cursors defines) // FIXME: Remove when GLFW 3.4 is released?
 #define GLFW_HAS_NEW_CURSORS          (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3400) // 3.4+ GLFW_RESIZE_ALL_CURSOR, GLFW_RESIZE_NESW_CURSOR, GLFW_RESIZE_NWSE_CURSOR, GLFW_NOT_ALLOWED_CURSOR
 #else
@@ -71,6 +74,11 @@ static double               g_Time = 0.0;
 static bool                 g_MouseJustPressed[ImGuiMouseButton_COUNT] = {};
 static GLFWcursor*          g_MouseCursors[ImGuiMouseCursor_COUNT] = {};
 static bool                 g_InstalledCallbacks = false;
+static bool                 g_PowerSaving = false;
+static ImGui_ImplGlfw_Stats g_Stats = {};
+static double               g_StatsPeriodStart = 0.0;
+static int                  g_StatsPeriodFrames = 0;
+static double               g_StatsPeriodWaitTime = 0.0;
 
 // Chain GLFW callbacks: our callbacks will call the user's previously installed callbacks, if any.
 static GLFWmousebuttonfun   g_PrevUserCallbackMousebutton = NULL;
@@ -372,3 +380,67 @@ void ImGui_ImplGlfw_NewFrame()
     // Update game controllers (if enabled and available)
     ImGui_ImplGlfw_UpdateGamepads();
 }
+
+void ImGui_ImplGlfw_SetPowerSaving(bool enabled)
+{
+    g_PowerSaving = enabled;
+}
+
+// Call once per frame after presenting, in place of glfwPollEvents().
+// When idle we block in glfwWaitEventsTimeout() instead of returning immediately: any GLFW event (input, resize, focus, ImGui_ImplGlfw_RequestRedraw())
+// or the deadline given by ImGui::GetEventWaitingTime() (blinking text cursor, fading, held keys...) wakes us up to render the next frame.
+void ImGui_ImplGlfw_WaitForEvents()
+{
+    double wait_time = 0.0;
+    if (g_PowerSaving)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        wait_time = (double)ImGui::GetEventWaitingTime();
+
+        // Joysticks don't generate GLFW events, keep polling them at a reasonable rate
+        if ((io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad) && (io.BackendFlags & ImGuiBackendFlags_HasGamepad) && wait_time > 1.0 / 60.0)
+            wait_time = 1.0 / 60.0;
+#if !GLFW_HAS_WAIT_EVENTS_TIMEOUT
+        if (wait_time < (double)FLT_MAX)
+            wait_time = 0.0;
+#endif
+    }
+
+    const double wait_start = glfwGetTime();
+    if (wait_time <= 0.0)
+        glfwPollEvents();
+    else if (wait_time >= (double)FLT_MAX)
+        glfwWaitEvents();
+#if GLFW_HAS_WAIT_EVENTS_TIMEOUT
+    else
+        glfwWaitEventsTimeout(wait_time);
+#endif
+    const double wait_end = glfwGetTime();
+
+    // Update statistics over periods of at least one second
+    g_Stats.FramesRendered++;
+    g_StatsPeriodFrames++;
+    g_StatsPeriodWaitTime += (g_PowerSaving && wait_time > 0.0) ? wait_end - wait_start : 0.0;
+    if (g_StatsPeriodStart <= 0.0)
+        g_StatsPeriodStart = wait_start;
+    const double period = wait_end - g_StatsPeriodStart;
+    if (period >= 1.0)
+    {
+        g_Stats.FramesPerSecond = (float)(g_StatsPeriodFrames / period);
+        g_Stats.IdleRatio = (float)(g_StatsPeriodWaitTime / period);
+        g_StatsPeriodStart = wait_end;
+        g_StatsPeriodFrames = 0;
+        g_StatsPeriodWaitTime = 0.0;
+    }
+}
+
+// glfwPostEmptyEvent() may be called from any thread. If the main thread isn't waiting, the event stays queued and the next wait returns immediately.
+void ImGui_ImplGlfw_RequestRedraw()
+{
+    glfwPostEmptyEvent();
+}
+
+const ImGui_ImplGlfw_Stats& ImGui_ImplGlfw_GetStats()
+{
+    return g_Stats;
+}
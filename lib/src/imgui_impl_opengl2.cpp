@@ -3,6 +3,13 @@
 
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Optional streaming of vertex/index data through buffer objects (VBO/IBO). Enable with ImGui_ImplOpenGL2_Flags_UseBufferObjects.
+//  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices, when using buffer objects.
+//  [X] Renderer: Redundant texture/scissor changes are skipped and adjacent compatible ImDrawCmd are merged into a single draw call. See ImGui_ImplOpenGL2_GetStats().
+//  [X] Renderer: Optional host-owned GL state (no state readback/restore, only changes are applied). Enable with ImGui_ImplOpenGL2_Flags_HostOwnsState.
+//  [X] Renderer: Optional partial redraw of the region that changed since the previous frame(s). See ImGui_ImplOpenGL2_ComputeDamage().
+//  [X] Renderer: Optional single-channel (GL_ALPHA) font texture, 4x smaller than RGBA. Enable with ImGui_ImplOpenGL2_Flags_FontAlpha8.
+//  [X] Renderer: Partial font texture updates for glyphs rasterized on demand (ImGuiBackendFlags_RendererHasTexUpdates, see ImFontAtlasFlags_DynamicGlyphs).
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -19,6 +26,12 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-17: OpenGL: Added ImGui_ImplOpenGL2_Flags_FontAlpha8 to upload the font atlas from GetTexDataAsAlpha8() as a GL_ALPHA texture.
+//  2026-10-17: OpenGL: Upload modified regions of the font texture listed in io.Fonts->TexUpdates[] (ImGuiBackendFlags_RendererHasTexUpdates), for ImFontAtlasFlags_DynamicGlyphs.
+//  2026-10-17: OpenGL: Added ImGui_ImplOpenGL2_ComputeDamage() to diff command lists against the previous frames and clip rendering to the changed region.
+//  2026-10-17: OpenGL: Added ImGui_ImplOpenGL2_Flags_HostOwnsState to skip the GL state backup/restore and keep a shadow copy of our state instead, ImGui_ImplOpenGL2_Flags_ValidateState to check the shadow against real GL state, and ImGui_ImplOpenGL2_InvalidateState().
+//  2026-10-17: OpenGL: Track bound texture/scissor to skip redundant calls, merge adjacent ImDrawCmd sharing texture and clip rectangle (across ImDrawList when using buffer objects). Added ImGui_ImplOpenGL2_GetStats().
+//  2026-10-17: OpenGL: Added ImGui_ImplOpenGL2_Flags_UseBufferObjects to upload all command lists of a frame into a single orphaned VBO/IBO pair, with fallback to client-side arrays when GL_ARB_vertex_buffer_object is missing.
 //  2021-12-08: OpenGL: Fixed mishandling of the the ImDrawCmd::IdxOffset field! This is an old bug but it never had an effect until some internal rendering changes in 1.86.
 //  2021-06-29: Reorganized backend to pull data from a single structure to facilitate usage with multiple-contexts (all g_XXXX access changed to bd->XXXX).
 //  2021-05-19: OpenGL: Replaced direct access to ImDrawCmd::TextureId with a call to ImDrawCmd::GetTexID(). (will become a requirement)
@@ -36,6 +49,7 @@
 //  2016-09-05: OpenGL: Fixed save and restore of current scissor rectangle.
 
 #include "imgui.h"
+#include "imgui_internal.h"    // ImHashDataMurmur3, ImMin, ImMax
 #include "imgui_impl_opengl2.h"
 #if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
 #include <stddef.h>     // intptr_t
@@ -56,12 +70,93 @@
 #else
 #include <GL/gl.h>
 #endif
+#include <math.h>       // floorf, ceilf
+#include <stdio.h>      // sscanf
+#include <string.h>     // strstr
+
+// Buffer objects are core in OpenGL 1.5 (or GL_ARB_vertex_buffer_object), which legacy headers (e.g. Windows' gl.h) don't declare.
+// We load the few functions we need through the loader passed to ImGui_ImplOpenGL2_Init().
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER                 0x8892
+#define GL_ELEMENT_ARRAY_BUFFER         0x8893
+#define GL_ARRAY_BUFFER_BINDING         0x8894
+#define GL_ELEMENT_ARRAY_BUFFER_BINDING 0x8895
+#define GL_STREAM_DRAW                  0x88E0
+#endif
+typedef void (APIENTRY *ImGui_ImplOpenGL2_PFNGLGENBUFFERS)(GLsizei n, GLuint* buffers);
+typedef void (APIENTRY *ImGui_ImplOpenGL2_PFNGLDELETEBUFFERS)(GLsizei n, const GLuint* buffers);
+typedef void (APIENTRY *ImGui_ImplOpenGL2_PFNGLBINDBUFFER)(GLenum target, GLuint buffer);
+typedef void (APIENTRY *ImGui_ImplOpenGL2_PFNGLBUFFERDATA)(GLenum target, ptrdiff_t size, const void* data, GLenum usage);
+typedef void (APIENTRY *ImGui_ImplOpenGL2_PFNGLBUFFERSUBDATA)(GLenum target, ptrdiff_t offset, ptrdiff_t size, const void* data);
+
+// Pending draw call, extended while consecutive commands share the same state and have contiguous index ranges
+struct ImGui_ImplOpenGL2_DrawBatch
+{
+    GLuint              TexId;
+    GLint               Scissor[4];
+    const char*         VtxBuffer;
+    const ImDrawIdx*    IdxBuffer;
+    GLsizei             ElemCount;
+};
+
+// GL state last set by RenderDrawData(), to skip redundant calls. Invalidated whenever user code may have touched GL state.
+// Without ImGui_ImplOpenGL2_Flags_HostOwnsState, it is also invalidated every frame since we restore the host's state.
+struct ImGui_ImplOpenGL2_BoundState
+{
+    bool                SetupValid;         // Everything set by SetupRenderState() is in place: fixed-function state, buffer bindings, viewport and projection below
+    GLint               Viewport[4];
+    float               Ortho[4];           // Left, right, bottom, top
+    bool                DrawValid;          // Texture, scissor and vertex pointers below are in place
+    GLuint              TexId;
+    GLint               Scissor[4];
+    const char*         VtxBuffer;
+};
+
+// Partial redraw: what a command list covered when it was last rendered
+struct ImGui_ImplOpenGL2_ListDamageState
+{
+    const ImDrawList*   CmdList;
+    ImU32               Hash;               // Hash of vertices, indices and commands
+    ImVec4              Bounds;             // Framebuffer pixels, top-left origin (x1, y1, x2, y2). Empty when x1 >= x2.
+};
+
+#define IMGUI_IMPL_OPENGL2_DAMAGE_HISTORY   4   // Maximum supported buffer age
 
 struct ImGui_ImplOpenGL2_Data
 {
     GLuint       FontTexture;
-
-    ImGui_ImplOpenGL2_Data() { memset(this, 0, sizeof(*this)); }
+    bool         FontTextureAlpha8;                             // FontTexture is GL_ALPHA, uploaded from io.Fonts->TexPixelsAlpha8 (see ImGui_ImplOpenGL2_Flags_FontAlpha8)
+    ImGui_ImplOpenGL2_Flags Flags;
+
+    // Buffer objects (only when ImGui_ImplOpenGL2_Flags_UseBufferObjects was requested and is supported by the context)
+    bool         UseBufferObjects;
+    GLuint       VboHandle, ElementsHandle;
+    ptrdiff_t    VboSize, ElementsSize;                         // Allocated size of the buffer objects, in bytes. Only grows.
+    ImVector<ImDrawVert> VtxStaging;                            // All command lists of a frame stored back to back, uploaded with a single call
+    ImVector<ImDrawIdx>  IdxStaging;
+    ImGui_ImplOpenGL2_PFNGLGENBUFFERS       GenBuffers;
+    ImGui_ImplOpenGL2_PFNGLDELETEBUFFERS    DeleteBuffers;
+    ImGui_ImplOpenGL2_PFNGLBINDBUFFER       BindBuffer;
+    ImGui_ImplOpenGL2_PFNGLBUFFERDATA       BufferData;
+    ImGui_ImplOpenGL2_PFNGLBUFFERSUBDATA    BufferSubData;
+    bool         IndicesRebased;                                // Indices in IdxStaging were offset to address the whole VtxStaging, so a single vertex pointer setup is needed and draws can be merged across command lists
+
+    ImGui_ImplOpenGL2_BoundState Bound;
+    ImGui_ImplOpenGL2_Stats      Stats;
+
+    // Partial redraw (see ImGui_ImplOpenGL2_ComputeDamage())
+    ImVector<ImGui_ImplOpenGL2_ListDamageState> ListStates;     // Command lists of the last presented frame, in draw order
+    ImVector<ImGui_ImplOpenGL2_ListDamageState> ListStatesNew;
+    ImVec4       DamageHistory[IMGUI_IMPL_OPENGL2_DAMAGE_HISTORY];  // Damaged region of the last frames, most recent first
+    int          DamageHistoryCount;
+    int          DamageFbWidth, DamageFbHeight;
+    bool         DamageValid;                                   // Damage[] applies to the next RenderDrawData() call
+    GLint        Damage[4];                                     // Damaged region as a GL scissor box
+
+    ImGui_ImplOpenGL2_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
 
 // Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
@@ -71,8 +166,36 @@ static ImGui_ImplOpenGL2_Data* ImGui_ImplOpenGL2_GetBackendData()
     return ImGui::GetCurrentContext() ? (ImGui_ImplOpenGL2_Data*)ImGui::GetIO().BackendRendererUserData : NULL;
 }
 
+// Load buffer object functions, using core entry points on OpenGL 1.5+ and ARB ones otherwise.
+// Returns false if the context supports neither, in which case we keep using client-side arrays.
+static bool ImGui_ImplOpenGL2_LoadBufferObjects(ImGui_ImplOpenGL2_Data* bd, ImGui_ImplOpenGL2_GetProcAddressFunc get_proc_address)
+{
+    if (get_proc_address == NULL)
+        return false;
+    const char* version = (const char*)glGetString(GL_VERSION);
+    const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+    int major = 0, minor = 0;
+    if (version)
+        sscanf(version, "%d.%d", &major, &minor);
+    const char* suffix;
+    if (major > 1 || (major == 1 && minor >= 5))
+        suffix = "";
+    else if (extensions && strstr(extensions, "GL_ARB_vertex_buffer_object"))
+        suffix = "ARB";
+    else
+        return false;
+
+    char name[32];
+    snprintf(name, sizeof(name), "glGenBuffers%s", suffix);     bd->GenBuffers = (ImGui_ImplOpenGL2_PFNGLGENBUFFERS)get_proc_address(name);
+    snprintf(name, sizeof(name), "glDeleteBuffers%s", suffix);  bd->DeleteBuffers = (ImGui_ImplOpenGL2_PFNGLDELETEBUFFERS)get_proc_address(name);
+    snprintf(name, sizeof(name), "glBindBuffer%s", suffix);     bd->BindBuffer = (ImGui_ImplOpenGL2_PFNGLBINDBUFFER)get_proc_address(name);
+    snprintf(name, sizeof(name), "glBufferData%s", suffix);     bd->BufferData = (ImGui_ImplOpenGL2_PFNGLBUFFERDATA)get_proc_address(name);
+    snprintf(name, sizeof(name), "glBufferSubData%s", suffix);  bd->BufferSubData = (ImGui_ImplOpenGL2_PFNGLBUFFERSUBDATA)get_proc_address(name);
+    return bd->GenBuffers && bd->DeleteBuffers && bd->BindBuffer && bd->BufferData && bd->BufferSubData;
+}
+
 // Functions
-bool    ImGui_ImplOpenGL2_Init()
+bool    ImGui_ImplOpenGL2_Init(ImGui_ImplOpenGL2_Flags flags, ImGui_ImplOpenGL2_GetProcAddressFunc get_proc_address)
 {
     ImGuiIO& io = ImGui::GetIO();
     IM_ASSERT(io.BackendRendererUserData == NULL && "Already initialized a renderer backend!");
@@ -81,6 +204,14 @@ bool    ImGui_ImplOpenGL2_Init()
     ImGui_ImplOpenGL2_Data* bd = IM_NEW(ImGui_ImplOpenGL2_Data)();
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_opengl2";
+    bd->Flags = flags;
+
+    // Buffer objects are opt-in: fall back to client-side arrays silently when unsupported.
+    if (flags & ImGui_ImplOpenGL2_Flags_UseBufferObjects)
+        bd->UseBufferObjects = ImGui_ImplOpenGL2_LoadBufferObjects(bd, get_proc_address);
+    if (bd->UseBufferObjects)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;     // We upload io.Fonts->TexUpdates[], allowing for glyphs rasterized on demand.
 
     return true;
 }
@@ -94,6 +225,7 @@ void    ImGui_ImplOpenGL2_Shutdown()
     ImGui_ImplOpenGL2_DestroyDeviceObjects();
     io.BackendRendererName = NULL;
     io.BackendRendererUserData = NULL;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTexUpdates);
     IM_DELETE(bd);
 }
 
@@ -108,6 +240,31 @@ void    ImGui_ImplOpenGL2_NewFrame()
 
 static void ImGui_ImplOpenGL2_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height)
 {
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    ImGui_ImplOpenGL2_BoundState* bound = &bd->Bound;
+    const bool host_owns_state = (bd->Flags & ImGui_ImplOpenGL2_Flags_HostOwnsState) != 0;
+    const GLint viewport[4] = { 0, 0, (GLint)fb_width, (GLint)fb_height };
+    const float ortho[4] = { draw_data->DisplayPos.x, draw_data->DisplayPos.x + draw_data->DisplaySize.x, draw_data->DisplayPos.y + draw_data->DisplaySize.y, draw_data->DisplayPos.y };
+
+    // When the host owns the GL state, everything we set last time is still in place unless the host called ImGui_ImplOpenGL2_InvalidateState():
+    // only re-apply what depends on draw_data, and the scissor test which we disable after rendering so it doesn't affect the host's glClear().
+    if (host_owns_state && bound->SetupValid)
+    {
+        glEnable(GL_SCISSOR_TEST);
+        if (memcmp(bound->Viewport, viewport, sizeof(viewport)) != 0)
+            glViewport(viewport[0], viewport[1], (GLsizei)viewport[2], (GLsizei)viewport[3]);
+        if (memcmp(bound->Ortho, ortho, sizeof(ortho)) != 0)
+        {
+            glMatrixMode(GL_PROJECTION);
+            glLoadIdentity();
+            glOrtho(ortho[0], ortho[1], ortho[2], ortho[3], -1.0f, +1.0f);
+            glMatrixMode(GL_MODELVIEW);
+        }
+        memcpy(bound->Viewport, viewport, sizeof(viewport));
+        memcpy(bound->Ortho, ortho, sizeof(ortho));
+        return;
+    }
+
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, vertex/texcoord/color pointers, polygon fill.
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -127,6 +284,13 @@ static void ImGui_ImplOpenGL2_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glShadeModel(GL_SMOOTH);
     glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
 
+    // Bind vertex/index buffers (when not using buffer objects, the array pointers are client memory and nothing must be bound)
+    if (bd->UseBufferObjects)
+    {
+        bd->BindBuffer(GL_ARRAY_BUFFER, bd->VboHandle);
+        bd->BindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle);
+    }
+
     // If you are using this code with non-legacy OpenGL header/contexts (which you should not, prefer using imgui_impl_opengl3.cpp!!),
     // you may need to backup/reset/restore other state, e.g. for current shader using the commented lines below.
     // (DO NOT MODIFY THIS FILE! Add the code in your calling function)
@@ -140,14 +304,336 @@ static void ImGui_ImplOpenGL2_SetupRenderState(ImDrawData* draw_data, int fb_wid
 
     // Setup viewport, orthographic projection matrix
     // Our visible imgui space lies from draw_data->DisplayPos (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
-    glViewport(0, 0, (GLsizei)fb_width, (GLsizei)fb_height);
+    // (when the host owns the GL state, matrices are not pushed since they won't be restored)
+    glViewport(viewport[0], viewport[1], (GLsizei)viewport[2], (GLsizei)viewport[3]);
     glMatrixMode(GL_PROJECTION);
-    glPushMatrix();
+    if (!host_owns_state)
+        glPushMatrix();
     glLoadIdentity();
-    glOrtho(draw_data->DisplayPos.x, draw_data->DisplayPos.x + draw_data->DisplaySize.x, draw_data->DisplayPos.y + draw_data->DisplaySize.y, draw_data->DisplayPos.y, -1.0f, +1.0f);
+    glOrtho(ortho[0], ortho[1], ortho[2], ortho[3], -1.0f, +1.0f);
     glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
+    if (!host_owns_state)
+        glPushMatrix();
     glLoadIdentity();
+
+    memcpy(bound->Viewport, viewport, sizeof(viewport));
+    memcpy(bound->Ortho, ortho, sizeof(ortho));
+    bound->SetupValid = true;
+}
+
+// Check our shadow copy against real GL state. Any mismatch means the host changed state without calling ImGui_ImplOpenGL2_InvalidateState().
+// This reads back state so it stalls the pipeline: only meant for debugging with ImGui_ImplOpenGL2_Flags_ValidateState.
+#define IMGUI_IMPL_OPENGL2_CHECK_STATE(_EXPR, _NAME)    IM_ASSERT((_EXPR) && _NAME " doesn't match the shadow state. Call ImGui_ImplOpenGL2_InvalidateState() after modifying it!")
+static void ImGui_ImplOpenGL2_ValidateState()
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    const ImGui_ImplOpenGL2_BoundState* bound = &bd->Bound;
+    if (bound->SetupValid)
+    {
+        GLint v[4];
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(glIsEnabled(GL_BLEND), "GL_BLEND");
+        glGetIntegerv(GL_BLEND_SRC, &v[0]); glGetIntegerv(GL_BLEND_DST, &v[1]);
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(v[0] == GL_SRC_ALPHA && v[1] == GL_ONE_MINUS_SRC_ALPHA, "glBlendFunc()");
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(!glIsEnabled(GL_CULL_FACE), "GL_CULL_FACE");
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(!glIsEnabled(GL_DEPTH_TEST), "GL_DEPTH_TEST");
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(!glIsEnabled(GL_STENCIL_TEST), "GL_STENCIL_TEST");
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(!glIsEnabled(GL_LIGHTING), "GL_LIGHTING");
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(!glIsEnabled(GL_COLOR_MATERIAL), "GL_COLOR_MATERIAL");
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(!glIsEnabled(GL_SCISSOR_TEST), "GL_SCISSOR_TEST"); // Disabled by RenderDrawData() when done
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(glIsEnabled(GL_VERTEX_ARRAY), "GL_VERTEX_ARRAY");
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(glIsEnabled(GL_TEXTURE_COORD_ARRAY), "GL_TEXTURE_COORD_ARRAY");
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(glIsEnabled(GL_COLOR_ARRAY), "GL_COLOR_ARRAY");
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(!glIsEnabled(GL_NORMAL_ARRAY), "GL_NORMAL_ARRAY");
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(glIsEnabled(GL_TEXTURE_2D), "GL_TEXTURE_2D");
+        glGetIntegerv(GL_POLYGON_MODE, v);
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(v[0] == GL_FILL && v[1] == GL_FILL, "GL_POLYGON_MODE");
+        glGetIntegerv(GL_SHADE_MODEL, v);
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(v[0] == GL_SMOOTH, "GL_SHADE_MODEL");
+        glGetTexEnviv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, v);
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(v[0] == GL_MODULATE, "GL_TEXTURE_ENV_MODE");
+        glGetIntegerv(GL_MATRIX_MODE, v);
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(v[0] == GL_MODELVIEW, "GL_MATRIX_MODE");
+        glGetIntegerv(GL_VIEWPORT, v);
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(memcmp(v, bound->Viewport, sizeof(v)) == 0, "GL_VIEWPORT");
+        if (bd->UseBufferObjects)
+        {
+            glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &v[0]); glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &v[1]);
+            IMGUI_IMPL_OPENGL2_CHECK_STATE((GLuint)v[0] == bd->VboHandle && (GLuint)v[1] == bd->ElementsHandle, "GL_ARRAY_BUFFER_BINDING/GL_ELEMENT_ARRAY_BUFFER_BINDING");
+        }
+    }
+    if (bound->DrawValid)
+    {
+        GLint v[4];
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, v);
+        IMGUI_IMPL_OPENGL2_CHECK_STATE((GLuint)v[0] == bound->TexId, "GL_TEXTURE_BINDING_2D");
+        glGetIntegerv(GL_SCISSOR_BOX, v);
+        IMGUI_IMPL_OPENGL2_CHECK_STATE(memcmp(v, bound->Scissor, sizeof(v)) == 0, "GL_SCISSOR_BOX");
+    }
+}
+#undef IMGUI_IMPL_OPENGL2_CHECK_STATE
+
+static void ImGui_ImplOpenGL2_SetupVertexPointers(const char* vtx_buffer)
+{
+    glVertexPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)(vtx_buffer + IM_OFFSETOF(ImDrawVert, pos)));
+    glTexCoordPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)(vtx_buffer + IM_OFFSETOF(ImDrawVert, uv)));
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), (const GLvoid*)(vtx_buffer + IM_OFFSETOF(ImDrawVert, col)));
+}
+
+// Upload vertices/indices of all command lists into the currently bound buffer objects, back to back.
+// The buffers are orphaned every frame (so the driver doesn't stall on the previous frame still using them) and only grow.
+// When all vertices are addressable by ImDrawIdx, indices are rebased onto the concatenated vertex buffer while copying.
+static void ImGui_ImplOpenGL2_UploadBuffers(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    bd->VtxStaging.resize(draw_data->TotalVtxCount);
+    bd->IdxStaging.resize(draw_data->TotalIdxCount);
+    bd->IndicesRebased = (sizeof(ImDrawIdx) == 4 || draw_data->TotalVtxCount <= 0x10000);
+    ImDrawVert* vtx_dst = bd->VtxStaging.Data;
+    ImDrawIdx* idx_dst = bd->IdxStaging.Data;
+    int global_vtx_offset = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        memcpy(vtx_dst, cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        if (!bd->IndicesRebased)
+        {
+            memcpy(idx_dst, cmd_list->IdxBuffer.Data, (size_t)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+        }
+        else
+        {
+            const ImDrawIdx* idx_src = cmd_list->IdxBuffer.Data;
+            for (int i = 0; i < cmd_list->IdxBuffer.Size; i++)
+                idx_dst[i] = (ImDrawIdx)(idx_src[i] + global_vtx_offset);
+            for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+                if (const unsigned int vtx_offset = cmd_list->CmdBuffer[cmd_i].VtxOffset)
+                    for (unsigned int i = 0, idx_offset = cmd_list->CmdBuffer[cmd_i].IdxOffset; i < cmd_list->CmdBuffer[cmd_i].ElemCount; i++)
+                        idx_dst[idx_offset + i] = (ImDrawIdx)(idx_dst[idx_offset + i] + vtx_offset);
+        }
+        vtx_dst += cmd_list->VtxBuffer.Size;
+        idx_dst += cmd_list->IdxBuffer.Size;
+        global_vtx_offset += cmd_list->VtxBuffer.Size;
+    }
+
+    const ptrdiff_t vtx_size = (ptrdiff_t)bd->VtxStaging.size_in_bytes();
+    const ptrdiff_t idx_size = (ptrdiff_t)bd->IdxStaging.size_in_bytes();
+    if (bd->VboSize < vtx_size)
+        bd->VboSize = (vtx_size > bd->VboSize + bd->VboSize / 2) ? vtx_size : bd->VboSize + bd->VboSize / 2;
+    if (bd->ElementsSize < idx_size)
+        bd->ElementsSize = (idx_size > bd->ElementsSize + bd->ElementsSize / 2) ? idx_size : bd->ElementsSize + bd->ElementsSize / 2;
+    bd->BufferData(GL_ARRAY_BUFFER, bd->VboSize, NULL, GL_STREAM_DRAW);
+    bd->BufferSubData(GL_ARRAY_BUFFER, 0, vtx_size, bd->VtxStaging.Data);
+    bd->BufferData(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsSize, NULL, GL_STREAM_DRAW);
+    bd->BufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_size, bd->IdxStaging.Data);
+}
+
+// Issue the pending draw call, only touching the texture/scissor/vertex pointers that changed since the previous one.
+static void ImGui_ImplOpenGL2_FlushBatch(ImGui_ImplOpenGL2_Data* bd, ImGui_ImplOpenGL2_DrawBatch* batch)
+{
+    if (batch->ElemCount == 0)
+        return;
+    ImGui_ImplOpenGL2_BoundState* bound = &bd->Bound;
+    if (!bound->DrawValid || memcmp(bound->Scissor, batch->Scissor, sizeof(batch->Scissor)) != 0)
+    {
+        glScissor(batch->Scissor[0], batch->Scissor[1], batch->Scissor[2], batch->Scissor[3]);
+        memcpy(bound->Scissor, batch->Scissor, sizeof(batch->Scissor));
+    }
+    else
+    {
+        bd->Stats.ScissorsSkipped++;
+    }
+    if (!bound->DrawValid || bound->TexId != batch->TexId)
+    {
+        glBindTexture(GL_TEXTURE_2D, batch->TexId);
+        bound->TexId = batch->TexId;
+    }
+    else
+    {
+        bd->Stats.TexBindsSkipped++;
+    }
+    if (!bound->DrawValid || bound->VtxBuffer != batch->VtxBuffer)
+    {
+        ImGui_ImplOpenGL2_SetupVertexPointers(batch->VtxBuffer);
+        bound->VtxBuffer = batch->VtxBuffer;
+    }
+    bound->DrawValid = true;
+    glDrawElements(GL_TRIANGLES, batch->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, batch->IdxBuffer);
+    bd->Stats.DrawCalls++;
+    batch->ElemCount = 0;
+}
+
+static inline void ImGui_ImplOpenGL2_AddRect(ImVec4* dst, const ImVec4& src)
+{
+    if (src.x >= src.z || src.y >= src.w)
+        return;
+    if (dst->x >= dst->z || dst->y >= dst->w)
+    {
+        *dst = src;
+        return;
+    }
+    dst->x = ImMin(dst->x, src.x); dst->y = ImMin(dst->y, src.y);
+    dst->z = ImMax(dst->z, src.z); dst->w = ImMax(dst->w, src.w);
+}
+
+// Bounds are the vertices bounding box clipped to the union of clip rectangles, rounded to whole pixels.
+static void ImGui_ImplOpenGL2_CalcListDamageState(const ImDrawList* cmd_list, ImVec2 clip_off, ImVec2 clip_scale, int frame_count, ImGui_ImplOpenGL2_ListDamageState* out_state)
+{
+    ImU32 hash = ImHashDataMurmur3(cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.size_in_bytes(), 0);
+    hash = ImHashDataMurmur3(cmd_list->IdxBuffer.Data, (size_t)cmd_list->IdxBuffer.size_in_bytes(), hash);
+    ImVec4 clip_bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+    {
+        const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+        // Hash fields one by one: a struct of them would have padding bytes on 64-bit targets
+        const ImTextureID tex_id = pcmd->GetTexID();
+        const unsigned int offsets[3] = { pcmd->VtxOffset, pcmd->IdxOffset, pcmd->ElemCount };
+        hash = ImHashDataMurmur3(&pcmd->ClipRect, sizeof(pcmd->ClipRect), hash);
+        hash = ImHashDataMurmur3(&tex_id, sizeof(tex_id), hash);
+        hash = ImHashDataMurmur3(offsets, sizeof(offsets), hash);
+        if (pcmd->UserCallback != NULL && pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+            hash = ImHashDataMurmur3(&frame_count, sizeof(frame_count), hash); // We can't tell what callbacks draw: always dirty
+        else if (pcmd->ElemCount == 0)
+            continue;
+        ImGui_ImplOpenGL2_AddRect(&clip_bounds, pcmd->ClipRect);
+    }
+
+    ImVec4 vtx_bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int vtx_i = 0; vtx_i < cmd_list->VtxBuffer.Size; vtx_i++)
+    {
+        const ImVec2 pos = cmd_list->VtxBuffer.Data[vtx_i].pos;
+        vtx_bounds.x = ImMin(vtx_bounds.x, pos.x); vtx_bounds.y = ImMin(vtx_bounds.y, pos.y);
+        vtx_bounds.z = ImMax(vtx_bounds.z, pos.x); vtx_bounds.w = ImMax(vtx_bounds.w, pos.y);
+    }
+    bool has_callbacks = false;
+    for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size && !has_callbacks; cmd_i++)
+        has_callbacks = cmd_list->CmdBuffer[cmd_i].UserCallback != NULL && cmd_list->CmdBuffer[cmd_i].UserCallback != ImDrawCallback_ResetRenderState;
+    ImVec4 bounds = clip_bounds;
+    if (!has_callbacks)
+    {
+        bounds.x = ImMax(bounds.x, vtx_bounds.x); bounds.y = ImMax(bounds.y, vtx_bounds.y);
+        bounds.z = ImMin(bounds.z, vtx_bounds.z); bounds.w = ImMin(bounds.w, vtx_bounds.w);
+    }
+    if (bounds.x < bounds.z && bounds.y < bounds.w)
+        bounds = ImVec4(floorf((bounds.x - clip_off.x) * clip_scale.x), floorf((bounds.y - clip_off.y) * clip_scale.y), ceilf((bounds.z - clip_off.x) * clip_scale.x), ceilf((bounds.w - clip_off.y) * clip_scale.y));
+    else
+        bounds = ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
+
+    out_state->CmdList = cmd_list;
+    out_state->Hash = hash;
+    out_state->Bounds = bounds;
+}
+
+bool ImGui_ImplOpenGL2_ComputeDamage(ImDrawData* draw_data, int buffer_age, int out_rect[4], float full_redraw_ratio)
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplOpenGL2_Init()?");
+    const int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    const int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    const ImVec4 fb_rect(0.0f, 0.0f, (float)fb_width, (float)fb_height);
+    bd->DamageValid = false;
+    out_rect[0] = out_rect[1] = 0;
+    out_rect[2] = fb_width;
+    out_rect[3] = fb_height;
+    if (fb_width <= 0 || fb_height <= 0)
+        return false;
+
+    // Snapshot this frame
+    bd->ListStatesNew.resize(draw_data->CmdListsCount);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+        ImGui_ImplOpenGL2_CalcListDamageState(draw_data->CmdLists[n], draw_data->DisplayPos, draw_data->FramebufferScale, ImGui::GetFrameCount(), &bd->ListStatesNew[n]);
+
+    // Glyphs rasterized on demand may reuse texture space of evicted glyphs: we don't track which lists used them.
+    ImGuiIO& io = ImGui::GetIO();
+    const bool tex_updated = (io.Fonts->TexUpdates.Size > 0);
+
+    // Diff with the previous frame. Lists present in both frames at the same position damage their old and new bounds when they changed.
+    // From the first position where the sequence of lists differs (a window appeared, disappeared or changed z-order), we can't tell what is composited
+    // differently: all remaining lists damage their bounds.
+    ImVec4 damage(0.0f, 0.0f, 0.0f, 0.0f);
+    const bool full_redraw = (fb_width != bd->DamageFbWidth || fb_height != bd->DamageFbHeight || tex_updated);
+    if (full_redraw)
+    {
+        damage = fb_rect;
+    }
+    else
+    {
+        const int old_count = bd->ListStates.Size;
+        const int new_count = bd->ListStatesNew.Size;
+        int n = 0;
+        for (; n < old_count && n < new_count; n++)
+        {
+            const ImGui_ImplOpenGL2_ListDamageState& old_state = bd->ListStates[n];
+            const ImGui_ImplOpenGL2_ListDamageState& new_state = bd->ListStatesNew[n];
+            if (old_state.CmdList != new_state.CmdList)
+                break;
+            if (old_state.Hash != new_state.Hash || memcmp(&old_state.Bounds, &new_state.Bounds, sizeof(ImVec4)) != 0)
+            {
+                ImGui_ImplOpenGL2_AddRect(&damage, old_state.Bounds);
+                ImGui_ImplOpenGL2_AddRect(&damage, new_state.Bounds);
+            }
+        }
+        for (int old_n = n; old_n < old_count; old_n++)
+            ImGui_ImplOpenGL2_AddRect(&damage, bd->ListStates[old_n].Bounds);
+        for (int new_n = n; new_n < new_count; new_n++)
+            ImGui_ImplOpenGL2_AddRect(&damage, bd->ListStatesNew[new_n].Bounds);
+    }
+    damage.x = ImMax(damage.x, 0.0f); damage.y = ImMax(damage.y, 0.0f);
+    damage.z = ImMin(damage.z, fb_rect.z); damage.w = ImMin(damage.w, fb_rect.w);
+    if (damage.x >= damage.z || damage.y >= damage.w)
+        return false; // Nothing changed: the frame isn't presented so the history stays as is
+
+    // The back buffer also misses the damage of the frames presented since it was last drawn to
+    bd->ListStates.swap(bd->ListStatesNew);
+    bd->DamageFbWidth = fb_width;
+    bd->DamageFbHeight = fb_height;
+    for (int n = IMGUI_IMPL_OPENGL2_DAMAGE_HISTORY - 1; n > 0; n--)
+        bd->DamageHistory[n] = bd->DamageHistory[n - 1];
+    bd->DamageHistory[0] = damage;
+    bd->DamageHistoryCount = full_redraw ? 1 : ImMin(bd->DamageHistoryCount + 1, IMGUI_IMPL_OPENGL2_DAMAGE_HISTORY);
+    if (buffer_age <= 0 || buffer_age > bd->DamageHistoryCount)
+        damage = fb_rect;
+    for (int n = 1; n < buffer_age && n < bd->DamageHistoryCount; n++)
+        ImGui_ImplOpenGL2_AddRect(&damage, bd->DamageHistory[n]);
+    if ((damage.z - damage.x) * (damage.w - damage.y) > full_redraw_ratio * fb_rect.z * fb_rect.w)
+        damage = fb_rect;
+
+    // Y is inverted in OpenGL
+    bd->Damage[0] = (GLint)damage.x;
+    bd->Damage[1] = (GLint)(fb_rect.w - damage.w);
+    bd->Damage[2] = (GLint)(damage.z - damage.x);
+    bd->Damage[3] = (GLint)(damage.w - damage.y);
+    bd->DamageValid = true;
+    memcpy(out_rect, bd->Damage, sizeof(bd->Damage));
+    return true;
+}
+
+// Upload regions of the font texture modified by glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+static void ImGui_ImplOpenGL2_UpdateFontsTexture()
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexUpdates.Size == 0)
+        return;
+    if (bd->FontTexture && (bd->FontTextureAlpha8 ? (void*)atlas->TexPixelsAlpha8 : (void*)atlas->TexPixelsRGBA32))
+    {
+        GLint last_unpack_alignment;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment);
+        glBindTexture(GL_TEXTURE_2D, bd->FontTexture);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, atlas->TexWidth);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (int n = 0; n < atlas->TexUpdates.Size; n++)
+        {
+            const ImFontAtlasTexUpdate& r = atlas->TexUpdates[n];
+            if (bd->FontTextureAlpha8)
+                glTexSubImage2D(GL_TEXTURE_2D, 0, r.X, r.Y, r.Width, r.Height, GL_ALPHA, GL_UNSIGNED_BYTE, atlas->TexPixelsAlpha8 + r.X + r.Y * atlas->TexWidth);
+            else
+                glTexSubImage2D(GL_TEXTURE_2D, 0, r.X, r.Y, r.Width, r.Height, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + r.X + r.Y * atlas->TexWidth);
+        }
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment);
+        bd->Bound.DrawValid = false;
+    }
+    bd->Stats.TexUpdates = atlas->TexUpdates.Size;
+    atlas->TexUpdates.resize(0);
 }
 
 // OpenGL2 Render function.
@@ -161,31 +647,63 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     if (fb_width == 0 || fb_height == 0)
         return;
 
-    // Backup GL state
-    GLint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
-    GLint last_polygon_mode[2]; glGetIntegerv(GL_POLYGON_MODE, last_polygon_mode);
-    GLint last_viewport[4]; glGetIntegerv(GL_VIEWPORT, last_viewport);
-    GLint last_scissor_box[4]; glGetIntegerv(GL_SCISSOR_BOX, last_scissor_box);
-    GLint last_shade_model; glGetIntegerv(GL_SHADE_MODEL, &last_shade_model);
-    GLint last_tex_env_mode; glGetTexEnviv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, &last_tex_env_mode);
-    glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TRANSFORM_BIT);
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    const bool host_owns_state = (bd->Flags & ImGui_ImplOpenGL2_Flags_HostOwnsState) != 0;
+
+    // Backup GL state (unless the host owns it, in which case our state from the previous frame is still in place and we don't restore anything)
+    GLint last_array_buffer = 0, last_element_array_buffer = 0;
+    GLint last_texture = 0, last_polygon_mode[2] = {}, last_viewport[4] = {}, last_scissor_box[4] = {}, last_shade_model = 0, last_tex_env_mode = 0;
+    if (host_owns_state)
+    {
+        if (bd->Flags & ImGui_ImplOpenGL2_Flags_ValidateState)
+            ImGui_ImplOpenGL2_ValidateState();
+    }
+    else
+    {
+        if (bd->UseBufferObjects)
+        {
+            glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &last_array_buffer);
+            glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &last_element_array_buffer);
+        }
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+        glGetIntegerv(GL_POLYGON_MODE, last_polygon_mode);
+        glGetIntegerv(GL_VIEWPORT, last_viewport);
+        glGetIntegerv(GL_SCISSOR_BOX, last_scissor_box);
+        glGetIntegerv(GL_SHADE_MODEL, &last_shade_model);
+        glGetTexEnviv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, &last_tex_env_mode);
+        glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TRANSFORM_BIT);
+        bd->Bound.SetupValid = bd->Bound.DrawValid = false;
+    }
 
-    // Setup desired GL state
+    // Setup desired GL state, upload font texture changes
+    memset(&bd->Stats, 0, sizeof(bd->Stats));
+    ImGui_ImplOpenGL2_UpdateFontsTexture();
     ImGui_ImplOpenGL2_SetupRenderState(draw_data, fb_width, fb_height);
+    if (bd->UseBufferObjects)
+        ImGui_ImplOpenGL2_UploadBuffers(draw_data);
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
     // Render command lists
+    // Consecutive commands sharing texture and clip rectangle, whose indices follow each other, are merged into a single draw call.
+    // Client-side arrays and non-rebased buffer objects have a vertex base per command list, so merging only happens within a list.
+    const bool use_damage = bd->DamageValid;
+    const GLint* damage = bd->Damage;
+    bd->DamageValid = false;
+    bd->Stats.DamageRatio = use_damage ? (float)(damage[2] * damage[3]) / (float)(fb_width * fb_height) : 1.0f;
+    ImGui_ImplOpenGL2_DrawBatch batch;
+    batch.ElemCount = 0;
+    int global_vtx_offset = 0;
+    int global_idx_offset = 0;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
+        // Vertices/indices are read from client memory, or from offsets into our buffer objects where all lists are stored back to back
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
-        const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data;
-        const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data;
-        glVertexPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, pos)));
-        glTexCoordPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, uv)));
-        glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, col)));
+        const bool indices_rebased = bd->UseBufferObjects && bd->IndicesRebased;
+        const char* vtx_buffer = bd->UseBufferObjects ? (const char*)(intptr_t)((indices_rebased ? 0 : global_vtx_offset) * sizeof(ImDrawVert)) : (const char*)cmd_list->VtxBuffer.Data;
+        const ImDrawIdx* idx_buffer = bd->UseBufferObjects ? (const ImDrawIdx*)(intptr_t)(global_idx_offset * sizeof(ImDrawIdx)) : cmd_list->IdxBuffer.Data;
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -194,6 +712,8 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
             {
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                ImGui_ImplOpenGL2_FlushBatch(bd, &batch);
+                bd->Bound.SetupValid = bd->Bound.DrawValid = false; // Callbacks may modify any GL state
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
                     ImGui_ImplOpenGL2_SetupRenderState(draw_data, fb_width, fb_height);
                 else
@@ -207,20 +727,59 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
                 if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
                     continue;
 
-                // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
-                glScissor((int)clip_min.x, (int)(fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y));
-
-                // Bind texture, Draw
-                glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID());
-                glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer + pcmd->IdxOffset);
+                // Scissor/clipping rectangle (Y is inverted in OpenGL)
+                GLint scissor[4] = { (GLint)clip_min.x, (GLint)(fb_height - clip_max.y), (GLint)(clip_max.x - clip_min.x), (GLint)(clip_max.y - clip_min.y) };
+
+                // Partial redraw: clip to the damaged region
+                if (use_damage)
+                {
+                    const GLint x1 = ImMax(scissor[0], damage[0]), y1 = ImMax(scissor[1], damage[1]);
+                    const GLint x2 = ImMin(scissor[0] + scissor[2], damage[0] + damage[2]), y2 = ImMin(scissor[1] + scissor[3], damage[1] + damage[3]);
+                    if (x2 <= x1 || y2 <= y1)
+                    {
+                        bd->Stats.CmdsCulled++;
+                        continue;
+                    }
+                    scissor[0] = x1; scissor[1] = y1; scissor[2] = x2 - x1; scissor[3] = y2 - y1;
+                }
+                const GLuint tex_id = (GLuint)(intptr_t)pcmd->GetTexID();
+
+                // VtxOffset is always 0 unless ImGuiBackendFlags_RendererHasVtxOffset is set, and already applied to indices when rebased
+                const char* cmd_vtx_buffer = vtx_buffer + (indices_rebased ? 0 : pcmd->VtxOffset * sizeof(ImDrawVert));
+                const ImDrawIdx* cmd_idx_buffer = idx_buffer + pcmd->IdxOffset;
+                if (batch.ElemCount > 0 && batch.TexId == tex_id && memcmp(batch.Scissor, scissor, sizeof(scissor)) == 0 && batch.VtxBuffer == cmd_vtx_buffer && batch.IdxBuffer + batch.ElemCount == cmd_idx_buffer)
+                {
+                    batch.ElemCount += (GLsizei)pcmd->ElemCount;
+                    bd->Stats.CmdsMerged++;
+                    continue;
+                }
+                ImGui_ImplOpenGL2_FlushBatch(bd, &batch);
+                batch.TexId = tex_id;
+                memcpy(batch.Scissor, scissor, sizeof(scissor));
+                batch.VtxBuffer = cmd_vtx_buffer;
+                batch.IdxBuffer = cmd_idx_buffer;
+                batch.ElemCount = (GLsizei)pcmd->ElemCount;
             }
         }
+        global_vtx_offset += cmd_list->VtxBuffer.Size;
+        global_idx_offset += cmd_list->IdxBuffer.Size;
     }
+    ImGui_ImplOpenGL2_FlushBatch(bd, &batch);
 
     // Restore modified GL state
+    if (host_owns_state)
+    {
+        glDisable(GL_SCISSOR_TEST);
+        return;
+    }
     glDisableClientState(GL_COLOR_ARRAY);
     glDisableClientState(GL_TEXTURE_COORD_ARRAY);
     glDisableClientState(GL_VERTEX_ARRAY);
+    if (bd->UseBufferObjects)
+    {
+        bd->BindBuffer(GL_ARRAY_BUFFER, (GLuint)last_array_buffer);
+        bd->BindBuffer(GL_ELEMENT_ARRAY_BUFFER, (GLuint)last_element_array_buffer);
+    }
     glBindTexture(GL_TEXTURE_2D, (GLuint)last_texture);
     glMatrixMode(GL_MODELVIEW);
     glPopMatrix();
@@ -234,6 +793,20 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, last_tex_env_mode);
 }
 
+void ImGui_ImplOpenGL2_InvalidateState()
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplOpenGL2_Init()?");
+    bd->Bound.SetupValid = bd->Bound.DrawValid = false;
+}
+
+const ImGui_ImplOpenGL2_Stats& ImGui_ImplOpenGL2_GetStats()
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplOpenGL2_Init()?");
+    return bd->Stats;
+}
+
 bool ImGui_ImplOpenGL2_CreateFontsTexture()
 {
     // Build texture atlas
@@ -241,17 +814,36 @@ bool ImGui_ImplOpenGL2_CreateFontsTexture()
     ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
     unsigned char* pixels;
     int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
+    bd->FontTextureAlpha8 = false;
+    if (bd->Flags & ImGui_ImplOpenGL2_Flags_FontAlpha8)
+    {
+        // With GL_MODULATE, a GL_ALPHA texture outputs (vertex color, vertex alpha * texture alpha): same result as the white RGBA texture.
+        // Colored glyphs (e.g. from the FreeType builder) need the RGBA texture.
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
+        bd->FontTextureAlpha8 = !io.Fonts->TexPixelsUseColors;
+    }
+    if (!bd->FontTextureAlpha8)
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. Use ImGui_ImplOpenGL2_Flags_FontAlpha8 to save on GPU memory.
 
     // Upload texture to graphics system
-    GLint last_texture;
+    GLint last_texture, last_unpack_alignment;
     glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment);
     glGenTextures(1, &bd->FontTexture);
     glBindTexture(GL_TEXTURE_2D, bd->FontTexture);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    if (bd->FontTextureAlpha8)
+    {
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height, 0, GL_ALPHA, GL_UNSIGNED_BYTE, pixels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment);
+    }
+    else
+    {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    }
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
@@ -276,10 +868,24 @@ void ImGui_ImplOpenGL2_DestroyFontsTexture()
 
 bool    ImGui_ImplOpenGL2_CreateDeviceObjects()
 {
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    bd->Bound.SetupValid = bd->Bound.DrawValid = false;
+    if (bd->UseBufferObjects)
+    {
+        bd->GenBuffers(1, &bd->VboHandle);
+        bd->GenBuffers(1, &bd->ElementsHandle);
+        bd->VboSize = bd->ElementsSize = 0;
+    }
     return ImGui_ImplOpenGL2_CreateFontsTexture();
 }
 
 void    ImGui_ImplOpenGL2_DestroyDeviceObjects()
 {
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    bd->Bound.SetupValid = bd->Bound.DrawValid = false;
+    if (bd->VboHandle)      { bd->DeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
+    if (bd->ElementsHandle) { bd->DeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
+    bd->VtxStaging.clear();
+    bd->IdxStaging.clear();
     ImGui_ImplOpenGL2_DestroyFontsTexture();
 }
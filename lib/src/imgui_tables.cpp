@@ -14,6 +14,7 @@ Index of this file:
 // [SECTION] Tables: Columns width management
 // [SECTION] Tables: Drawing
 // [SECTION] Tables: Sorting
+// [SECTION] Tables: Index views
 // [SECTION] Tables: Headers
 // [SECTION] Tables: Context Menu
 // [SECTION] Tables: Settings (.ini data)
@@ -315,7 +316,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         return false;
 
     // Sanity checks
-    IM_ASSERT(columns_count > 0 && columns_count <= IMGUI_TABLE_MAX_COLUMNS && "Only 1..64 columns allowed!");
+    IM_ASSERT(columns_count > 0 && columns_count <= IMGUI_TABLE_MAX_COLUMNS && "Only 1..512 columns allowed!");
     if (flags & ImGuiTableFlags_ScrollX)
         IM_ASSERT(inner_width >= 0.0f);
 
@@ -356,6 +357,13 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
     table->Flags = flags;
     table->InstanceCurrent = (ImS16)instance_no;
     table->LastFrameActive = g.FrameCount;
+    if (instance_no == 0)
+    {
+        // Latch timings of the previous frame for display in Metrics/Debugger
+        table->PerfLastLayoutTime = table->PerfLayoutTime;
+        table->PerfLastEndTime = table->PerfEndTime;
+        table->PerfLayoutTime = table->PerfEndTime = 0.0f;
+    }
     table->OuterWindow = table->InnerWindow = outer_window;
     table->ColumnsCount = columns_count;
     table->IsLayoutLocked = false;
@@ -540,6 +548,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         //IMGUI_DEBUG_LOG("[table] %08X RefScaleUnit %.3f -> %.3f, scaling width by %.3f\n", table->ID, table->RefScaleUnit, new_ref_scale_unit, scale_factor);
         for (int n = 0; n < columns_count; n++)
             table->Columns[n].WidthRequest = table->Columns[n].WidthRequest * scale_factor;
+        table->IsLayoutDirty = true;
     }
     table->RefScale = new_ref_scale_unit;
 
@@ -571,16 +580,22 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
 void ImGui::TableBeginInitMemory(ImGuiTable* table, int columns_count)
 {
     // Allocate single buffer for our arrays
-    ImSpanAllocator<3> span_allocator;
+    ImSpanAllocator<7> span_allocator;
     span_allocator.Reserve(0, columns_count * sizeof(ImGuiTableColumn));
     span_allocator.Reserve(1, columns_count * sizeof(ImGuiTableColumnIdx));
     span_allocator.Reserve(2, columns_count * sizeof(ImGuiTableCellData), 4);
+    for (int n = 3; n < 7; n++)
+        span_allocator.Reserve(n, ImBitArrayGetStorageSizeInBytes(columns_count));
     table->RawData = IM_ALLOC(span_allocator.GetArenaSizeInBytes());
     memset(table->RawData, 0, span_allocator.GetArenaSizeInBytes());
     span_allocator.SetArenaBasePtr(table->RawData);
     span_allocator.GetSpan(0, &table->Columns);
     span_allocator.GetSpan(1, &table->DisplayOrderToIndex);
     span_allocator.GetSpan(2, &table->RowCellData);
+    table->EnabledMaskByDisplayOrder = (ImU32*)span_allocator.GetSpanPtrBegin(3);
+    table->EnabledMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(4);
+    table->VisibleMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(5);
+    table->RequestOutputMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(6);
 }
 
 // Apply queued resizing/reordering/hiding requests
@@ -601,7 +616,10 @@ void ImGui::TableBeginApplyRequests(ImGuiTable* table)
         // FIXME-TABLE: Would be nice to redistribute available stretch space accordingly to other weights, instead of giving it all to siblings.
         if (table->AutoFitSingleColumn != -1)
         {
-            TableSetColumnWidth(table->AutoFitSingleColumn, table->Columns[table->AutoFitSingleColumn].WidthAuto);
+            ImGuiTableColumn* column = &table->Columns[table->AutoFitSingleColumn];
+            if (!column->IsPreserveWidthAuto)
+                column->WidthAuto = TableGetColumnWidthAuto(table, column); // May be out of date when TableUpdateLayout() reused column widths
+            TableSetColumnWidth(table->AutoFitSingleColumn, column->WidthAuto);
             table->AutoFitSingleColumn = -1;
         }
     }
@@ -638,6 +656,7 @@ void ImGui::TableBeginApplyRequests(ImGuiTable* table)
                 table->DisplayOrderToIndex[table->Columns[column_n].DisplayOrder] = (ImGuiTableColumnIdx)column_n;
             table->ReorderColumnDir = 0;
             table->IsSettingsDirty = true;
+            table->IsLayoutDirty = true;
         }
     }
 
@@ -648,6 +667,7 @@ void ImGui::TableBeginApplyRequests(ImGuiTable* table)
             table->DisplayOrderToIndex[n] = table->Columns[n].DisplayOrder = (ImGuiTableColumnIdx)n;
         table->IsResetDisplayOrderRequest = false;
         table->IsSettingsDirty = true;
+        table->IsLayoutDirty = true;
     }
 }
 
@@ -716,223 +736,262 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     ImGuiContext& g = *GImGui;
     IM_ASSERT(table->IsLayoutLocked == false);
 
+    const double perf_time_start = ImGetTimeSeconds();
     const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
-    table->IsDefaultDisplayOrder = true;
-    table->ColumnsEnabledCount = 0;
-    table->EnabledMaskByIndex = 0x00;
-    table->EnabledMaskByDisplayOrder = 0x00;
-    table->LeftMostEnabledColumn = -1;
     table->MinColumnWidth = ImMax(1.0f, g.Style.FramePadding.x * 1.0f); // g.Style.ColumnsMinSpacing; // FIXME-TABLE
+    if ((table->Flags & ImGuiTableFlags_Sortable) && table->SortSpecsCount == 0 && !(table->Flags & ImGuiTableFlags_SortTristate))
+        table->IsSortSpecsDirty = true;
 
-    // [Part 1] Apply/lock Enabled and Order states. Calculate auto/ideal width for columns. Count fixed/stretch columns.
-    // Process columns in their visible orders as we are building the Prev/Next indices.
-    int count_fixed = 0;                // Number of columns that have fixed sizing policies
-    int count_stretch = 0;              // Number of columns that have stretch sizing policies
-    int prev_visible_column_idx = -1;
-    bool has_auto_fit_request = false;
+    // Column widths only depend on the table-wide values hashed below, on per-column setup and sizes (any change to those
+    // sets IsLayoutDirty) and on contents when auto-fitting (which clears IsLayoutCacheable). When none of them changed we
+    // reuse the widths from the previous call and skip [Part 1] to [Part 5].
+    // Positions additionally depend on the values hashed into LayoutPositionsKey: when they are unchanged as well, columns
+    // that were clipped in the previous call are still clipped and [Part 6] only refreshes their per-frame state.
+    const float widths_inputs[] = { table->WorkRect.GetWidth(), table->InnerClipRect.GetWidth(), table->InnerWidth, table->MinColumnWidth, table->OuterPaddingX, table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, (float)table->DeclColumnsCount };
+    const float positions_inputs[] = { table->OuterRect.Min.x, table->WorkRect.Min.x, table->WorkRect.Max.x, table->InnerClipRect.Min.x, table->InnerClipRect.Max.x, (float)table->FreezeColumnsRequest, (float)table->FreezeColumnsCount, (float)table->FreezeRowsCount, table->HostSkipItems ? 1.0f : 0.0f };
+    const ImGuiID widths_key = ImHashData(widths_inputs, sizeof(widths_inputs), (ImGuiID)table->Flags);
+    const ImGuiID positions_key = ImHashData(positions_inputs, sizeof(positions_inputs), widths_key);
+    const bool reuse_widths = table->IsLayoutCacheable && !table->IsLayoutDirty && !table->IsInitializing && table->LayoutWidthsKey == widths_key;
+    const bool reuse_clipped_columns = reuse_widths && table->LayoutPositionsKey == positions_key;
+    if (table->IsLayoutDirty)
+        table->HeaderRowHeightKey = 0;
+    table->LayoutWidthsKey = widths_key;
+    table->LayoutPositionsKey = positions_key;
+    table->IsLayoutDirty = false;
+
+    bool layout_cacheable = true;       // Are widths independent from contents? (no auto-fitting column)
     bool has_resizable = false;
-    float stretch_sum_width_auto = 0.0f;
-    float fixed_max_width_auto = 0.0f;
-    for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+    if (reuse_widths)
     {
-        const int column_n = table->DisplayOrderToIndex[order_n];
-        if (column_n != order_n)
-            table->IsDefaultDisplayOrder = false;
-        ImGuiTableColumn* column = &table->Columns[column_n];
-
-        // Clear column setup if not submitted by user. Currently we make it mandatory to call TableSetupColumn() every frame.
-        // It would easily work without but we're not ready to guarantee it since e.g. names need resubmission anyway.
-        // We take a slight shortcut but in theory we could be calling TableSetupColumn() here with dummy values, it should yield the same effect.
-        if (table->DeclColumnsCount <= column_n)
-        {
-            TableSetupColumnFlags(table, column, ImGuiTableColumnFlags_None);
-            column->NameOffset = -1;
-            column->UserID = 0;
-            column->InitStretchWeightOrWidth = -1.0f;
-        }
-
-        // Update Enabled state, mark settings and sort specs dirty
-        if (!(table->Flags & ImGuiTableFlags_Hideable) || (column->Flags & ImGuiTableColumnFlags_NoHide))
-            column->IsUserEnabledNextFrame = true;
-        if (column->IsUserEnabled != column->IsUserEnabledNextFrame)
+        // Reapply flag cleared every frame by TableSetupColumn(), see [Resize Rule 1] below.
+        if (table->LeftMostStretchedColumn != -1)
+            table->Columns[table->RightMostEnabledColumn].Flags |= ImGuiTableColumnFlags_NoDirectResize_;
+        has_resizable = true;           // Implied by IsLayoutCacheable, see below
+        table->PerfLayoutCachedCount++;
+    }
+    else
+    {
+        table->PerfLayoutFullCount++;
+        table->IsDefaultDisplayOrder = true;
+        table->ColumnsEnabledCount = 0;
+        ImBitArrayClearAllBits(table->EnabledMaskByIndex, table->ColumnsCount);
+        ImBitArrayClearAllBits(table->EnabledMaskByDisplayOrder, table->ColumnsCount);
+        table->LeftMostEnabledColumn = -1;
+
+        // [Part 1] Apply/lock Enabled and Order states. Calculate auto/ideal width for columns. Count fixed/stretch columns.
+        // Process columns in their visible orders as we are building the Prev/Next indices.
+        int count_fixed = 0;                // Number of columns that have fixed sizing policies
+        int count_stretch = 0;              // Number of columns that have stretch sizing policies
+        int prev_visible_column_idx = -1;
+        bool has_auto_fit_request = false;
+        float stretch_sum_width_auto = 0.0f;
+        float fixed_max_width_auto = 0.0f;
+        for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
         {
-            column->IsUserEnabled = column->IsUserEnabledNextFrame;
-            table->IsSettingsDirty = true;
-        }
-        column->IsEnabled = column->IsUserEnabled && (column->Flags & ImGuiTableColumnFlags_Disabled) == 0;
+            const int column_n = table->DisplayOrderToIndex[order_n];
+            if (column_n != order_n)
+                table->IsDefaultDisplayOrder = false;
+            ImGuiTableColumn* column = &table->Columns[column_n];
 
-        if (column->SortOrder != -1 && !column->IsEnabled)
-            table->IsSortSpecsDirty = true;
-        if (column->SortOrder > 0 && !(table->Flags & ImGuiTableFlags_SortMulti))
-            table->IsSortSpecsDirty = true;
+            // Clear column setup if not submitted by user. Currently we make it mandatory to call TableSetupColumn() every frame.
+            // It would easily work without but we're not ready to guarantee it since e.g. names need resubmission anyway.
+            // We take a slight shortcut but in theory we could be calling TableSetupColumn() here with dummy values, it should yield the same effect.
+            if (table->DeclColumnsCount <= column_n)
+            {
+                TableSetupColumnFlags(table, column, ImGuiTableColumnFlags_None);
+                column->NameOffset = -1;
+                column->UserID = 0;
+                column->InitStretchWeightOrWidth = -1.0f;
+            }
 
-        // Auto-fit unsized columns
-        const bool start_auto_fit = (column->Flags & ImGuiTableColumnFlags_WidthFixed) ? (column->WidthRequest < 0.0f) : (column->StretchWeight < 0.0f);
-        if (start_auto_fit)
-            column->AutoFitQueue = column->CannotSkipItemsQueue = (1 << 3) - 1; // Fit for three frames
+            // Update Enabled state, mark settings and sort specs dirty
+            if (!(table->Flags & ImGuiTableFlags_Hideable) || (column->Flags & ImGuiTableColumnFlags_NoHide))
+                column->IsUserEnabledNextFrame = true;
+            if (column->IsUserEnabled != column->IsUserEnabledNextFrame)
+            {
+                column->IsUserEnabled = column->IsUserEnabledNextFrame;
+                table->IsSettingsDirty = true;
+            }
+            column->IsEnabled = column->IsUserEnabled && (column->Flags & ImGuiTableColumnFlags_Disabled) == 0;
 
-        if (!column->IsEnabled)
-        {
-            column->IndexWithinEnabledSet = -1;
-            continue;
-        }
+            if (column->SortOrder != -1 && !column->IsEnabled)
+                table->IsSortSpecsDirty = true;
+            if (column->SortOrder > 0 && !(table->Flags & ImGuiTableFlags_SortMulti))
+                table->IsSortSpecsDirty = true;
 
-        // Mark as enabled and link to previous/next enabled column
-        column->PrevEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
-        column->NextEnabledColumn = -1;
-        if (prev_visible_column_idx != -1)
-            table->Columns[prev_visible_column_idx].NextEnabledColumn = (ImGuiTableColumnIdx)column_n;
-        else
-            table->LeftMostEnabledColumn = (ImGuiTableColumnIdx)column_n;
-        column->IndexWithinEnabledSet = table->ColumnsEnabledCount++;
-        table->EnabledMaskByIndex |= (ImU64)1 << column_n;
-        table->EnabledMaskByDisplayOrder |= (ImU64)1 << column->DisplayOrder;
-        prev_visible_column_idx = column_n;
-        IM_ASSERT(column->IndexWithinEnabledSet <= column->DisplayOrder);
-
-        // Calculate ideal/auto column width (that's the width required for all contents to be visible without clipping)
-        // Combine width from regular rows + width from headers unless requested not to.
-        if (!column->IsPreserveWidthAuto)
-            column->WidthAuto = TableGetColumnWidthAuto(table, column);
-
-        // Non-resizable columns keep their requested width (apply user value regardless of IsPreserveWidthAuto)
-        const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
-        if (column_is_resizable)
-            has_resizable = true;
-        if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && column->InitStretchWeightOrWidth > 0.0f && !column_is_resizable)
-            column->WidthAuto = column->InitStretchWeightOrWidth;
-
-        if (column->AutoFitQueue != 0x00)
-            has_auto_fit_request = true;
-        if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
-        {
-            stretch_sum_width_auto += column->WidthAuto;
-            count_stretch++;
-        }
-        else
-        {
-            fixed_max_width_auto = ImMax(fixed_max_width_auto, column->WidthAuto);
-            count_fixed++;
-        }
-    }
-    if ((table->Flags & ImGuiTableFlags_Sortable) && table->SortSpecsCount == 0 && !(table->Flags & ImGuiTableFlags_SortTristate))
-        table->IsSortSpecsDirty = true;
-    table->RightMostEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
-    IM_ASSERT(table->LeftMostEnabledColumn >= 0 && table->RightMostEnabledColumn >= 0);
-
-    // [Part 2] Disable child window clipping while fitting columns. This is not strictly necessary but makes it possible
-    // to avoid the column fitting having to wait until the first visible frame of the child container (may or not be a good thing).
-    // FIXME-TABLE: for always auto-resizing columns may not want to do that all the time.
-    if (has_auto_fit_request && table->OuterWindow != table->InnerWindow)
-        table->InnerWindow->SkipItems = false;
-    if (has_auto_fit_request)
-        table->IsSettingsDirty = true;
+            // Auto-fit unsized columns
+            const bool start_auto_fit = (column->Flags & ImGuiTableColumnFlags_WidthFixed) ? (column->WidthRequest < 0.0f) : (column->StretchWeight < 0.0f);
+            if (start_auto_fit)
+                column->AutoFitQueue = column->CannotSkipItemsQueue = (1 << 3) - 1; // Fit for three frames
 
-    // [Part 3] Fix column flags and record a few extra information.
-    float sum_width_requests = 0.0f;        // Sum of all width for fixed and auto-resize columns, excluding width contributed by Stretch columns but including spacing/padding.
-    float stretch_sum_weights = 0.0f;       // Sum of all weights for stretch columns.
-    table->LeftMostStretchedColumn = table->RightMostStretchedColumn = -1;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-    {
-        if (!(table->EnabledMaskByIndex & ((ImU64)1 << column_n)))
-            continue;
-        ImGuiTableColumn* column = &table->Columns[column_n];
+            if (!column->IsEnabled)
+            {
+                column->IndexWithinEnabledSet = -1;
+                continue;
+            }
 
-        const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
-        if (column->Flags & ImGuiTableColumnFlags_WidthFixed)
-        {
-            // Apply same widths policy
-            float width_auto = column->WidthAuto;
-            if (table_sizing_policy == ImGuiTableFlags_SizingFixedSame && (column->AutoFitQueue != 0x00 || !column_is_resizable))
-                width_auto = fixed_max_width_auto;
+            // Mark as enabled and link to previous/next enabled column
+            column->PrevEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
+            column->NextEnabledColumn = -1;
+            if (prev_visible_column_idx != -1)
+                table->Columns[prev_visible_column_idx].NextEnabledColumn = (ImGuiTableColumnIdx)column_n;
+            else
+                table->LeftMostEnabledColumn = (ImGuiTableColumnIdx)column_n;
+            column->IndexWithinEnabledSet = table->ColumnsEnabledCount++;
+            ImBitArraySetBit(table->EnabledMaskByIndex, column_n);
+            ImBitArraySetBit(table->EnabledMaskByDisplayOrder, column->DisplayOrder);
+            prev_visible_column_idx = column_n;
+            IM_ASSERT(column->IndexWithinEnabledSet <= column->DisplayOrder);
+
+            // Calculate ideal/auto column width (that's the width required for all contents to be visible without clipping)
+            // Combine width from regular rows + width from headers unless requested not to.
+            if (!column->IsPreserveWidthAuto)
+                column->WidthAuto = TableGetColumnWidthAuto(table, column);
+
+            // Non-resizable columns keep their requested width (apply user value regardless of IsPreserveWidthAuto)
+            const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
+            if (column_is_resizable)
+                has_resizable = true;
+            if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && column->InitStretchWeightOrWidth > 0.0f && !column_is_resizable)
+                column->WidthAuto = column->InitStretchWeightOrWidth;
 
-            // Apply automatic width
-            // Latch initial size for fixed columns and update it constantly for auto-resizing column (unless clipped!)
             if (column->AutoFitQueue != 0x00)
-                column->WidthRequest = width_auto;
-            else if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !column_is_resizable && (table->RequestOutputMaskByIndex & ((ImU64)1 << column_n)))
-                column->WidthRequest = width_auto;
-
-            // FIXME-TABLE: Increase minimum size during init frame to avoid biasing auto-fitting widgets
-            // (e.g. TextWrapped) too much. Otherwise what tends to happen is that TextWrapped would output a very
-            // large height (= first frame scrollbar display very off + clipper would skip lots of items).
-            // This is merely making the side-effect less extreme, but doesn't properly fixes it.
-            // FIXME: Move this to ->WidthGiven to avoid temporary lossyless?
-            // FIXME: This break IsPreserveWidthAuto from not flickering if the stored WidthAuto was smaller.
-            if (column->AutoFitQueue > 0x01 && table->IsInitializing && !column->IsPreserveWidthAuto)
-                column->WidthRequest = ImMax(column->WidthRequest, table->MinColumnWidth * 4.0f); // FIXME-TABLE: Another constant/scale?
-            sum_width_requests += column->WidthRequest;
+                has_auto_fit_request = true;
+            if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
+            {
+                stretch_sum_width_auto += column->WidthAuto;
+                count_stretch++;
+            }
+            else
+            {
+                fixed_max_width_auto = ImMax(fixed_max_width_auto, column->WidthAuto);
+                count_fixed++;
+            }
         }
-        else
+        table->RightMostEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
+        IM_ASSERT(table->LeftMostEnabledColumn >= 0 && table->RightMostEnabledColumn >= 0);
+
+        // [Part 2] Disable child window clipping while fitting columns. This is not strictly necessary but makes it possible
+        // to avoid the column fitting having to wait until the first visible frame of the child container (may or not be a good thing).
+        // FIXME-TABLE: for always auto-resizing columns may not want to do that all the time.
+        if (has_auto_fit_request && table->OuterWindow != table->InnerWindow)
+            table->InnerWindow->SkipItems = false;
+        if (has_auto_fit_request)
+            table->IsSettingsDirty = true;
+
+        // [Part 3] Fix column flags and record a few extra information.
+        float sum_width_requests = 0.0f;        // Sum of all width for fixed and auto-resize columns, excluding width contributed by Stretch columns but including spacing/padding.
+        float stretch_sum_weights = 0.0f;       // Sum of all weights for stretch columns.
+        table->LeftMostStretchedColumn = table->RightMostStretchedColumn = -1;
+        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
         {
-            // Initialize stretch weight
-            if (column->AutoFitQueue != 0x00 || column->StretchWeight < 0.0f || !column_is_resizable)
+            if (!ImBitArrayTestBit(table->EnabledMaskByIndex, column_n))
+                continue;
+            ImGuiTableColumn* column = &table->Columns[column_n];
+
+            const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
+            if (column->Flags & ImGuiTableColumnFlags_WidthFixed)
             {
-                if (column->InitStretchWeightOrWidth > 0.0f)
-                    column->StretchWeight = column->InitStretchWeightOrWidth;
-                else if (table_sizing_policy == ImGuiTableFlags_SizingStretchProp)
-                    column->StretchWeight = (column->WidthAuto / stretch_sum_width_auto) * count_stretch;
-                else
-                    column->StretchWeight = 1.0f;
+                // Apply same widths policy
+                float width_auto = column->WidthAuto;
+                if (table_sizing_policy == ImGuiTableFlags_SizingFixedSame && (column->AutoFitQueue != 0x00 || !column_is_resizable))
+                    width_auto = fixed_max_width_auto;
+
+                // Apply automatic width
+                // Latch initial size for fixed columns and update it constantly for auto-resizing column (unless clipped!)
+                if (column->AutoFitQueue != 0x00)
+                    column->WidthRequest = width_auto;
+                else if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !column_is_resizable && ImBitArrayTestBit(table->RequestOutputMaskByIndex, column_n))
+                    column->WidthRequest = width_auto;
+
+                // FIXME-TABLE: Increase minimum size during init frame to avoid biasing auto-fitting widgets
+                // (e.g. TextWrapped) too much. Otherwise what tends to happen is that TextWrapped would output a very
+                // large height (= first frame scrollbar display very off + clipper would skip lots of items).
+                // This is merely making the side-effect less extreme, but doesn't properly fixes it.
+                // FIXME: Move this to ->WidthGiven to avoid temporary lossyless?
+                // FIXME: This break IsPreserveWidthAuto from not flickering if the stored WidthAuto was smaller.
+                if (column->AutoFitQueue > 0x01 && table->IsInitializing && !column->IsPreserveWidthAuto)
+                    column->WidthRequest = ImMax(column->WidthRequest, table->MinColumnWidth * 4.0f); // FIXME-TABLE: Another constant/scale?
+                sum_width_requests += column->WidthRequest;
             }
+            else
+            {
+                // Initialize stretch weight
+                if (column->AutoFitQueue != 0x00 || column->StretchWeight < 0.0f || !column_is_resizable)
+                {
+                    if (column->InitStretchWeightOrWidth > 0.0f)
+                        column->StretchWeight = column->InitStretchWeightOrWidth;
+                    else if (table_sizing_policy == ImGuiTableFlags_SizingStretchProp)
+                        column->StretchWeight = (column->WidthAuto / stretch_sum_width_auto) * count_stretch;
+                    else
+                        column->StretchWeight = 1.0f;
+                }
 
-            stretch_sum_weights += column->StretchWeight;
-            if (table->LeftMostStretchedColumn == -1 || table->Columns[table->LeftMostStretchedColumn].DisplayOrder > column->DisplayOrder)
-                table->LeftMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
-            if (table->RightMostStretchedColumn == -1 || table->Columns[table->RightMostStretchedColumn].DisplayOrder < column->DisplayOrder)
-                table->RightMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
+                stretch_sum_weights += column->StretchWeight;
+                if (table->LeftMostStretchedColumn == -1 || table->Columns[table->LeftMostStretchedColumn].DisplayOrder > column->DisplayOrder)
+                    table->LeftMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
+                if (table->RightMostStretchedColumn == -1 || table->Columns[table->RightMostStretchedColumn].DisplayOrder < column->DisplayOrder)
+                    table->RightMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
+            }
+            column->IsPreserveWidthAuto = false;
+            sum_width_requests += table->CellPaddingX * 2.0f;
+
+            // Non-resizable columns keep following their contents unless an explicit width/weight was given
+            if (!column_is_resizable && (column->Flags & ImGuiTableColumnFlags_WidthFixed) && (column->InitStretchWeightOrWidth <= 0.0f || table_sizing_policy == ImGuiTableFlags_SizingFixedSame))
+                layout_cacheable = false;
+            if (!column_is_resizable && (column->Flags & ImGuiTableColumnFlags_WidthStretch) && column->InitStretchWeightOrWidth <= 0.0f && table_sizing_policy == ImGuiTableFlags_SizingStretchProp)
+                layout_cacheable = false;
         }
-        column->IsPreserveWidthAuto = false;
-        sum_width_requests += table->CellPaddingX * 2.0f;
-    }
-    table->ColumnsEnabledFixedCount = (ImGuiTableColumnIdx)count_fixed;
-
-    // [Part 4] Apply final widths based on requested widths
-    const ImRect work_rect = table->WorkRect;
-    const float width_spacings = (table->OuterPaddingX * 2.0f) + (table->CellSpacingX1 + table->CellSpacingX2) * (table->ColumnsEnabledCount - 1);
-    const float width_avail = ((table->Flags & ImGuiTableFlags_ScrollX) && table->InnerWidth == 0.0f) ? table->InnerClipRect.GetWidth() : work_rect.GetWidth();
-    const float width_avail_for_stretched_columns = width_avail - width_spacings - sum_width_requests;
-    float width_remaining_for_stretched_columns = width_avail_for_stretched_columns;
-    table->ColumnsGivenWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-    {
-        if (!(table->EnabledMaskByIndex & ((ImU64)1 << column_n)))
-            continue;
-        ImGuiTableColumn* column = &table->Columns[column_n];
-
-        // Allocate width for stretched/weighted columns (StretchWeight gets converted into WidthRequest)
-        if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
+        if (!has_resizable && (table->Flags & ImGuiTableFlags_Resizable))
+            layout_cacheable = false;
+        table->ColumnsEnabledFixedCount = (ImGuiTableColumnIdx)count_fixed;
+
+        // [Part 4] Apply final widths based on requested widths
+        const float width_spacings = (table->OuterPaddingX * 2.0f) + (table->CellSpacingX1 + table->CellSpacingX2) * (table->ColumnsEnabledCount - 1);
+        const float width_avail = ((table->Flags & ImGuiTableFlags_ScrollX) && table->InnerWidth == 0.0f) ? table->InnerClipRect.GetWidth() : table->WorkRect.GetWidth();
+        const float width_avail_for_stretched_columns = width_avail - width_spacings - sum_width_requests;
+        float width_remaining_for_stretched_columns = width_avail_for_stretched_columns;
+        table->ColumnsGivenWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
+        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
         {
-            float weight_ratio = column->StretchWeight / stretch_sum_weights;
-            column->WidthRequest = IM_FLOOR(ImMax(width_avail_for_stretched_columns * weight_ratio, table->MinColumnWidth) + 0.01f);
-            width_remaining_for_stretched_columns -= column->WidthRequest;
-        }
+            if (!ImBitArrayTestBit(table->EnabledMaskByIndex, column_n))
+                continue;
+            ImGuiTableColumn* column = &table->Columns[column_n];
 
-        // [Resize Rule 1] The right-most Visible column is not resizable if there is at least one Stretch column
-        // See additional comments in TableSetColumnWidth().
-        if (column->NextEnabledColumn == -1 && table->LeftMostStretchedColumn != -1)
-            column->Flags |= ImGuiTableColumnFlags_NoDirectResize_;
+            // Allocate width for stretched/weighted columns (StretchWeight gets converted into WidthRequest)
+            if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
+            {
+                float weight_ratio = column->StretchWeight / stretch_sum_weights;
+                column->WidthRequest = IM_FLOOR(ImMax(width_avail_for_stretched_columns * weight_ratio, table->MinColumnWidth) + 0.01f);
+                width_remaining_for_stretched_columns -= column->WidthRequest;
+            }
 
-        // Assign final width, record width in case we will need to shrink
-        column->WidthGiven = ImFloor(ImMax(column->WidthRequest, table->MinColumnWidth));
-        table->ColumnsGivenWidth += column->WidthGiven;
-    }
+            // [Resize Rule 1] The right-most Visible column is not resizable if there is at least one Stretch column
+            // See additional comments in TableSetColumnWidth().
+            if (column->NextEnabledColumn == -1 && table->LeftMostStretchedColumn != -1)
+                column->Flags |= ImGuiTableColumnFlags_NoDirectResize_;
 
-    // [Part 5] Redistribute stretch remainder width due to rounding (remainder width is < 1.0f * number of Stretch column).
-    // Using right-to-left distribution (more likely to match resizing cursor).
-    if (width_remaining_for_stretched_columns >= 1.0f && !(table->Flags & ImGuiTableFlags_PreciseWidths))
-        for (int order_n = table->ColumnsCount - 1; stretch_sum_weights > 0.0f && width_remaining_for_stretched_columns >= 1.0f && order_n >= 0; order_n--)
-        {
-            if (!(table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)))
-                continue;
-            ImGuiTableColumn* column = &table->Columns[table->DisplayOrderToIndex[order_n]];
-            if (!(column->Flags & ImGuiTableColumnFlags_WidthStretch))
-                continue;
-            column->WidthRequest += 1.0f;
-            column->WidthGiven += 1.0f;
-            width_remaining_for_stretched_columns -= 1.0f;
+            // Assign final width, record width in case we will need to shrink
+            column->WidthGiven = ImFloor(ImMax(column->WidthRequest, table->MinColumnWidth));
+            table->ColumnsGivenWidth += column->WidthGiven;
         }
 
+        // [Part 5] Redistribute stretch remainder width due to rounding (remainder width is < 1.0f * number of Stretch column).
+        // Using right-to-left distribution (more likely to match resizing cursor).
+        if (width_remaining_for_stretched_columns >= 1.0f && !(table->Flags & ImGuiTableFlags_PreciseWidths))
+            for (int order_n = table->ColumnsCount - 1; stretch_sum_weights > 0.0f && width_remaining_for_stretched_columns >= 1.0f && order_n >= 0; order_n--)
+            {
+                if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
+                    continue;
+                ImGuiTableColumn* column = &table->Columns[table->DisplayOrderToIndex[order_n]];
+                if (!(column->Flags & ImGuiTableColumnFlags_WidthStretch))
+                    continue;
+                column->WidthRequest += 1.0f;
+                column->WidthGiven += 1.0f;
+                width_remaining_for_stretched_columns -= 1.0f;
+            }
+    }
+
     table->HoveredColumnBody = -1;
     table->HoveredColumnBorder = -1;
     const ImRect mouse_hit_rect(table->OuterRect.Min.x, table->OuterRect.Min.y, table->OuterRect.Max.x, ImMax(table->OuterRect.Max.y, table->OuterRect.Min.y + table->LastOuterHeight));
@@ -940,13 +999,14 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
 
     // [Part 6] Setup final position, offset, skip/clip states and clipping rectangles, detect hovered column
     // Process columns in their visible orders as we are comparing the visible order and adjusting host_clip_rect while looping.
+    const ImRect work_rect = table->WorkRect;
     int visible_n = 0;
     bool offset_x_frozen = (table->FreezeColumnsCount > 0);
     float offset_x = ((table->FreezeColumnsCount > 0) ? table->OuterRect.Min.x : work_rect.Min.x) + table->OuterPaddingX - table->CellSpacingX1;
     ImRect host_clip_rect = table->InnerClipRect;
     //host_clip_rect.Max.x += table->CellPaddingX + table->CellSpacingX2;
-    table->VisibleMaskByIndex = 0x00;
-    table->RequestOutputMaskByIndex = 0x00;
+    ImBitArrayClearAllBits(table->VisibleMaskByIndex, table->ColumnsCount);
+    ImBitArrayClearAllBits(table->RequestOutputMaskByIndex, table->ColumnsCount);
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
         const int column_n = table->DisplayOrderToIndex[order_n];
@@ -963,7 +1023,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         // Clear status flags
         column->Flags &= ~ImGuiTableColumnFlags_StatusMask_;
 
-        if ((table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)) == 0)
+        if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
         {
             // Hidden column: clear a few fields and we are done with it for the remainder of the function.
             // We set a zero-width clip rect but set Min.y/Max.y properly to not interfere with the clipper.
@@ -978,6 +1038,24 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             continue;
         }
 
+        // Column clipped in the previous call with same widths and positions: still clipped, only reset per-frame state.
+        // Like hidden columns, we set Min.y/Max.y of the zero-width clip rect properly to not interfere with the clipper.
+        if (reuse_clipped_columns && !column->IsRequestOutput)
+        {
+            column->Flags |= ImGuiTableColumnFlags_IsEnabled;
+            if (column->SortOrder != -1)
+                column->Flags |= ImGuiTableColumnFlags_IsSorted;
+            column->ClipRect.Min.y = ImClamp(work_rect.Min.y, host_clip_rect.Min.y, host_clip_rect.Max.y);
+            column->ClipRect.Max.y = host_clip_rect.Max.y;
+            column->ContentMaxXFrozen = column->ContentMaxXUnfrozen = column->WorkMinX;
+            column->ContentMaxXHeadersUsed = column->ContentMaxXHeadersIdeal = column->WorkMinX;
+            if (visible_n < table->FreezeColumnsCount)
+                host_clip_rect.Min.x = ImClamp(column->MaxX + TABLE_BORDER_SIZE, host_clip_rect.Min.x, host_clip_rect.Max.x);
+            offset_x += column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
+            visible_n++;
+            continue;
+        }
+
         // Detect hovered column
         if (is_hovering_table && g.IO.MousePos.x >= column->ClipRect.Min.x && g.IO.MousePos.x < column->ClipRect.Max.x)
             table->HoveredColumnBody = (ImGuiTableColumnIdx)column_n;
@@ -986,6 +1064,9 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         column->MinX = offset_x;
 
         // Lock width based on start position and minimum/maximum width for this position
+        // (when reusing widths, restore the value computed by [Part 4] and [Part 5] before it got clamped in the previous call)
+        if (reuse_widths)
+            column->WidthGiven = ImFloor(ImMax(column->WidthRequest, table->MinColumnWidth));
         float max_width = TableGetMaxColumnWidth(table, column_n);
         column->WidthGiven = ImMin(column->WidthGiven, max_width);
         column->WidthGiven = ImMax(column->WidthGiven, ImMin(column->WidthRequest, table->MinColumnWidth));
@@ -1016,12 +1097,12 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         column->IsVisibleY = true; // (column->ClipRect.Max.y > column->ClipRect.Min.y);
         const bool is_visible = column->IsVisibleX; //&& column->IsVisibleY;
         if (is_visible)
-            table->VisibleMaskByIndex |= ((ImU64)1 << column_n);
+            ImBitArraySetBit(table->VisibleMaskByIndex, column_n);
 
         // Mark column as requesting output from user. Note that fixed + non-resizable sets are auto-fitting at all times and therefore always request output.
         column->IsRequestOutput = is_visible || column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0;
         if (column->IsRequestOutput)
-            table->RequestOutputMaskByIndex |= ((ImU64)1 << column_n);
+            ImBitArraySetBit(table->RequestOutputMaskByIndex, column_n);
 
         // Mark column as SkipItems (ignoring all items/layout)
         column->IsSkipItems = !column->IsEnabled || table->HostSkipItems;
@@ -1056,6 +1137,8 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             column->AutoFitQueue >>= 1;
             column->CannotSkipItemsQueue >>= 1;
         }
+        if (column->AutoFitQueue != 0)
+            layout_cacheable = false;
 
         if (visible_n < table->FreezeColumnsCount)
             host_clip_rect.Min.x = ImClamp(column->MaxX + TABLE_BORDER_SIZE, host_clip_rect.Min.x, host_clip_rect.Max.x);
@@ -1063,6 +1146,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         offset_x += column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
         visible_n++;
     }
+    table->IsLayoutCacheable = layout_cacheable;
 
     // [Part 7] Detect/store when we are hovering the unused space after the right-most column (so e.g. context menus can react on it)
     // Clear Resizable flag if none of our column are actually resizable (either via an explicit _NoResize flag, either
@@ -1099,6 +1183,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     table->LastFirstRowHeight = 0.0f;
     table->IsLayoutLocked = true;
     table->IsUsingHeaders = false;
+    table->PerfLayoutTime += (float)((ImGetTimeSeconds() - perf_time_start) * 1000.0);
 
     // [Part 11] Context menu
     if (table->IsContextPopupOpen && table->InstanceCurrent == table->InstanceInteracted)
@@ -1148,7 +1233,7 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
 
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
-        if (!(table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)))
+        if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
             continue;
 
         const int column_n = table->DisplayOrderToIndex[order_n];
@@ -1207,6 +1292,7 @@ void    ImGui::EndTable()
     if (!table->IsLayoutLocked)
         TableUpdateLayout(table);
 
+    const double perf_time_start = ImGetTimeSeconds();
     const ImGuiTableFlags flags = table->Flags;
     ImGuiWindow* inner_window = table->InnerWindow;
     ImGuiWindow* outer_window = table->OuterWindow;
@@ -1282,7 +1368,7 @@ void    ImGui::EndTable()
     const float width_spacings = (table->OuterPaddingX * 2.0f) + (table->CellSpacingX1 + table->CellSpacingX2) * (table->ColumnsEnabledCount - 1);
     table->ColumnsAutoFitWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-        if (table->EnabledMaskByIndex & ((ImU64)1 << column_n))
+        if (ImBitArrayTestBit(table->EnabledMaskByIndex, column_n))
         {
             ImGuiTableColumn* column = &table->Columns[column_n];
             if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !(column->Flags & ImGuiTableColumnFlags_NoResize))
@@ -1378,6 +1464,7 @@ void    ImGui::EndTable()
     if (table->IsSettingsDirty)
         TableSaveSettings(table);
     table->IsInitializing = false;
+    table->PerfEndTime += (float)((ImGetTimeSeconds() - perf_time_start) * 1000.0);
 
     // Clear or restore current table, if any
     IM_ASSERT(g.CurrentWindow == outer_window && g.CurrentTable == table);
@@ -1421,9 +1508,13 @@ void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, flo
         if ((table->Flags & ImGuiTableFlags_SizingMask_) == ImGuiTableFlags_SizingFixedFit || (table->Flags & ImGuiTableFlags_SizingMask_) == ImGuiTableFlags_SizingFixedSame)
             flags |= ImGuiTableColumnFlags_WidthFixed;
 
+    // Changing flags or width/weight invalidates the column widths reused by TableUpdateLayout()
+    const ImGuiTableColumnFlags prev_flags = column->Flags & ~(ImGuiTableColumnFlags_StatusMask_ | ImGuiTableColumnFlags_NoDirectResize_);
     TableSetupColumnFlags(table, column, flags);
     column->UserID = user_id;
     flags = column->Flags;
+    if ((flags & ~ImGuiTableColumnFlags_StatusMask_) != prev_flags || column->InitStretchWeightOrWidth != init_width_or_weight)
+        table->IsLayoutDirty = true;
 
     // Initialize defaults
     column->InitStretchWeightOrWidth = init_width_or_weight;
@@ -1551,6 +1642,8 @@ void ImGui::TableSetColumnEnabled(int column_n, bool enabled)
     IM_ASSERT(column_n >= 0 && column_n < table->ColumnsCount);
     ImGuiTableColumn* column = &table->Columns[column_n];
     column->IsUserEnabledNextFrame = enabled;
+    if (column->IsUserEnabled != enabled)
+        table->IsLayoutDirty = true;
 }
 
 // We allow querying for an extra column in order to poll the IsHovered state of the right-most section
@@ -1623,7 +1716,7 @@ void ImGui::TableSetBgColor(ImGuiTableBgTarget target, ImU32 color, int column_n
             return;
         if (column_n == -1)
             column_n = table->CurrentColumn;
-        if ((table->VisibleMaskByIndex & ((ImU64)1 << column_n)) == 0)
+        if (!ImBitArrayTestBit(table->VisibleMaskByIndex, column_n))
             return;
         if (table->RowCellDataCurrent < 0 || table->RowCellData[table->RowCellDataCurrent].Column != column_n)
             table->RowCellDataCurrent++;
@@ -1898,7 +1991,7 @@ bool ImGui::TableSetColumnIndex(int column_n)
 
     // Return whether the column is visible. User may choose to skip submitting items based on this return value,
     // however they shouldn't skip submitting for columns that may have the tallest contribution to row height.
-    return (table->RequestOutputMaskByIndex & ((ImU64)1 << column_n)) != 0;
+    return ImBitArrayTestBit(table->RequestOutputMaskByIndex, column_n);
 }
 
 // [Public] Append into the next column, wrap and create a new row when already on last column
@@ -1924,7 +2017,7 @@ bool ImGui::TableNextColumn()
     // Return whether the column is visible. User may choose to skip submitting items based on this return value,
     // however they shouldn't skip submitting for columns that may have the tallest contribution to row height.
     int column_n = table->CurrentColumn;
-    return (table->RequestOutputMaskByIndex & ((ImU64)1 << column_n)) != 0;
+    return ImBitArrayTestBit(table->RequestOutputMaskByIndex, column_n);
 }
 
 
@@ -2087,6 +2180,7 @@ void ImGui::TableSetColumnWidth(int column_n, float width)
     column_0_width = ImClamp(column_0_width, min_width, max_width);
     if (column_0->WidthGiven == column_0_width || column_0->WidthRequest == column_0_width)
         return;
+    table->IsLayoutDirty = true;
 
     //IMGUI_DEBUG_LOG("TableSetColumnWidth(%d, %.1f->%.1f)\n", column_0_idx, column_0->WidthGiven, column_0_width);
     ImGuiTableColumn* column_1 = (column_0->NextEnabledColumn != -1) ? &table->Columns[column_0->NextEnabledColumn] : NULL;
@@ -2161,6 +2255,7 @@ void ImGui::TableSetColumnWidthAutoSingle(ImGuiTable* table, int column_n)
         return;
     column->CannotSkipItemsQueue = (1 << 0);
     table->AutoFitSingleColumn = (ImGuiTableColumnIdx)column_n;
+    table->IsLayoutDirty = true;
 }
 
 void ImGui::TableSetColumnWidthAutoAll(ImGuiTable* table)
@@ -2173,6 +2268,7 @@ void ImGui::TableSetColumnWidthAutoAll(ImGuiTable* table)
         column->CannotSkipItemsQueue = (1 << 0);
         column->AutoFitQueue = (1 << 1);
     }
+    table->IsLayoutDirty = true;
 }
 
 void ImGui::TableUpdateColumnsWeightFromWidth(ImGuiTable* table)
@@ -2258,10 +2354,15 @@ void ImGui::TablePopBackgroundChannel()
 // Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
+    // Only visible columns get their own channels (clipped ones all use the dummy channel), which matters with hundreds of columns.
+    int columns_visible_count = 0;
+    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+        if (table->Columns[column_n].IsVisibleX && table->Columns[column_n].IsVisibleY)
+            columns_visible_count++;
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : columns_visible_count;
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
-    const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || table->VisibleMaskByIndex != table->EnabledMaskByIndex) ? +1 : 0;
+    const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0) ? +1 : 0;
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
     table->DrawSplitter->Split(table->InnerWindow->DrawList, channels_total);
     table->DummyDrawChannel = (ImGuiTableDrawChannelIdx)((channels_for_dummy > 0) ? channels_total - 1 : -1);
@@ -2347,7 +2448,7 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     // 1. Scan channels and take note of those which can be merged
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
-        if ((table->VisibleMaskByIndex & ((ImU64)1 << column_n)) == 0)
+        if (!ImBitArrayTestBit(table->VisibleMaskByIndex, column_n))
             continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
 
@@ -2510,7 +2611,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
     {
         for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
         {
-            if (!(table->EnabledMaskByDisplayOrder & ((ImU64)1 << order_n)))
+            if (!ImBitArrayTestBit(table->EnabledMaskByDisplayOrder, order_n))
                 continue;
 
             const int column_n = table->DisplayOrderToIndex[order_n];
@@ -2691,7 +2792,8 @@ void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
 
     // Clear SortOrder from hidden column and verify that there's no gap or duplicate.
     int sort_order_count = 0;
-    ImU64 sort_order_mask = 0x00;
+    bool need_fix_linearize = false;
+    ImBitArray<IMGUI_TABLE_MAX_COLUMNS> sort_order_mask;
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
         ImGuiTableColumn* column = &table->Columns[column_n];
@@ -2700,26 +2802,30 @@ void ImGui::TableSortSpecsSanitize(ImGuiTable* table)
         if (column->SortOrder == -1)
             continue;
         sort_order_count++;
-        sort_order_mask |= ((ImU64)1 << column->SortOrder);
-        IM_ASSERT(sort_order_count < (int)sizeof(sort_order_mask) * 8);
+        if (column->SortOrder < 0 || column->SortOrder >= table->ColumnsCount || sort_order_mask.TestBit(column->SortOrder))
+            need_fix_linearize = true;
+        else
+            sort_order_mask.SetBit(column->SortOrder);
     }
+    for (int sort_n = 0; sort_n < sort_order_count && !need_fix_linearize; sort_n++)
+        if (!sort_order_mask.TestBit(sort_n))
+            need_fix_linearize = true;
 
-    const bool need_fix_linearize = ((ImU64)1 << sort_order_count) != (sort_order_mask + 1);
     const bool need_fix_single_sort_order = (sort_order_count > 1) && !(table->Flags & ImGuiTableFlags_SortMulti);
     if (need_fix_linearize || need_fix_single_sort_order)
     {
-        ImU64 fixed_mask = 0x00;
+        ImBitArray<IMGUI_TABLE_MAX_COLUMNS> fixed_mask;
         for (int sort_n = 0; sort_n < sort_order_count; sort_n++)
         {
             // Fix: Rewrite sort order fields if needed so they have no gap or duplicate.
             // (e.g. SortOrder 0 disappeared, SortOrder 1..2 exists --> rewrite then as SortOrder 0..1)
             int column_with_smallest_sort_order = -1;
             for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-                if ((fixed_mask & ((ImU64)1 << (ImU64)column_n)) == 0 && table->Columns[column_n].SortOrder != -1)
+                if (!fixed_mask.TestBit(column_n) && table->Columns[column_n].SortOrder != -1)
                     if (column_with_smallest_sort_order == -1 || table->Columns[column_n].SortOrder < table->Columns[column_with_smallest_sort_order].SortOrder)
                         column_with_smallest_sort_order = column_n;
             IM_ASSERT(column_with_smallest_sort_order != -1);
-            fixed_mask |= ((ImU64)1 << column_with_smallest_sort_order);
+            fixed_mask.SetBit(column_with_smallest_sort_order);
             table->Columns[column_with_smallest_sort_order].SortOrder = (ImGuiTableColumnIdx)sort_n;
 
             // Fix: Make sure only one column has a SortOrder if ImGuiTableFlags_MultiSortable is not set.
@@ -2782,6 +2888,497 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Tables: Index views
+//-------------------------------------------------------------------------
+// - ImGuiTableIndexView::ImGuiTableIndexView()
+// - ImGuiTableIndexView::~ImGuiTableIndexView()
+// - ImGuiTableIndexView::Clear()
+// - ImGuiTableIndexView::AddRows()
+// - ImGuiTableIndexView::Rebuild()
+// - ImGuiTableIndexView::Update()
+// - ImGuiTableIndexView::IsUpdating()
+// - TableIndexViewSortRows() [Internal]
+// - TableIndexViewFilterRows() [Internal]
+// - TableIndexViewMergeRows() [Internal]
+// - TableIndexViewJobFunc() [Internal]
+//-------------------------------------------------------------------------
+
+// With ParallelForFn, rows are split in up to IM_TABLE_INDEX_VIEW_TASKS_MAX chunks of at least IM_TABLE_INDEX_VIEW_TASK_ROWS_MIN rows
+#define IM_TABLE_INDEX_VIEW_TASK_ROWS_MIN   (16 * 1024)
+#define IM_TABLE_INDEX_VIEW_TASKS_MAX       64
+
+static int TableIndexViewCompareRows(const ImGuiTableIndexView* view, int row_a, int row_b)
+{
+    const ImGuiTableColumnSortSpecs* specs = view->SortSpecs.Data;
+    for (int n = 0; n < view->SortSpecs.Size; n++)
+        if (int d = view->CompareFn(&specs[n], row_a, row_b, view->UserData))
+            return ((d > 0) == (specs[n].SortDirection == ImGuiSortDirection_Ascending)) ? +1 : -1;
+
+    // Ties are ordered by row index in the direction of the first spec, so flipping every direction reverses the order.
+    return ((row_a > row_b) == (specs[0].SortDirection == ImGuiSortDirection_Ascending)) ? +1 : -1;
+}
+
+static int TableIndexViewGetTasksCount(const ImGuiTableIndexView* view, int rows_count)
+{
+    if (view->ParallelForFn == NULL)
+        return 1;
+    return ImClamp(rows_count / IM_TABLE_INDEX_VIEW_TASK_ROWS_MIN, 1, IM_TABLE_INDEX_VIEW_TASKS_MAX);
+}
+
+static void TableIndexViewParallelFor(const ImGuiTableIndexView* view, int count, void (*func)(void* data, int index), void* data)
+{
+    if (view->ParallelForFn != NULL && count > 1)
+        view->ParallelForFn(count, func, data, view->ParallelForUserData);
+    else
+        for (int n = 0; n < count; n++)
+            func(data, n);
+}
+
+// Merge sorted rows a[0..a_count) and b[0..b_count) into out[]
+static void TableIndexViewMerge(const ImGuiTableIndexView* view, const int* a, int a_count, const int* b, int b_count, int* out)
+{
+    const int* a_end = a + a_count;
+    const int* b_end = b + b_count;
+    while (a < a_end && b < b_end)
+        *out++ = (TableIndexViewCompareRows(view, *b, *a) < 0) ? *b++ : *a++;
+    memcpy(out, a, (size_t)(a_end - a) * sizeof(int));
+    memcpy(out + (a_end - a), b, (size_t)(b_end - b) * sizeof(int));
+}
+
+// Merge sort of rows[0..count) using temp[0..count)
+static void TableIndexViewSortSerial(const ImGuiTableIndexView* view, int* rows, int* temp, int count)
+{
+    if (count <= 16)
+    {
+        for (int i = 1; i < count; i++)
+        {
+            const int row = rows[i];
+            int j = i;
+            for (; j > 0 && TableIndexViewCompareRows(view, row, rows[j - 1]) < 0; j--)
+                rows[j] = rows[j - 1];
+            rows[j] = row;
+        }
+        return;
+    }
+    const int half = count / 2;
+    TableIndexViewSortSerial(view, rows, temp, half);
+    TableIndexViewSortSerial(view, rows + half, temp + half, count - half);
+    if (TableIndexViewCompareRows(view, rows[half - 1], rows[half]) < 0)
+        return; // Already in order (e.g. data sorted on another column which is correlated)
+    TableIndexViewMerge(view, rows, half, rows + half, count - half, temp);
+    memcpy(rows, temp, (size_t)count * sizeof(int));
+}
+
+struct ImGuiTableIndexViewSortTask
+{
+    const ImGuiTableIndexView*  View;
+    int*                        Src;
+    int*                        Dst;
+    int                         RowsCount;
+    int                         ChunksCount;    // Power of two
+    int                         RunChunks;      // Number of chunks in a sorted run of Src[] (merge passes)
+    int                         MergePieces;    // Number of tasks a merge of two runs is split into (merge passes)
+
+    int     GetChunkStart(int chunk_n) const    { return (int)((ImS64)chunk_n * RowsCount / ChunksCount); }
+};
+
+static void TableIndexViewSortChunkTask(void* data, int chunk_n)
+{
+    ImGuiTableIndexViewSortTask* task = (ImGuiTableIndexViewSortTask*)data;
+    const int start = task->GetChunkStart(chunk_n);
+    TableIndexViewSortSerial(task->View, task->Src + start, task->Dst + start, task->GetChunkStart(chunk_n + 1) - start);
+}
+
+// Number of rows of 'a' within the first 'k' rows of the merge of 'a' and 'b' (rows are never equal as ties are ordered by index)
+static int TableIndexViewMergeSplit(const ImGuiTableIndexView* view, const int* a, int a_count, const int* b, int b_count, int k)
+{
+    int lo = ImMax(0, k - b_count);
+    int hi = ImMin(k, a_count);
+    while (lo < hi)
+    {
+        const int i = (lo + hi) / 2;
+        if (TableIndexViewCompareRows(view, a[i], b[k - i - 1]) < 0)
+            lo = i + 1;
+        else
+            hi = i;
+    }
+    return lo;
+}
+
+// Merge a piece of two consecutive runs: the output range of each piece is found by binary search so pieces are independent.
+static void TableIndexViewMergePieceTask(void* data, int task_n)
+{
+    ImGuiTableIndexViewSortTask* task = (ImGuiTableIndexViewSortTask*)data;
+    const int merge_n = task_n / task->MergePieces;
+    const int piece_n = task_n % task->MergePieces;
+    const int a_start = task->GetChunkStart(merge_n * 2 * task->RunChunks);
+    const int b_start = task->GetChunkStart((merge_n * 2 + 1) * task->RunChunks);
+    const int b_end = task->GetChunkStart((merge_n * 2 + 2) * task->RunChunks);
+    const int* a = task->Src + a_start;
+    const int* b = task->Src + b_start;
+    const int a_count = b_start - a_start;
+    const int b_count = b_end - b_start;
+    const int k0 = (int)((ImS64)piece_n * (a_count + b_count) / task->MergePieces);
+    const int k1 = (int)((ImS64)(piece_n + 1) * (a_count + b_count) / task->MergePieces);
+    const int i0 = TableIndexViewMergeSplit(task->View, a, a_count, b, b_count, k0);
+    const int i1 = TableIndexViewMergeSplit(task->View, a, a_count, b, b_count, k1);
+    TableIndexViewMerge(task->View, a + i0, i1 - i0, b + (k0 - i0), (k1 - i1) - (k0 - i0), task->Dst + a_start + k0);
+}
+
+// Sort rows[] with view->SortSpecs. Chunks are sorted in parallel, then pairs of sorted runs are merged in parallel,
+// each merge being split in pieces so every pass keeps all tasks busy.
+static void TableIndexViewSortRows(ImGuiTableIndexView* view, ImVector<int>& rows)
+{
+    if (view->CompareFn == NULL || view->SortSpecs.Size == 0 || rows.Size <= 1)
+        return;
+    ImVector<int>& temp = view->TempRows;
+    temp.resize(rows.Size);
+
+    int chunks_count = 1;
+    while (chunks_count * 2 <= TableIndexViewGetTasksCount(view, rows.Size))
+        chunks_count *= 2;
+    ImGuiTableIndexViewSortTask task;
+    task.View = view;
+    task.Src = rows.Data;
+    task.Dst = temp.Data;
+    task.RowsCount = rows.Size;
+    task.ChunksCount = chunks_count;
+    TableIndexViewParallelFor(view, chunks_count, TableIndexViewSortChunkTask, &task);
+    for (task.RunChunks = 1; task.RunChunks < chunks_count; task.RunChunks *= 2)
+    {
+        task.MergePieces = task.RunChunks * 2;
+        TableIndexViewParallelFor(view, chunks_count, TableIndexViewMergePieceTask, &task);
+        ImSwap(task.Src, task.Dst);
+    }
+    if (task.Src != rows.Data)
+        rows.swap(temp);
+}
+
+struct ImGuiTableIndexViewFilterTask
+{
+    const ImGuiTableIndexView*  View;
+    const ImGuiTextFilter*      Filter;
+    const int*                  Src;
+    int*                        Dst;
+    int                         RowsCount;
+    int                         TasksCount;
+    int                         PassCount[IM_TABLE_INDEX_VIEW_TASKS_MAX];
+};
+
+static void TableIndexViewFilterTask(void* data, int task_n)
+{
+    ImGuiTableIndexViewFilterTask* task = (ImGuiTableIndexViewFilterTask*)data;
+    const int start = (int)((ImS64)task_n * task->RowsCount / task->TasksCount);
+    const int end = (int)((ImS64)(task_n + 1) * task->RowsCount / task->TasksCount);
+    int* out = task->Dst + start;
+    for (int n = start; n < end; n++)
+    {
+        const int row = task->Src[n];
+        if (task->Filter->PassFilter(task->View->GetRowTextFn(row, task->View->UserData)))
+            *out++ = row;
+    }
+    task->PassCount[task_n] = (int)(out - (task->Dst + start));
+}
+
+// Write rows of src[0..src_count) passing the filter to out[] (in order). Chunks are tested in parallel then packed.
+static void TableIndexViewFilterRows(ImGuiTableIndexView* view, const ImGuiTextFilter* filter, const int* src, int src_count, ImVector<int>& out)
+{
+    out.resize(src_count);
+    ImGuiTableIndexViewFilterTask task;
+    task.View = view;
+    task.Filter = filter;
+    task.Src = src;
+    task.Dst = out.Data;
+    task.RowsCount = src_count;
+    task.TasksCount = TableIndexViewGetTasksCount(view, src_count);
+    TableIndexViewParallelFor(view, task.TasksCount, TableIndexViewFilterTask, &task);
+    int out_count = 0;
+    for (int task_n = 0; task_n < task.TasksCount; task_n++)
+    {
+        const int start = (int)((ImS64)task_n * src_count / task.TasksCount);
+        memmove(out.Data + out_count, out.Data + start, (size_t)task.PassCount[task_n] * sizeof(int));
+        out_count += task.PassCount[task_n];
+    }
+    out.resize(out_count);
+}
+
+// Merge sorted rows[] into sorted dst[]: the position of each row is found by binary search (k log n comparisons)
+// and rows of dst[] are moved once, from the end.
+static void TableIndexViewMergeRows(const ImGuiTableIndexView* view, ImVector<int>& dst, const int* rows, int rows_count)
+{
+    const bool sorted = (view->CompareFn != NULL && view->SortSpecs.Size > 0);
+    int dst_end = dst.Size;
+    dst.resize(dst.Size + rows_count);
+    int write_n = dst.Size;
+    for (int n = rows_count - 1; n >= 0; n--)
+    {
+        int lo = sorted ? 0 : dst_end;
+        int hi = dst_end;
+        while (lo < hi)
+        {
+            const int mid = (lo + hi) / 2;
+            if (TableIndexViewCompareRows(view, dst[mid], rows[n]) < 0)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        write_n -= dst_end - lo;
+        memmove(dst.Data + write_n, dst.Data + lo, (size_t)(dst_end - lo) * sizeof(int));
+        dst[--write_n] = rows[n];
+        dst_end = lo;
+    }
+}
+
+// Return true if rows passing a filter 'text' all pass a filter 'prev_text': when 'text' only extends the last term of 'prev_text',
+// and that term is not an exclusion (see ImGuiTextFilter::PassFilter()). An empty 'prev_text' lets all rows pass.
+static bool TableIndexViewIsFilterNarrowing(const char* prev_text, const char* text)
+{
+    if (prev_text[0] == 0)
+        return true;
+    const size_t prev_len = strlen(prev_text);
+    if (strncmp(prev_text, text, prev_len) != 0 || strchr(text + prev_len, ',') != NULL)
+        return false;
+    const char* last_term = strrchr(prev_text, ',');
+    last_term = last_term ? last_term + 1 : prev_text;
+    while (*last_term == ' ' || *last_term == '\t')
+        last_term++;
+    return last_term[0] != 0 && last_term[0] != '-';
+}
+
+// The only state shared with the thread running the AsyncJobFn job is JobState (read/written with ImAtomicLoad()/ImAtomicStore()). Other Job*
+// fields are written before starting the job and read after it is done, and the job only reads SortedRows[], Rows[] and SortSpecs[], which
+// Update() doesn't modify meanwhile.
+
+// Sort all rows and/or filter them, writing to JobSortedRows[] and JobRows[]
+static void TableIndexViewJobFunc(void* data)
+{
+    ImGuiTableIndexView* view = (ImGuiTableIndexView*)data;
+    if (view->JobSort)
+    {
+        view->JobSortedRows.resize(view->JobRowsCount);
+        for (int n = 0; n < view->JobRowsCount; n++)
+            view->JobSortedRows[n] = n;
+        TableIndexViewSortRows(view, view->JobSortedRows);
+    }
+    const ImVector<int>& sorted_rows = view->JobSort ? view->JobSortedRows : view->SortedRows;
+    if (view->JobFilterText[0] == 0)
+    {
+        view->JobRows = sorted_rows;
+    }
+    else
+    {
+        ImGuiTextFilter filter(view->JobFilterText.Data);
+        const ImVector<int>& src = view->JobNarrowFilter ? view->Rows : sorted_rows;
+        TableIndexViewFilterRows(view, &filter, src.Data, src.Size, view->JobRows);
+    }
+    ImAtomicStore(&view->JobState, 2);
+}
+
+static void TableIndexViewWaitJob(ImGuiTableIndexView* view)
+{
+    while (ImAtomicLoad(&view->JobState) == 1)
+        ImSleepMilliseconds(1);
+}
+
+ImGuiTableIndexView::ImGuiTableIndexView()
+{
+    CompareFn = NULL;
+    GetRowTextFn = NULL;
+    UserData = NULL;
+    ParallelForFn = NULL;
+    ParallelForUserData = NULL;
+    AsyncJobFn = NULL;
+    AsyncJobUserData = NULL;
+    RowsCount = 0;
+    NeedRebuild = false;
+    JobState = 0;
+    JobSort = JobNarrowFilter = false;
+    JobRowsCount = 0;
+}
+
+ImGuiTableIndexView::~ImGuiTableIndexView()
+{
+    TableIndexViewWaitJob(this);
+}
+
+void ImGuiTableIndexView::Clear()
+{
+    TableIndexViewWaitJob(this);
+    JobState = 0;
+    JobRows.clear();
+    JobSortedRows.clear();
+    JobFilterText.clear();
+    Rows.clear();
+    SortedRows.clear();
+    SortSpecs.clear();
+    FilterText.clear();
+    TempRows.clear();
+    RowsCount = 0;
+    NeedRebuild = false;
+}
+
+// Rows are merged on the next Update() (SortedRows[] holds rows [0, SortedRows.Size) until then)
+void ImGuiTableIndexView::AddRows(int rows_count)
+{
+    IM_ASSERT(rows_count >= 0);
+    RowsCount += rows_count;
+}
+
+void ImGuiTableIndexView::Rebuild(int rows_count)
+{
+    IM_ASSERT(rows_count >= 0);
+    RowsCount = rows_count;
+    NeedRebuild = true;
+}
+
+bool ImGuiTableIndexView::IsUpdating() const
+{
+    return ImAtomicLoad((volatile int*)&JobState) != 0;
+}
+
+bool ImGuiTableIndexView::Update(const ImGuiTextFilter* filter)
+{
+    ImGuiContext& g = *GImGui;
+    bool changed = false;
+
+    // Swap the results of the AsyncJobFn job once done. Until then, changes are picked up by the Update() call swapping the results.
+    const int job_state = ImAtomicLoad(&JobState);
+    if (job_state == 1)
+        return false;
+    if (job_state == 2)
+    {
+        if (JobSort)
+            SortedRows.swap(JobSortedRows);
+        Rows.swap(JobRows);
+        FilterText.swap(JobFilterText);
+        JobState = 0;
+        changed = true;
+    }
+
+    bool need_sort = NeedRebuild;
+    bool need_filter = NeedRebuild;
+    NeedRebuild = false;
+
+    // Sort specs of the current table (compared every time rather than relying on SpecsDirty, which may be cleared by other code)
+    ImGuiTableSortSpecs* sort_specs = (g.CurrentTable != NULL && CompareFn != NULL) ? ImGui::TableGetSortSpecs() : NULL;
+    if (sort_specs != NULL)
+    {
+        bool same_columns = (sort_specs->SpecsCount == SortSpecs.Size);
+        bool same_directions = same_columns, reversed_directions = same_columns;
+        for (int n = 0; n < SortSpecs.Size && same_columns; n++)
+        {
+            const ImGuiTableColumnSortSpecs* spec = &sort_specs->Specs[n];
+            same_columns = (spec->ColumnIndex == SortSpecs[n].ColumnIndex && spec->ColumnUserID == SortSpecs[n].ColumnUserID);
+            same_directions &= (spec->SortDirection == SortSpecs[n].SortDirection);
+            reversed_directions &= (spec->SortDirection != SortSpecs[n].SortDirection);
+        }
+        if (!same_columns || !same_directions)
+        {
+            SortSpecs.resize(sort_specs->SpecsCount);
+            if (sort_specs->SpecsCount > 0)
+                memcpy(SortSpecs.Data, sort_specs->Specs, (size_t)SortSpecs.size_in_bytes());
+            if (same_columns && reversed_directions && SortSpecs.Size > 0 && !need_sort)
+            {
+                // Every direction flipped (e.g. clicked on the header of a single sorted column): the order is reversed
+                for (int n = 0; n < SortedRows.Size / 2; n++)
+                    ImSwap(SortedRows[n], SortedRows[SortedRows.Size - 1 - n]);
+                for (int n = 0; n < Rows.Size / 2; n++)
+                    ImSwap(Rows[n], Rows[Rows.Size - 1 - n]);
+                changed = true;
+            }
+            else
+            {
+                need_sort = need_filter = true;
+            }
+        }
+        sort_specs->SpecsDirty = false;
+    }
+
+    // Filter text compared to the one of the view
+    const char* filter_text = (filter != NULL && filter->IsActive() && GetRowTextFn != NULL) ? filter->InputBuf : "";
+    const char* prev_filter_text = FilterText.Size ? FilterText.Data : "";
+    bool narrow_filter = false;
+    if (!need_filter && strcmp(prev_filter_text, filter_text) != 0)
+    {
+        need_filter = true;
+        narrow_filter = TableIndexViewIsFilterNarrowing(prev_filter_text, filter_text);
+    }
+
+    // Hand sorting all rows and filtering to the AsyncJobFn job. Rows added since the last update are merged into SortedRows[] first
+    // when only filtering, in which case all sorted rows are filtered so they make it to the view.
+    if (AsyncJobFn != NULL && (need_sort || (need_filter && filter_text[0] != 0)))
+    {
+        if (!need_sort && SortedRows.Size < RowsCount)
+        {
+            ImVector<int> new_rows;
+            new_rows.resize(RowsCount - SortedRows.Size);
+            for (int n = 0; n < new_rows.Size; n++)
+                new_rows[n] = SortedRows.Size + n;
+            TableIndexViewSortRows(this, new_rows);
+            TableIndexViewMergeRows(this, SortedRows, new_rows.Data, new_rows.Size);
+            narrow_filter = false;
+        }
+        JobSort = need_sort;
+        JobNarrowFilter = narrow_filter && !need_sort;
+        JobRowsCount = RowsCount;
+        JobFilterText.resize((int)strlen(filter_text) + 1);
+        memcpy(JobFilterText.Data, filter_text, (size_t)JobFilterText.Size);
+        ImAtomicStore(&JobState, 1);
+        AsyncJobFn(TableIndexViewJobFunc, this, AsyncJobUserData);
+        return changed;
+    }
+
+    // Sort all rows, or the rows added since the last update
+    const int new_rows_start = need_sort ? 0 : SortedRows.Size;
+    ImVector<int> new_rows;
+    if (need_sort)
+    {
+        SortedRows.resize(RowsCount);
+        for (int n = 0; n < RowsCount; n++)
+            SortedRows[n] = n;
+        TableIndexViewSortRows(this, SortedRows);
+    }
+    else if (new_rows_start < RowsCount)
+    {
+        new_rows.resize(RowsCount - new_rows_start);
+        for (int n = 0; n < new_rows.Size; n++)
+            new_rows[n] = new_rows_start + n;
+        TableIndexViewSortRows(this, new_rows);
+        TableIndexViewMergeRows(this, SortedRows, new_rows.Data, new_rows.Size);
+    }
+
+    // Filter all rows, or the rows of the view when the filter narrows
+    if (need_filter && filter_text[0] == 0)
+    {
+        Rows = SortedRows;
+    }
+    else if (need_filter)
+    {
+        const ImVector<int>& src = narrow_filter ? Rows : SortedRows;
+        TableIndexViewFilterRows(this, filter, src.Data, src.Size, TempRows);
+        Rows.swap(TempRows);
+    }
+    if (need_filter)
+    {
+        FilterText.resize((int)strlen(filter_text) + 1);
+        memcpy(FilterText.Data, filter_text, (size_t)FilterText.Size);
+    }
+
+    // Merge added rows into the view (unless already filtered from all rows)
+    if (new_rows.Size > 0 && (!need_filter || narrow_filter))
+    {
+        if (filter_text[0] != 0)
+        {
+            TableIndexViewFilterRows(this, filter, new_rows.Data, new_rows.Size, TempRows);
+            new_rows.swap(TempRows);
+        }
+        TableIndexViewMergeRows(this, Rows, new_rows.Data, new_rows.Size);
+    }
+
+    return changed || need_filter || new_rows.Size > 0;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -2796,6 +3393,16 @@ float ImGui::TableGetHeaderRowHeight()
     // Calculate row height, for the unlikely case that some labels may be taller than others.
     // If we didn't do that, uneven header height would highlight but smaller one before the tallest wouldn't catch input for all height.
     // In your custom header row you may omit this all together and just call TableNextRow() without a height...
+    // The result is cached until the font, names or set of enabled columns change (the later invalidates it in TableUpdateLayout()).
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    const float key_inputs[] = { g.FontSize, g.Style.CellPadding.y };
+    ImGuiID key = ImHashData(key_inputs, sizeof(key_inputs), ImHashData(&g.Font, sizeof(g.Font)));
+    if (table != NULL)
+        key = ImHashData(table->ColumnsNames.Buf.Data, (size_t)table->ColumnsNames.Buf.Size, key);
+    if (table != NULL && table->HeaderRowHeightKey == key && key != 0)
+        return table->HeaderRowHeight;
+
     float row_height = GetTextLineHeight();
     int columns_count = TableGetColumnCount();
     for (int column_n = 0; column_n < columns_count; column_n++)
@@ -2805,6 +3412,11 @@ float ImGui::TableGetHeaderRowHeight()
             row_height = ImMax(row_height, CalcTextSize(TableGetColumnName(column_n)).y);
     }
     row_height += GetStyle().CellPadding.y * 2.0f;
+    if (table != NULL)
+    {
+        table->HeaderRowHeight = row_height;
+        table->HeaderRowHeightKey = key;
+    }
     return row_height;
 }
 
@@ -3107,7 +3719,10 @@ void ImGui::TableDrawContextMenu(ImGuiTable* table)
             if (other_column->IsUserEnabled && table->ColumnsEnabledCount <= 1)
                 menu_item_active = false;
             if (MenuItem(name, NULL, other_column->IsUserEnabled, menu_item_active))
+            {
                 other_column->IsUserEnabledNextFrame = !other_column->IsUserEnabled;
+                table->IsLayoutDirty = true;
+            }
         }
         PopItemFlag();
     }
@@ -3121,6 +3736,7 @@ void ImGui::TableDrawContextMenu(ImGuiTable* table)
 // - TableSettingsInit() [Internal]
 // - TableSettingsCalcChunkSize() [Internal]
 // - TableSettingsCreate() [Internal]
+// - TableSettingsUnpackBinary() [Internal]
 // - TableSettingsFindByID() [Internal]
 // - TableGetBoundSettings() [Internal]
 // - TableResetSettings()
@@ -3131,6 +3747,8 @@ void ImGui::TableDrawContextMenu(ImGuiTable* table)
 // - TableSettingsHandler_ReadOpen() [Internal]
 // - TableSettingsHandler_ReadLine() [Internal]
 // - TableSettingsHandler_WriteAll() [Internal]
+// - TableSettingsHandler_ReadBinary() [Internal]
+// - TableSettingsHandler_WriteBinary() [Internal]
 // - TableSettingsInstallHandler() [Internal]
 //-------------------------------------------------------------------------
 // [Init] 1: TableSettingsHandler_ReadXXXX()   Load and parse .ini file into TableSettings.
@@ -3162,18 +3780,68 @@ ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
     ImGuiContext& g = *GImGui;
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
+    g.SettingsTablesMap.SetInt(id, g.SettingsTables.offset_from_ptr(settings));
+    return settings;
+}
+
+// Create settings from a record of the data given to LoadIniSettingsFromBinary()
+static ImGuiTableSettings* TableSettingsUnpackBinary(const ImGuiTableSettingsRecord* record)
+{
+    ImGuiContext& g = *GImGui;
+    const int columns_count = record->ColumnsCount;
+    const size_t columns_available = (size_t)g.SettingsTablesBinary.ExtraSize / sizeof(ImGuiTableColumnSettingsRecord);
+    if (columns_count < 0 || columns_count > IMGUI_TABLE_MAX_COLUMNS || record->ColumnsOffset > columns_available || (size_t)columns_count > columns_available - record->ColumnsOffset)
+        return NULL;
+
+    ImGuiTableSettings* settings = ImGui::TableSettingsCreate(record->ID, columns_count);
+    settings->SaveFlags = record->SaveFlags;
+    settings->RefScale = record->RefScale;
+    const ImGuiTableColumnSettingsRecord* column_record = (const ImGuiTableColumnSettingsRecord*)(const void*)g.SettingsTablesBinary.Extra + record->ColumnsOffset;
+    ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+    for (int column_n = 0; column_n < columns_count; column_n++, column++, column_record++)
+    {
+        column->WidthOrWeight = column_record->WidthOrWeight;
+        column->UserID = column_record->UserID;
+        column->Index = column_record->Index;
+        column->DisplayOrder = column_record->DisplayOrder;
+        column->SortOrder = column_record->SortOrder;
+        column->SortDirection = column_record->Flags & 0x03;
+        column->IsEnabled = (column_record->Flags >> 2) & 1;
+        column->IsStretch = (column_record->Flags >> 3) & 1;
+    }
     return settings;
 }
 
+// Create settings for all records which haven't been used yet, then stop referencing the binary data
+static void TableSettingsUnpackAllBinary(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiSettingsBinaryRecords* binary = &g.SettingsTablesBinary;
+    for (int n = 0; n < binary->Count; n++)
+    {
+        const ImGuiTableSettingsRecord* record = (const ImGuiTableSettingsRecord*)(const void*)(binary->Data + n * binary->Stride);
+        if (g.SettingsTablesMap.GetInt(record->ID, 0) == 0)
+            TableSettingsUnpackBinary(record);
+    }
+    binary->Clear();
+}
+
 // Find existing settings
+// The map points to the last settings created for an ID: older ones were invalidated (ID set to 0) before a new one was created.
+// Settings of tables which haven't been submitted yet may still be in binary data: they are unpacked here on first use.
 ImGuiTableSettings* ImGui::TableSettingsFindByID(ImGuiID id)
 {
-    // FIXME-OPT: Might want to store a lookup map for this?
     ImGuiContext& g = *GImGui;
-    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsTablesMap.GetInt(id, 0); // Offsets are never 0 (chunk header)
+    if (offset == 0)
+    {
+        if (g.SettingsTablesBinary.Count > 0)
+            if (const ImGuiTableSettingsRecord* record = (const ImGuiTableSettingsRecord*)g.SettingsTablesBinary.Find(id))
+                return TableSettingsUnpackBinary(record);
+        return NULL;
+    }
+    ImGuiTableSettings* settings = g.SettingsTables.ptr_from_offset(offset);
+    return (settings->ID == id) ? settings : NULL;
 }
 
 // Get settings for a given table, NULL if none
@@ -3251,6 +3919,7 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
     }
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
+    settings->IniCache.Size = 0;
 
     MarkIniSettingsDirty();
 }
@@ -3280,10 +3949,12 @@ void ImGui::TableLoadSettings(ImGuiTable* table)
 
     table->SettingsLoadedFlags = settings->SaveFlags;
     table->RefScale = settings->RefScale;
+    table->IsLayoutDirty = true;
 
     // Serialize ImGuiTableSettings/ImGuiTableColumnSettings into ImGuiTable/ImGuiTableColumn
     ImGuiTableColumnSettings* column_settings = settings->GetColumnSettings();
-    ImU64 display_order_mask = 0;
+    ImBitArray<IMGUI_TABLE_MAX_COLUMNS> display_order_mask;
+    int display_order_count = 0;
     for (int data_n = 0; data_n < settings->ColumnsCount; data_n++, column_settings++)
     {
         int column_n = column_settings->Index;
@@ -3303,15 +3974,19 @@ void ImGui::TableLoadSettings(ImGuiTable* table)
             column->DisplayOrder = column_settings->DisplayOrder;
         else
             column->DisplayOrder = (ImGuiTableColumnIdx)column_n;
-        display_order_mask |= (ImU64)1 << column->DisplayOrder;
+        if (column->DisplayOrder >= 0 && column->DisplayOrder < settings->ColumnsCount && !display_order_mask.TestBit(column->DisplayOrder))
+        {
+            display_order_mask.SetBit(column->DisplayOrder);
+            display_order_count++;
+        }
         column->IsUserEnabled = column->IsUserEnabledNextFrame = column_settings->IsEnabled;
         column->SortOrder = column_settings->SortOrder;
         column->SortDirection = column_settings->SortDirection;
     }
 
     // Validate and fix invalid display order data
-    const ImU64 expected_display_order_mask = (settings->ColumnsCount == 64) ? ~0 : ((ImU64)1 << settings->ColumnsCount) - 1;
-    if (display_order_mask != expected_display_order_mask)
+    // (we expect each of 0..ColumnsCount-1 exactly once)
+    if (display_order_count != settings->ColumnsCount)
         for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
             table->Columns[column_n].DisplayOrder = (ImGuiTableColumnIdx)column_n;
 
@@ -3327,6 +4002,8 @@ static void TableSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandle
         if (ImGuiTable* table = g.Tables.TryGetMapData(i))
             table->SettingsOffset = -1;
     g.SettingsTables.clear();
+    g.SettingsTablesMap.Clear();
+    g.SettingsTablesBinary.Clear();
 }
 
 // Apply to existing windows (if any)
@@ -3389,6 +4066,7 @@ static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*,
 static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
 {
     ImGuiContext& g = *ctx;
+    TableSettingsUnpackAllBinary(ctx); // Text output has every entry
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
     {
         if (settings->ID == 0) // Skip ditched settings
@@ -3403,6 +4081,11 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
         if (!save_size && !save_visible && !save_order && !save_sort)
             continue;
 
+        // Copy entries that haven't changed since the last save
+        if (ImGui::AppendIniSettingsCache(&settings->IniCache, buf))
+            continue;
+
+        const int entry_begin = buf->size();
         buf->reserve(buf->size() + 30 + settings->ColumnsCount * 50); // ballpark reserve
         buf->appendf("[%s][0x%08X,%d]\n", handler->TypeName, settings->ID, settings->ColumnsCount);
         if (settings->RefScale != 0.0f)
@@ -3424,9 +4107,110 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
             buf->append("\n");
         }
         buf->append("\n");
+        ImGui::UpdateIniSettingsCache(&settings->IniCache, buf, entry_begin);
     }
 }
 
+static void TableSettingsHandler_ReadBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, const void* data, size_t data_size)
+{
+    // Unpack what is left of previously loaded data, which may not stay valid
+    ImGuiContext& g = *ctx;
+    TableSettingsUnpackAllBinary(ctx);
+    if (!ImGui::BeginBinarySettingsRecords(&g.SettingsTablesBinary, data, data_size, sizeof(ImGuiTableSettingsRecord)))
+        return;
+
+    // Override existing settings (as LoadIniSettingsFromMemory() does): ditch them so they get unpacked again from the new data.
+    // ApplyAll makes existing tables reload their settings.
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+        if (settings->ID != 0 && g.SettingsTablesBinary.Find(settings->ID))
+        {
+            g.SettingsTablesMap.SetInt(settings->ID, 0);
+            settings->ID = 0;
+        }
+}
+
+IM_STATIC_ASSERT(sizeof(ImGuiTableSettingsRecord) == 20 && sizeof(ImGuiTableColumnSettingsRecord) == 16);
+
+static void TableSettingsHandler_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImVector<char>* buf)
+{
+    // Records come from settings entries (skipping the ones TableSettingsHandler_WriteAll() skips),
+    // and from loaded binary data for tables which haven't been submitted
+    ImGuiContext& g = *ctx;
+    const ImGuiTableFlags save_flags_mask = ImGuiTableFlags_Resizable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Sortable;
+    const ImGuiSettingsBinaryRecords* binary = &g.SettingsTablesBinary;
+    const ImGuiTableColumnSettingsRecord* binary_columns = (const ImGuiTableColumnSettingsRecord*)(const void*)binary->Extra;
+    const size_t binary_columns_count = (size_t)binary->ExtraSize / sizeof(ImGuiTableColumnSettingsRecord);
+    int count = 0;
+    int columns_count = 0;
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+        if (settings->ID != 0 && (settings->SaveFlags & save_flags_mask) != 0)
+        {
+            columns_count += settings->ColumnsCount;
+            count++;
+        }
+    for (int n = 0; n < binary->Count; n++)
+    {
+        const ImGuiTableSettingsRecord* record = (const ImGuiTableSettingsRecord*)(const void*)(binary->Data + n * binary->Stride);
+        if (g.SettingsTablesMap.GetInt(record->ID, 0) == 0 && record->ColumnsCount >= 0 && record->ColumnsOffset <= binary_columns_count && (size_t)record->ColumnsCount <= binary_columns_count - record->ColumnsOffset)
+        {
+            columns_count += record->ColumnsCount;
+            count++;
+        }
+    }
+
+    const int records_offset = ImGui::AppendBinarySettingsRecords(buf, count, sizeof(ImGuiTableSettingsRecord), columns_count * (int)sizeof(ImGuiTableColumnSettingsRecord));
+    ImGuiTableSettingsRecord* records = (ImGuiTableSettingsRecord*)(void*)(buf->Data + records_offset);
+    ImGuiTableSettingsRecord* dst = records;
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+    {
+        if (settings->ID == 0 || (settings->SaveFlags & save_flags_mask) == 0)
+            continue;
+        memset(dst, 0, sizeof(*dst));
+        dst->ID = settings->ID;
+        dst->SaveFlags = settings->SaveFlags;
+        dst->RefScale = settings->RefScale;
+        dst->ColumnsCount = settings->ColumnsCount;
+        dst++;
+    }
+    for (int n = 0; n < binary->Count; n++)
+    {
+        const ImGuiTableSettingsRecord* record = (const ImGuiTableSettingsRecord*)(const void*)(binary->Data + n * binary->Stride);
+        if (g.SettingsTablesMap.GetInt(record->ID, 0) == 0 && record->ColumnsCount >= 0 && record->ColumnsOffset <= binary_columns_count && (size_t)record->ColumnsCount <= binary_columns_count - record->ColumnsOffset)
+            *dst++ = *record; // Keep ColumnsOffset in the loaded data for now
+    }
+
+    // Write columns in records order so equal settings always give the same output
+    ImGui::SortBinarySettingsRecords(buf, records_offset, count, sizeof(ImGuiTableSettingsRecord));
+    ImGuiTableColumnSettingsRecord* dst_column = (ImGuiTableColumnSettingsRecord*)(void*)(records + count);
+    ImU32 column_offset = 0;
+    for (int n = 0; n < count; n++)
+    {
+        ImGuiTableSettingsRecord* record = &records[n];
+        if (const int settings_offset = g.SettingsTablesMap.GetInt(record->ID, 0))
+        {
+            const ImGuiTableColumnSettings* column = g.SettingsTables.ptr_from_offset(settings_offset)->GetColumnSettings();
+            for (int column_n = 0; column_n < record->ColumnsCount; column_n++, column++, dst_column++)
+            {
+                memset(dst_column, 0, sizeof(*dst_column));
+                dst_column->WidthOrWeight = column->WidthOrWeight;
+                dst_column->UserID = column->UserID;
+                dst_column->Index = column->Index;
+                dst_column->DisplayOrder = column->DisplayOrder;
+                dst_column->SortOrder = column->SortOrder;
+                dst_column->Flags = (ImU8)(column->SortDirection | (column->IsEnabled << 2) | (column->IsStretch << 3));
+            }
+        }
+        else
+        {
+            memcpy(dst_column, binary_columns + record->ColumnsOffset, record->ColumnsCount * sizeof(ImGuiTableColumnSettingsRecord));
+            dst_column += record->ColumnsCount;
+        }
+        record->ColumnsOffset = column_offset;
+        column_offset += record->ColumnsCount;
+    }
+    IM_ASSERT(column_offset == (ImU32)columns_count);
+}
+
 void ImGui::TableSettingsInstallHandler(ImGuiContext* context)
 {
     ImGuiContext& g = *context;
@@ -3438,6 +4222,8 @@ void ImGui::TableSettingsInstallHandler(ImGuiContext* context)
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = TableSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = TableSettingsHandler_WriteAll;
+    ini_handler.ReadBinaryFn = TableSettingsHandler_ReadBinary;
+    ini_handler.WriteBinaryFn = TableSettingsHandler_WriteBinary;
     g.SettingsHandlers.push_back(ini_handler);
 }
 
@@ -3495,9 +4281,14 @@ void ImGui::TableGcCompactSettings()
         return;
     ImChunkStream<ImGuiTableSettings> new_chunk_stream;
     new_chunk_stream.Buf.reserve(required_memory);
+    g.SettingsTablesMap.Clear();
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
         if (settings->ID != 0)
-            memcpy(new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount)), settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
+        {
+            ImGuiTableSettings* new_settings = new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount));
+            memcpy(new_settings, settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
+            g.SettingsTablesMap.SetInt(new_settings->ID, new_chunk_stream.offset_from_ptr(new_settings));
+        }
     g.SettingsTables.swap(new_chunk_stream);
 }
 
@@ -3542,6 +4333,8 @@ void ImGui::DebugNodeTable(ImGuiTable* table)
     BulletText("CellPaddingX: %.1f, CellSpacingX: %.1f/%.1f, OuterPaddingX: %.1f", table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, table->OuterPaddingX);
     BulletText("HoveredColumnBody: %d, HoveredColumnBorder: %d", table->HoveredColumnBody, table->HoveredColumnBorder);
     BulletText("ResizedColumn: %d, ReorderColumn: %d, HeldHeaderColumn: %d", table->ResizedColumn, table->ReorderColumn, table->HeldHeaderColumn);
+    BulletText("Timings: Layout %.3f ms, EndTable %.3f ms (last frame)", table->PerfLastLayoutTime, table->PerfLastEndTime);
+    BulletText("Layouts: %d full, %d reusing widths%s", table->PerfLayoutFullCount, table->PerfLayoutCachedCount, table->IsLayoutCacheable ? "" : " (widths follow contents)");
     //BulletText("BgDrawChannels: %d/%d", 0, table->BgDrawChannelUnfrozen);
     float sum_weights = 0.0f;
     for (int n = 0; n < table->ColumnsCount; n++)
@@ -125,7 +125,7 @@ static const ImU64          IM_U64_MAX = (2ULL * 9223372036854775807LL + 1);
 
 // For InputTextEx()
 static bool             InputTextFilterCharacter(unsigned int* p_char, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* user_data, ImGuiInputSource input_source);
-static int              InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end);
+static int              InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end, int line_n, const char** out_line_begin);
 static ImVec2           InputTextCalcTextSizeW(const ImWchar* text_begin, const ImWchar* text_end, const ImWchar** remaining = NULL, ImVec2* out_offset = NULL, bool stop_on_new_line = false);
 
 //-------------------------------------------------------------------------
@@ -3552,17 +3552,20 @@ bool ImGui::InputTextWithHint(const char* label, const char* hint, char* buf, si
     return InputTextEx(label, hint, buf, (int)buf_size, ImVec2(0, 0), flags, callback, user_data);
 }
 
-static int InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end)
+// Also output the beginning of line 'line_n' (or the end of the text if there are fewer lines), so the lines above it can be skipped
+static int InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end, int line_n, const char** out_line_begin)
 {
-    int line_count = 0;
-    const char* s = text_begin;
-    while (char c = *s++) // We are only matching for \n so we can ignore UTF-8 decoding
-        if (c == '\n')
-            line_count++;
-    s--;
-    if (s[0] != '\n' && s[0] != '\r')
-        line_count++;
-    *out_text_end = s;
+    const char* text_end = text_begin + strlen(text_begin);
+    const char* line_begin = (line_n <= 0) ? text_begin : text_end;
+    int line_count = 1;
+    for (const char* s = text_begin; (s = (const char*)memchr(s, '\n', text_end - s)) != NULL; ) // We are only matching for \n so we can ignore UTF-8 decoding
+    {
+        s++;
+        if (line_count++ == line_n)
+            line_begin = s;
+    }
+    *out_text_end = text_end;
+    *out_line_begin = line_begin;
     return line_count;
 }
 
@@ -3647,20 +3650,36 @@ static int  STB_TEXTEDIT_MOVEWORDRIGHT_WIN(ImGuiInputTextState* obj, int idx)
 #define STB_TEXTEDIT_MOVEWORDRIGHT  STB_TEXTEDIT_MOVEWORDRIGHT_WIN
 #endif
 
+// Our rows are lines (no word-wrapping) which all have the same height: let stb_textedit.h find them with the line index instead of laying out every row above.
+static int  STB_TEXTEDIT_GETROWINDEX_IMPL(ImGuiInputTextState* obj, int idx)    { return obj->GetLineIndex(idx); }
+static int  STB_TEXTEDIT_GETROWSTART_IMPL(ImGuiInputTextState* obj, int row)    { return obj->GetLineStart(row); }
+#define STB_TEXTEDIT_GETROWINDEX    STB_TEXTEDIT_GETROWINDEX_IMPL
+#define STB_TEXTEDIT_GETROWSTART    STB_TEXTEDIT_GETROWSTART_IMPL
+
 static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 {
-    ImWchar* dst = obj->TextW.Data + pos;
-
-    // We maintain our buffer length in both UTF-8 and wchar formats
+    // We maintain our buffer in both UTF-8 and wchar formats
+    const int pos_a = obj->GetTextAOffset(pos);
+    const int n_a = ImTextCountUtf8BytesFromStr(obj->TextW.Data + pos, obj->TextW.Data + pos + n);
     obj->Edited = true;
-    obj->CurLenA -= ImTextCountUtf8BytesFromStr(dst, dst + n);
-    obj->CurLenW -= n;
 
-    // Offset remaining text (FIXME-OPT: Use memmove)
-    const ImWchar* src = obj->TextW.Data + pos + n;
-    while (ImWchar c = *src++)
-        *dst++ = c;
-    *dst = '\0';
+    // Remove the lines started by the deleted newlines and shift the following ones
+    if (obj->LineStarts.Size > 0)
+    {
+        const int line_first = obj->GetLineIndex(pos) + 1;
+        const int line_last = obj->GetLineIndex(pos + n) + 1;
+        if (line_last > line_first)
+            obj->LineStarts.erase(obj->LineStarts.Data + line_first, obj->LineStarts.Data + line_last);
+        for (int line_n = line_first; line_n < obj->LineStarts.Size; line_n++)
+            obj->LineStarts.Data[line_n] -= n;
+    }
+
+    // Offset remaining text, including zero-terminators
+    memmove(obj->TextW.Data + pos, obj->TextW.Data + pos + n, (size_t)(obj->CurLenW - pos - n + 1) * sizeof(ImWchar));
+    memmove(obj->TextA.Data + pos_a, obj->TextA.Data + pos_a + n_a, (size_t)(obj->CurLenA - pos_a - n_a + 1));
+    obj->CurLenW -= n;
+    obj->CurLenA -= n_a;
+    obj->TextAOffsets.resize(ImMin(obj->TextAOffsets.Size, pos / IM_INPUTTEXT_OFFSETS_STRIDE + 1));
 }
 
 static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ImWchar* new_text, int new_text_len)
@@ -3673,7 +3692,7 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const Im
     if (!is_resizable && (new_text_len_utf8 + obj->CurLenA + 1 > obj->BufCapacityA))
         return false;
 
-    // Grow internal buffer if needed
+    // Grow internal buffers if needed
     if (new_text_len + text_len + 1 > obj->TextW.Size)
     {
         if (!is_resizable)
@@ -3681,16 +3700,47 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const Im
         IM_ASSERT(text_len < obj->TextW.Size);
         obj->TextW.resize(text_len + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1);
     }
+    if (new_text_len_utf8 + obj->CurLenA + 1 > obj->TextA.Size)
+        obj->TextA.resize(obj->CurLenA + ImClamp(new_text_len_utf8 * 4, 32, ImMax(256, new_text_len_utf8)) + 1);
+    const int pos_a = obj->GetTextAOffset(pos);
+
+    // Shift the lines after the insertion point and add the ones started by the new newlines
+    if (obj->LineStarts.Size > 0)
+    {
+        int new_line_count = 0;
+        for (int n = 0; n < new_text_len; n++)
+            if (new_text[n] == '\n')
+                new_line_count++;
+        const int line_first = obj->GetLineIndex(pos) + 1;
+        const int line_count = obj->LineStarts.Size;
+        obj->LineStarts.resize(line_count + new_line_count);
+        int* line_starts = obj->LineStarts.Data;
+        if (new_line_count > 0)
+            memmove(line_starts + line_first + new_line_count, line_starts + line_first, (size_t)(line_count - line_first) * sizeof(int));
+        for (int line_n = line_first + new_line_count; line_n < obj->LineStarts.Size; line_n++)
+            line_starts[line_n] += new_text_len;
+        for (int n = 0, line_n = line_first; n < new_text_len; n++)
+            if (new_text[n] == '\n')
+                line_starts[line_n++] = pos + n + 1;
+    }
 
     ImWchar* text = obj->TextW.Data;
     if (pos != text_len)
         memmove(text + pos + new_text_len, text + pos, (size_t)(text_len - pos) * sizeof(ImWchar));
     memcpy(text + pos, new_text, (size_t)new_text_len * sizeof(ImWchar));
 
+    // Same in UTF-8. ImTextStrToUtf8() writes a zero-terminator, restore the character it overwrites.
+    char* text_a = obj->TextA.Data + pos_a;
+    memmove(text_a + new_text_len_utf8, text_a, (size_t)(obj->CurLenA - pos_a + 1));
+    const char backup_c = text_a[new_text_len_utf8];
+    ImTextStrToUtf8(text_a, new_text_len_utf8 + 1, new_text, new_text + new_text_len);
+    text_a[new_text_len_utf8] = backup_c;
+
     obj->Edited = true;
     obj->CurLenW += new_text_len;
     obj->CurLenA += new_text_len_utf8;
     obj->TextW[obj->CurLenW] = '\0';
+    obj->TextAOffsets.resize(ImMin(obj->TextAOffsets.Size, pos / IM_INPUTTEXT_OFFSETS_STRIDE + 1));
 
     return true;
 }
@@ -3736,6 +3786,52 @@ static void stb_textedit_replace(ImGuiInputTextState* str, STB_TexteditState* st
 
 } // namespace ImStb
 
+// TextAOffsets[] holds the UTF-8 offset of every IM_INPUTTEXT_OFFSETS_STRIDE-th character, so we only count the bytes of
+// a few characters. Edits truncate it at their position, and it is extended again from there on the next lookup.
+int ImGuiInputTextState::GetTextAOffset(int pos_w)
+{
+    pos_w = ImClamp(pos_w, 0, CurLenW); // An empty selection may be left out of range by a deletion
+    const int checkpoint_n = pos_w / IM_INPUTTEXT_OFFSETS_STRIDE;
+    if (TextAOffsets.Size == 0)
+        TextAOffsets.push_back(0);
+    while (TextAOffsets.Size <= checkpoint_n)
+    {
+        const ImWchar* checkpoint_w = TextW.Data + (TextAOffsets.Size - 1) * IM_INPUTTEXT_OFFSETS_STRIDE;
+        const int offset_a = TextAOffsets.back() + ImTextCountUtf8BytesFromStr(checkpoint_w, checkpoint_w + IM_INPUTTEXT_OFFSETS_STRIDE);
+        TextAOffsets.push_back(offset_a);
+    }
+    return TextAOffsets[checkpoint_n] + ImTextCountUtf8BytesFromStr(TextW.Data + checkpoint_n * IM_INPUTTEXT_OFFSETS_STRIDE, TextW.Data + pos_w);
+}
+
+// LineStarts[] is empty when invalidated (a valid index always holds the first line), edits keep it up to date afterward.
+void ImGuiInputTextState::BuildLineStarts()
+{
+    if (LineStarts.Size > 0)
+        return;
+    LineStarts.push_back(0);
+    for (int n = 0; n < CurLenW; n++)
+        if (TextW[n] == '\n')
+            LineStarts.push_back(n + 1);
+}
+
+int ImGuiInputTextState::GetLineIndex(int pos_w)
+{
+    BuildLineStarts();
+    pos_w = ImClamp(pos_w, 0, CurLenW);
+
+    // Binary search for the last line starting at or before pos_w
+    int line_min = 0, line_max = LineStarts.Size - 1;
+    while (line_min < line_max)
+    {
+        const int line_mid = (line_min + line_max + 1) / 2;
+        if (LineStarts[line_mid] <= pos_w)
+            line_min = line_mid;
+        else
+            line_max = line_mid - 1;
+    }
+    return line_min;
+}
+
 void ImGuiInputTextState::OnKeyPressed(int key)
 {
     stb_textedit_key(this, &Stb, key);
@@ -3784,7 +3880,7 @@ void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, cons
         IM_ASSERT(edit_state->ID != 0 && g.ActiveId == edit_state->ID);
         IM_ASSERT(Buf == edit_state->TextA.Data);
         int new_buf_size = BufTextLen + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1;
-        edit_state->TextA.reserve(new_buf_size + 1);
+        edit_state->TextA.resize(new_buf_size + 1);
         Buf = edit_state->TextA.Data;
         BufSize = edit_state->BufCapacityA = new_buf_size;
     }
@@ -4011,12 +4107,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         memcpy(state->InitialTextA.Data, buf, buf_len + 1);
 
         // Start edition
-        const char* buf_end = NULL;
+        // TextA is converted back from TextW (rather than copied from buf) so both agree on malformed UTF-8. Edits then update both incrementally.
         state->TextW.resize(buf_size + 1);          // wchar count <= UTF-8 count. we use +1 to make sure that .Data is always pointing to at least an empty string.
-        state->TextA.resize(0);
-        state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
-        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
-        state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL);
+        const int text_len_a = ImTextCountUtf8BytesFromStr(state->TextW.Data, state->TextW.Data + state->CurLenW);
+        state->TextA.resize(ImMax(buf_size, text_len_a) + 1);
+        state->CurLenA = ImTextStrToUtf8(state->TextA.Data, state->TextA.Size, state->TextW.Data, state->TextW.Data + state->CurLenW);
+        state->TextAOffsets.resize(0);
+        state->LineStarts.resize(0);
+        state->TextAIsValid = true;
 
         // Preserve cursor position and undo/redo stack if we come back to same widget
         // FIXME: For non-readonly widgets we might be able to require that TextAIsValid && TextA == buf ? (untested) and discard undo stack if user buffer has changed.
@@ -4096,6 +4195,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->TextW.resize(buf_size + 1);
         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, buf, NULL, &buf_end);
         state->CurLenA = (int)(buf_end - buf);
+        state->TextAOffsets.resize(0);
+        state->LineStarts.resize(0);
         state->CursorClamp();
         render_selection &= state->HasSelection();
     }
@@ -4129,6 +4230,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->Edited = false;
         state->BufCapacityA = buf_size;
         state->Flags = flags;
+        if (!is_readonly && state->TextA.Size < buf_size + 1)
+            state->TextA.resize(buf_size + 1);      // Callbacks may write up to buf_size bytes into TextA. Grows when a resize callback enlarged the user buffer.
 
         // Although we are active we don't prevent mouse from hovering other elements unless we are interacting right now with the widget.
         // Down the line we should have a cleaner library-wide concept of Selected vs Active.
@@ -4398,13 +4501,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             // Apply new value immediately - copy modified buffer back
             // Note that as soon as the input box is active, the in-widget value gets priority over any underlying modification of the input buffer
             // FIXME: We actually always render 'buf' when calling DrawList->AddText, making the comment above incorrect.
-            // FIXME-OPT: CPU waste to do this every time the widget is active, should mark dirty state from the stb_textedit callbacks.
-            if (!is_readonly)
-            {
-                state->TextAIsValid = true;
-                state->TextA.resize(state->TextW.Size * 4 + 1);
-                ImTextStrToUtf8(state->TextA.Data, state->TextA.Size, state->TextW.Data, NULL);
-            }
+            // (TextA is already up to date: STB_TEXTEDIT_INSERTCHARS/DELETECHARS apply every edit to it)
 
             // User callback
             if ((flags & (ImGuiInputTextFlags_CallbackCompletion | ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackEdit | ImGuiInputTextFlags_CallbackAlways)) != 0)
@@ -4453,11 +4550,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     callback_data.BufSize = state->BufCapacityA;
                     callback_data.BufDirty = false;
 
-                    // We have to convert from wchar-positions to UTF-8-positions, which can be pretty slow (an incentive to ditch the ImWchar buffer, see https://github.com/nothings/stb/issues/188)
-                    ImWchar* text = state->TextW.Data;
-                    const int utf8_cursor_pos = callback_data.CursorPos = ImTextCountUtf8BytesFromStr(text, text + state->Stb.cursor);
-                    const int utf8_selection_start = callback_data.SelectionStart = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_start);
-                    const int utf8_selection_end = callback_data.SelectionEnd = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_end);
+                    // We have to convert from wchar-positions to UTF-8-positions (an incentive to ditch the ImWchar buffer, see https://github.com/nothings/stb/issues/188)
+                    const int utf8_cursor_pos = callback_data.CursorPos = state->GetTextAOffset(state->Stb.cursor);
+                    const int utf8_selection_start = callback_data.SelectionStart = state->GetTextAOffset(state->Stb.select_start);
+                    const int utf8_selection_end = callback_data.SelectionEnd = state->GetTextAOffset(state->Stb.select_end);
 
                     // Call user code
                     callback(&callback_data);
@@ -4478,6 +4574,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                             state->TextW.resize(state->TextW.Size + (callback_data.BufTextLen - backup_current_text_length));
                         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, callback_data.Buf, NULL);
                         state->CurLenA = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        state->TextAOffsets.resize(0);
+                        state->LineStarts.resize(0);
                         state->CursorAnimReset();
                     }
                 }
@@ -4570,53 +4668,24 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         ImVec2 cursor_offset, select_start_offset;
 
         {
-            // Find lines numbers straddling 'cursor' (slot 0) and 'select_start' (slot 1) positions.
-            const ImWchar* searches_input_ptr[2] = { NULL, NULL };
-            int searches_result_line_no[2] = { -1000, -1000 };
-            int searches_remaining = 0;
+            // Find lines numbers straddling 'cursor' and 'select_start' positions with the line index, then measure from the beginning of their line.
             if (render_cursor)
             {
-                searches_input_ptr[0] = text_begin + state->Stb.cursor;
-                searches_result_line_no[0] = -1;
-                searches_remaining++;
+                const int line_no = state->GetLineIndex(state->Stb.cursor);
+                cursor_offset.x = InputTextCalcTextSizeW(text_begin + state->GetLineStart(line_no), text_begin + state->Stb.cursor).x;
+                cursor_offset.y = (line_no + 1) * g.FontSize;
             }
             if (render_selection)
             {
-                searches_input_ptr[1] = text_begin + ImMin(state->Stb.select_start, state->Stb.select_end);
-                searches_result_line_no[1] = -1;
-                searches_remaining++;
-            }
-
-            // Iterate all lines to find our line numbers
-            // In multi-line mode, we never exit the loop until all lines are counted, so add one extra to the searches_remaining counter.
-            searches_remaining += is_multiline ? 1 : 0;
-            int line_count = 0;
-            //for (const ImWchar* s = text_begin; (s = (const ImWchar*)wcschr((const wchar_t*)s, (wchar_t)'\n')) != NULL; s++)  // FIXME-OPT: Could use this when wchar_t are 16-bit
-            for (const ImWchar* s = text_begin; *s != 0; s++)
-                if (*s == '\n')
-                {
-                    line_count++;
-                    if (searches_result_line_no[0] == -1 && s >= searches_input_ptr[0]) { searches_result_line_no[0] = line_count; if (--searches_remaining <= 0) break; }
-                    if (searches_result_line_no[1] == -1 && s >= searches_input_ptr[1]) { searches_result_line_no[1] = line_count; if (--searches_remaining <= 0) break; }
-                }
-            line_count++;
-            if (searches_result_line_no[0] == -1)
-                searches_result_line_no[0] = line_count;
-            if (searches_result_line_no[1] == -1)
-                searches_result_line_no[1] = line_count;
-
-            // Calculate 2d position by finding the beginning of the line and measuring distance
-            cursor_offset.x = InputTextCalcTextSizeW(ImStrbolW(searches_input_ptr[0], text_begin), searches_input_ptr[0]).x;
-            cursor_offset.y = searches_result_line_no[0] * g.FontSize;
-            if (searches_result_line_no[1] >= 0)
-            {
-                select_start_offset.x = InputTextCalcTextSizeW(ImStrbolW(searches_input_ptr[1], text_begin), searches_input_ptr[1]).x;
-                select_start_offset.y = searches_result_line_no[1] * g.FontSize;
+                const int select_start = ImMin(state->Stb.select_start, state->Stb.select_end);
+                const int line_no = state->GetLineIndex(select_start);
+                select_start_offset.x = InputTextCalcTextSizeW(text_begin + state->GetLineStart(line_no), text_begin + select_start).x;
+                select_start_offset.y = (line_no + 1) * g.FontSize;
             }
 
             // Store text height (note that we haven't calculated text width at all, see GitHub issues #383, #1224)
             if (is_multiline)
-                text_size = ImVec2(inner_size.x, line_count * g.FontSize);
+                text_size = ImVec2(inner_size.x, state->GetLineCount() * g.FontSize);
         }
 
         // Scroll
@@ -4665,7 +4734,19 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             float bg_offy_up = is_multiline ? 0.0f : -1.0f;    // FIXME: those offsets should be part of the style? they don't play so well with multi-line selection.
             float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
             ImVec2 rect_pos = draw_pos + select_start_offset - draw_scroll;
-            for (const ImWchar* p = text_selected_begin; p < text_selected_end; )
+            const ImWchar* p = text_selected_begin;
+            if (is_multiline && rect_pos.y < clip_rect.y)
+            {
+                // Jump close to the first visible line, the loop below skips the remaining ones
+                const int line_no = state->GetLineIndex(ImMin(state->Stb.select_start, state->Stb.select_end));
+                const int line_visible = ImMin((int)((clip_rect.y - draw_pos.y) / g.FontSize) - 2, state->GetLineCount() - 1);
+                if (line_visible > line_no)
+                {
+                    p = text_begin + state->GetLineStart(line_visible);
+                    rect_pos = ImVec2(draw_pos.x - draw_scroll.x, draw_pos.y + (line_visible + 1) * g.FontSize);
+                }
+            }
+            while (p < text_selected_end)
             {
                 if (rect_pos.y > clip_rect.w + g.FontSize)
                     break;
@@ -4695,7 +4776,20 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
-            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
+            if (is_multiline && buf_display_from_state && !is_displaying_hint)
+            {
+                // Only submit the lines intersecting the clip rectangle (with a margin of one line, RenderText() does the exact clipping)
+                const int line_count = state->GetLineCount();
+                const int line_min = ImClamp((int)((clip_rect.y - draw_pos.y) / g.FontSize) - 1, 0, line_count - 1);
+                const int line_max = ImClamp((int)((clip_rect.w - draw_pos.y) / g.FontSize) + 2, line_min + 1, line_count);
+                const char* buf_visible = buf_display + state->GetTextAOffset(state->GetLineStart(line_min));
+                const char* buf_visible_end = (line_max < line_count) ? buf_display + state->GetTextAOffset(state->GetLineStart(line_max)) : buf_display_end;
+                draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll + ImVec2(0.0f, line_min * g.FontSize), col, buf_visible, buf_visible_end, 0.0f, NULL);
+            }
+            else
+            {
+                draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
+            }
         }
 
         // Draw blinking cursor
@@ -4703,6 +4797,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             state->CursorAnim += io.DeltaTime;
             bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (state->CursorAnim <= 0.0f) || ImFmod(state->CursorAnim, 1.20f) <= 0.80f;
+            if (g.IO.ConfigInputTextCursorBlink)
+            {
+                // Power saving: wake up for the next blink transition
+                const float blink_t = ImFmod(state->CursorAnim, 1.20f);
+                SetMaxWaitBeforeNextFrame((state->CursorAnim <= 0.0f) ? -state->CursorAnim : (blink_t <= 0.80f) ? 0.80f - blink_t : 1.20f - blink_t);
+            }
             ImVec2 cursor_screen_pos = ImFloor(draw_pos + cursor_offset - draw_scroll);
             ImRect cursor_screen_rect(cursor_screen_pos.x, cursor_screen_pos.y - g.FontSize + 0.5f, cursor_screen_pos.x + 1.0f, cursor_screen_pos.y - 1.5f);
             if (cursor_is_visible && cursor_screen_rect.Overlaps(clip_rect))
@@ -4720,8 +4820,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     else
     {
         // Render text only (no selection, no cursor)
+        // In multi-line mode, the lines above the clip rectangle are skipped while counting lines.
+        const char* buf_visible = buf_display;
+        float buf_visible_offset_y = 0.0f;
         if (is_multiline)
-            text_size = ImVec2(inner_size.x, InputTextCalcTextLenAndLineCount(buf_display, &buf_display_end) * g.FontSize); // We don't need width
+        {
+            const int line_min = ImMax((int)((clip_rect.y - draw_pos.y) / g.FontSize) - 1, 0);
+            text_size = ImVec2(inner_size.x, InputTextCalcTextLenAndLineCount(buf_display, &buf_display_end, line_min, &buf_visible) * g.FontSize); // We don't need width
+            buf_visible_offset_y = line_min * g.FontSize;
+        }
         else if (!is_displaying_hint && g.ActiveId == id)
             buf_display_end = buf_display + state->CurLenA;
         else if (!is_displaying_hint)
@@ -4730,7 +4837,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
-            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
+            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos + ImVec2(0.0f, buf_visible_offset_y), col, buf_visible, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
         }
     }
 
@@ -5692,6 +5799,15 @@ void ImGui::ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags fl
 // - GetTreeNodeToLabelSpacing()
 // - SetNextItemOpen()
 // - CollapsingHeader()
+// - ImGuiVirtualTree::ImGuiVirtualTree()
+// - ImGuiVirtualTree::Begin()
+// - ImGuiVirtualTree::Step()
+// - ImGuiVirtualTree::End()
+// - ImGuiVirtualTree::Rebuild()
+// - ImGuiVirtualTree::ScrollToNode()
+// - VirtualTreePushChildRows() [Internal]
+// - VirtualTreeAddChildRows() [Internal]
+// - VirtualTreeSetRowOpen() [Internal]
 //-------------------------------------------------------------------------
 
 bool ImGui::TreeNode(const char* str_id, const char* fmt, ...)
@@ -6125,6 +6241,303 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
     return is_open;
 }
 
+// Push the rows of the children of 'node' on tree->TempStack, in reverse order so they are popped in order.
+// ImGuiTreeNodeFlags_DefaultOpen isn't applied to a node already in tree->TempPath (its ancestors, e.g. a graph with cycles) or too deep
+// for ImGuiVirtualTreeRow::Depth: the node is stored as closed, so TreeNodeBehavior() agrees and only opening it explicitly expands it.
+static void VirtualTreePushChildRows(ImGuiVirtualTree* tree, ImGuiStorage* storage, ImU64 node, ImGuiID id, int depth)
+{
+    IM_ASSERT(depth <= 0x7FFF);
+    ImVector<ImGuiVirtualTreeRow>& stack = tree->TempStack;
+    const int children_count = tree->GetChildrenCountFn(node, tree->UserData);
+    const int stack_start = stack.Size;
+    stack.resize(stack_start + children_count);
+    for (int child_n = 0; child_n < children_count; child_n++)
+    {
+        ImGuiVirtualTreeRow& row = stack[stack.Size - 1 - child_n];
+        row.Node = tree->GetChildFn(node, child_n, tree->UserData);
+        row.ID = ImHashData(&row.Node, sizeof(row.Node), id);
+        row.Depth = (ImS16)depth;
+        row.IsLeaf = tree->IsLeafFn ? tree->IsLeafFn(row.Node, tree->UserData) : (tree->GetChildrenCountFn(row.Node, tree->UserData) == 0);
+        row.IsOpen = false;
+        if (row.IsLeaf)
+            continue;
+        int open = storage->GetInt(row.ID, -1);
+        if (open == -1 && (tree->Flags & ImGuiTreeNodeFlags_DefaultOpen))
+        {
+            open = (depth < 0x7FFF && !tree->TempPath.contains(row.Node)) ? 1 : 0;
+            if (open == 0)
+                storage->SetInt(row.ID, 0);
+        }
+        row.IsOpen = (open == 1);
+    }
+}
+
+// Append the rows of the children of 'node' and of their open descendants, depth-first with an explicit stack.
+// 'id' is the ID of the row of 'node', tree->TempPath holds the ancestors of 'node' then 'node' (depth + 1 nodes).
+static void VirtualTreeAddChildRows(ImGuiVirtualTree* tree, ImGuiStorage* storage, ImU64 node, ImGuiID id, int depth, ImVector<ImGuiVirtualTreeRow>* out_rows)
+{
+    ImVector<ImGuiVirtualTreeRow>& stack = tree->TempStack;
+    ImVector<ImU64>& path = tree->TempPath;
+    IM_ASSERT(path.Size == depth + 1 && path.back() == node);
+    stack.resize(0);
+    VirtualTreePushChildRows(tree, storage, node, id, depth);
+    while (stack.Size > 0)
+    {
+        const ImGuiVirtualTreeRow row = stack.back();
+        stack.pop_back();
+        out_rows->push_back(row);
+        path.resize(row.Depth + 1);
+        if (row.IsOpen)
+        {
+            path.push_back(row.Node);
+            VirtualTreePushChildRows(tree, storage, row.Node, row.ID, row.Depth + 1);
+        }
+    }
+}
+
+// Insert or remove the rows following Rows[row_n] after it was opened or closed. Return the number of rows inserted (negative when removed).
+static int VirtualTreeSetRowOpen(ImGuiVirtualTree* tree, ImGuiStorage* storage, int row_n, bool open)
+{
+    ImVector<ImGuiVirtualTreeRow>& rows = tree->Rows;
+    ImGuiVirtualTreeRow* row = &rows[row_n];
+    if (row->IsLeaf || row->IsOpen == open)
+        return 0;
+    row->IsOpen = open;
+
+    if (open)
+    {
+        // Path from the root to the row, found by walking back to rows of decreasing depth
+        ImVector<ImU64>& path = tree->TempPath;
+        path.resize(row->Depth + 2);
+        path[0] = tree->RootNode;
+        path[row->Depth + 1] = row->Node;
+        for (int parent_row_n = row_n - 1, depth = row->Depth - 1; depth >= 0; parent_row_n--)
+            if (rows[parent_row_n].Depth == depth)
+                path[1 + depth--] = rows[parent_row_n].Node;
+
+        ImVector<ImGuiVirtualTreeRow>& new_rows = tree->TempRows;
+        new_rows.resize(0);
+        VirtualTreeAddChildRows(tree, storage, row->Node, row->ID, row->Depth + 1, &new_rows);
+        const int tail_count = rows.Size - (row_n + 1);
+        rows.resize(rows.Size + new_rows.Size);
+        memmove(rows.Data + row_n + 1 + new_rows.Size, rows.Data + row_n + 1, (size_t)tail_count * sizeof(ImGuiVirtualTreeRow));
+        memcpy(rows.Data + row_n + 1, new_rows.Data, (size_t)new_rows.size_in_bytes());
+        return new_rows.Size;
+    }
+
+    int row_end = row_n + 1;
+    while (row_end < rows.Size && rows[row_end].Depth > row->Depth)
+        row_end++;
+    rows.erase(rows.Data + row_n + 1, rows.Data + row_end);
+    return -(row_end - (row_n + 1));
+}
+
+static int IMGUI_CDECL VirtualTreeRowComparerDescending(const void* lhs, const void* rhs)
+{
+    return *(const int*)rhs - *(const int*)lhs;
+}
+
+ImGuiVirtualTree::ImGuiVirtualTree()
+{
+    GetChildrenCountFn = NULL;
+    GetChildFn = NULL;
+    GetLabelFn = NULL;
+    IsLeafFn = NULL;
+    IsSelectedFn = NULL;
+    UserData = NULL;
+    RootNode = 0;
+    Node = 0;
+    RowIndex = -1;
+    Depth = 0;
+    ID = 0;
+    Flags = ImGuiTreeNodeFlags_None;
+    RowIndent = 0.0f;
+    NavLeftRow = NavRow = ScrollToRow = -1;
+    NeedRebuild = true;
+}
+
+bool ImGuiVirtualTree::Begin(const char* str_id, ImGuiTreeNodeFlags flags)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (window->SkipItems)
+        return false;
+    IM_ASSERT(GetChildrenCountFn != NULL && GetChildFn != NULL && GetLabelFn != NULL);
+    IM_ASSERT(RowIndex == -1 && "Mismatched Begin()/End() calls?");
+
+    ImGui::PushID(str_id);
+    const ImGuiID id = window->IDStack.back();
+    if (id != ID || flags != Flags)
+        NeedRebuild = true;
+    ID = id;
+    Flags = flags;
+
+    ImGuiStorage* storage = window->DC.StateStorage;
+    if (NeedRebuild)
+    {
+        Rows.resize(0);
+        TempPath.resize(0);
+        TempPath.push_back(RootNode);
+        VirtualTreeAddChildRows(this, storage, RootNode, ID, 0, &Rows);
+        NeedRebuild = false;
+    }
+
+    // Open the ancestors of the node to scroll to. Each node is searched among the rows of the subtree of its parent.
+    ScrollToRow = -1;
+    if (ScrollToPath.Size > 0)
+    {
+        int parent_row_n = -1;
+        for (int depth = 0; depth < ScrollToPath.Size; depth++)
+        {
+            int row_n = parent_row_n + 1;
+            while (row_n < Rows.Size && Rows[row_n].Depth >= depth && !(Rows[row_n].Depth == depth && Rows[row_n].Node == ScrollToPath[depth]))
+                row_n++;
+            if (row_n == Rows.Size || Rows[row_n].Depth != depth)
+            {
+                parent_row_n = -1; // Not found
+                break;
+            }
+            if (depth + 1 < ScrollToPath.Size && !Rows[row_n].IsOpen)
+            {
+                storage->SetInt(Rows[row_n].ID, 1);
+                VirtualTreeSetRowOpen(this, storage, row_n, true);
+            }
+            parent_row_n = row_n;
+        }
+        ScrollToRow = parent_row_n;
+        ScrollToPath.resize(0);
+    }
+
+    Clipper.Begin(Rows.Size);
+    if (ScrollToRow != -1)
+        Clipper.ForceDisplayRangeByIndices(ScrollToRow, ScrollToRow + 1);
+    Node = 0;
+    Depth = 0;
+    NavLeftRow = NavRow = -1;
+    return true;
+}
+
+bool ImGuiVirtualTree::Step()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (RowIndent > 0.0f)
+        ImGui::Unindent(RowIndent);
+    RowIndent = 0.0f;
+
+    if (++RowIndex >= Clipper.DisplayEnd)
+    {
+        if (!Clipper.Step())
+        {
+            RowIndex = -1;
+            return false;
+        }
+        RowIndex = Clipper.DisplayStart;
+    }
+
+    // Rows are submitted flat: no TreePush(), the indentation is applied to each row
+    const ImGuiVirtualTreeRow row = Rows[RowIndex];
+    Node = row.Node;
+    Depth = row.Depth;
+    RowIndent = g.Style.IndentSpacing * row.Depth;
+    if (RowIndent > 0.0f)
+        ImGui::Indent(RowIndent);
+
+    ImGuiTreeNodeFlags flags = Flags | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    if (row.IsLeaf)
+        flags |= ImGuiTreeNodeFlags_Leaf;
+    if (IsSelectedFn && IsSelectedFn(row.Node, UserData))
+        flags |= ImGuiTreeNodeFlags_Selected;
+    const bool is_open = ImGui::TreeNodeBehavior(row.ID, flags, GetLabelFn(row.Node, UserData), NULL);
+    if (!row.IsLeaf && is_open != row.IsOpen && !g.LogEnabled)
+        ToggledRows.push_back(RowIndex);
+
+    // Left on a closed node or a leaf: End() moves to the parent row unless something else takes the navigation request
+    if (g.NavId == row.ID && g.NavWindow == window)
+    {
+        NavRow = RowIndex;
+        if (g.NavMoveDir == ImGuiDir_Left && row.Depth > 0 && (Flags & ImGuiTreeNodeFlags_NavLeftJumpsBackHere) && ImGui::NavMoveRequestButNoResultYet())
+            NavLeftRow = RowIndex;
+    }
+
+    if (RowIndex == ScrollToRow)
+    {
+        ImGui::ScrollToItem(ImGuiScrollFlags_KeepVisibleCenterY);
+        if (g.NavWindow == window)
+            ImGui::SetFocusID(row.ID, window);
+        ScrollToRow = -1;
+    }
+    return true;
+}
+
+void ImGuiVirtualTree::End()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (RowIndent > 0.0f)
+        ImGui::Unindent(RowIndent);
+    RowIndent = 0.0f;
+    RowIndex = -1;
+    const float rows_height = Clipper.ItemsHeight;
+    const double rows_pos_y = Clipper.StartPosY;
+    Clipper.End();
+
+    // Jump to the parent row: its position is known from its index, so it doesn't need to be submitted
+    if (NavLeftRow != -1 && g.NavWindow == window && ImGui::NavMoveRequestButNoResultYet() && rows_height > 0.0f)
+    {
+        int parent_row_n = NavLeftRow - 1;
+        while (Rows[parent_row_n].Depth >= Rows[NavLeftRow].Depth)
+            parent_row_n--;
+        const ImGuiVirtualTreeRow& parent_row = Rows[parent_row_n];
+        const float y = (float)(rows_pos_y + (double)parent_row_n * rows_height);
+        const float x = window->Pos.x + window->DC.Indent.x + window->DC.ColumnsOffset.x + g.Style.IndentSpacing * parent_row.Depth;
+        ImRect bb(x, y, window->WorkRect.Max.x, y + rows_height - g.Style.ItemSpacing.y);
+        ImGui::SetNavID(parent_row.ID, g.NavLayer, g.NavFocusScopeId, ImGui::WindowRectAbsToRel(window, bb));
+        ImGui::NavMoveRequestCancel();
+        ImGui::ScrollToRect(window, bb);
+        NavRow = parent_row_n;
+    }
+
+    // Insert or remove the rows of nodes opened or closed this frame, from the last one so the indices of the others stay valid
+    if (ToggledRows.Size > 0)
+    {
+        ImGuiStorage* storage = window->DC.StateStorage;
+        const int default_open = (Flags & ImGuiTreeNodeFlags_DefaultOpen) ? 1 : 0;
+        ImQsort(ToggledRows.Data, (size_t)ToggledRows.Size, sizeof(int), VirtualTreeRowComparerDescending);
+        for (int n = 0; n < ToggledRows.Size; n++)
+        {
+            const int row_n = ToggledRows[n];
+            const int rows_delta = VirtualTreeSetRowOpen(this, storage, row_n, storage->GetInt(Rows[row_n].ID, default_open) != 0);
+
+            // Move the navigation rectangle along with its row, so the clipper keeps submitting it
+            if (NavRow > row_n && rows_delta != 0 && g.NavWindow == window)
+            {
+                if (NavRow < row_n + 1 - rows_delta)
+                    NavRow = -1; // Hidden
+                else if (rows_height > 0.0f)
+                    window->NavRectRel[g.NavLayer].TranslateY(rows_delta * rows_height);
+                if (NavRow != -1)
+                    NavRow += rows_delta;
+            }
+        }
+        ToggledRows.resize(0);
+    }
+
+    ImGui::PopID();
+}
+
+void ImGuiVirtualTree::Rebuild()
+{
+    NeedRebuild = true;
+}
+
+void ImGuiVirtualTree::ScrollToNode(const ImU64* path, int path_count)
+{
+    IM_ASSERT(path_count > 0);
+    ScrollToPath.resize(path_count);
+    memcpy(ScrollToPath.Data, path, (size_t)path_count * sizeof(ImU64));
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Selectable
 //-------------------------------------------------------------------------
@@ -6419,7 +6832,10 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: PlotLines, PlotHistogram
 //-------------------------------------------------------------------------
+// - PlotMinMax() [Internal]
+// - ImGuiPlotBuffer
 // - PlotEx() [Internal]
+// - PlotBufferEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
 //-------------------------------------------------------------------------
@@ -6429,42 +6845,287 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
 // - others https://github.com/ocornut/imgui/wiki/Useful-Extensions
 //-------------------------------------------------------------------------
 
-int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
+// Min/max of an array of values, ignoring NaN values. Leave 'out_min'/'out_max' untouched if there are none.
+static void PlotMinMax(const float* values, int values_count, float* out_min, float* out_max)
 {
-    ImGuiContext& g = *GImGui;
-    ImGuiWindow* window = GetCurrentWindow();
-    if (window->SkipItems)
-        return -1;
+    float v_min = *out_min;
+    float v_max = *out_max;
+    int i = 0;
+#ifdef IMGUI_ENABLE_SSE
+    if (values_count >= 8)
+    {
+        // _mm_min_ps()/_mm_max_ps() return their second operand when either is NaN, so NaN values are skipped
+        __m128 v_min0 = _mm_set1_ps(v_min), v_min1 = v_min0;
+        __m128 v_max0 = _mm_set1_ps(v_max), v_max1 = v_max0;
+        for (; i + 8 <= values_count; i += 8)
+        {
+            const __m128 v0 = _mm_loadu_ps(values + i);
+            const __m128 v1 = _mm_loadu_ps(values + i + 4);
+            v_min0 = _mm_min_ps(v0, v_min0);
+            v_min1 = _mm_min_ps(v1, v_min1);
+            v_max0 = _mm_max_ps(v0, v_max0);
+            v_max1 = _mm_max_ps(v1, v_max1);
+        }
+        v_min0 = _mm_min_ps(v_min0, v_min1);
+        v_max0 = _mm_max_ps(v_max0, v_max1);
+        v_min0 = _mm_min_ps(v_min0, _mm_shuffle_ps(v_min0, v_min0, _MM_SHUFFLE(1, 0, 3, 2)));
+        v_max0 = _mm_max_ps(v_max0, _mm_shuffle_ps(v_max0, v_max0, _MM_SHUFFLE(1, 0, 3, 2)));
+        v_min0 = _mm_min_ps(v_min0, _mm_shuffle_ps(v_min0, v_min0, _MM_SHUFFLE(2, 3, 0, 1)));
+        v_max0 = _mm_max_ps(v_max0, _mm_shuffle_ps(v_max0, v_max0, _MM_SHUFFLE(2, 3, 0, 1)));
+        v_min = _mm_cvtss_f32(v_min0);
+        v_max = _mm_cvtss_f32(v_max0);
+    }
+#endif
+    for (; i < values_count; i++)
+    {
+        const float v = values[i];
+        if (v < v_min) // Comparisons with NaN are false
+            v_min = v;
+        if (v > v_max)
+            v_max = v;
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+}
+
+// The min/max of each block of IM_PLOTBUFFER_BLOCK_SIZE values is at level 0, each next level has the min/max of 2 blocks of the previous one.
+// For a ring buffer of values we keep the min/max of the values currently stored in each block: appending recomputes the blocks
+// of the modified values at each level, so the cost is O(values appended + levels).
+#define IM_PLOTBUFFER_BLOCK_SIZE    16
+
+void ImGuiPlotBuffer::Init(int capacity)
+{
+    IM_ASSERT(capacity > 0);
+    Values.resize(capacity);
+    LevelsOffsets.resize(0);
+    int levels_size = 0;
+    for (int blocks_count = (capacity + IM_PLOTBUFFER_BLOCK_SIZE - 1) / IM_PLOTBUFFER_BLOCK_SIZE; ; blocks_count = (blocks_count + 1) / 2)
+    {
+        LevelsOffsets.push_back(levels_size);
+        levels_size += blocks_count;
+        if (blocks_count == 1)
+            break;
+    }
+    Levels.resize(levels_size);
+    Clear();
+}
+
+void ImGuiPlotBuffer::Clear()
+{
+    Count = Head = 0;
+    for (int n = 0; n < Levels.Size; n++)
+        Levels[n] = ImVec2(FLT_MAX, -FLT_MAX);
+}
+
+// Recompute blocks of all levels containing values [idx_begin, idx_end) (indices in Values[])
+static void PlotBufferUpdateBlocks(ImGuiPlotBuffer* buffer, int idx_begin, int idx_end)
+{
+    const int values_end = (buffer->Count == buffer->Values.Size) ? buffer->Values.Size : buffer->Count;
+    int block_begin = idx_begin / IM_PLOTBUFFER_BLOCK_SIZE;
+    int block_end = (idx_end - 1) / IM_PLOTBUFFER_BLOCK_SIZE + 1;
+    ImVec2* blocks = &buffer->Levels[0];
+    for (int block_n = block_begin; block_n < block_end; block_n++)
+    {
+        const int block_values_begin = block_n * IM_PLOTBUFFER_BLOCK_SIZE;
+        const int block_values_end = ImMin(block_values_begin + IM_PLOTBUFFER_BLOCK_SIZE, values_end);
+        ImVec2 min_max(FLT_MAX, -FLT_MAX);
+        PlotMinMax(buffer->Values.Data + block_values_begin, block_values_end - block_values_begin, &min_max.x, &min_max.y);
+        blocks[block_n] = min_max;
+    }
+    for (int level_n = 1; level_n < buffer->LevelsOffsets.Size; level_n++)
+    {
+        const ImVec2* child_blocks = buffer->Levels.Data + buffer->LevelsOffsets[level_n - 1];
+        const int child_blocks_count = buffer->LevelsOffsets[level_n] - buffer->LevelsOffsets[level_n - 1];
+        blocks = buffer->Levels.Data + buffer->LevelsOffsets[level_n];
+        block_begin /= 2;
+        block_end = (block_end - 1) / 2 + 1;
+        for (int block_n = block_begin; block_n < block_end; block_n++)
+        {
+            const ImVec2 a = child_blocks[block_n * 2];
+            const ImVec2 b = (block_n * 2 + 1 < child_blocks_count) ? child_blocks[block_n * 2 + 1] : a;
+            blocks[block_n] = ImVec2(ImMin(a.x, b.x), ImMax(a.y, b.y));
+        }
+    }
+}
+
+void ImGuiPlotBuffer::Append(const float* values, int values_count)
+{
+    IM_ASSERT(Values.Size > 0 && "Call Init() first.");
+    const int capacity = Values.Size;
+    if (values_count > capacity)
+    {
+        // Only the last 'capacity' values are kept
+        Head = (Head + values_count - capacity) % capacity;
+        values += values_count - capacity;
+        values_count = capacity;
+    }
+    Count = ImMin(Count + values_count, capacity);
+    while (values_count > 0)
+    {
+        const int n = ImMin(values_count, capacity - Head);
+        memcpy(Values.Data + Head, values, (size_t)n * sizeof(float));
+        PlotBufferUpdateBlocks(this, Head, Head + n);
+        Head = (Head + n) % capacity;
+        values += n;
+        values_count -= n;
+    }
+}
+
+float ImGuiPlotBuffer::GetValue(int idx) const
+{
+    IM_ASSERT(idx >= 0 && idx < Count);
+    const int start = (Count == Values.Size) ? Head : 0;
+    return Values[(start + idx) % Values.Size];
+}
+
+// Min/max of values [idx_begin, idx_end) of Values[], combining at most 2 blocks per level plus less than 2 blocks of values at both ends
+static void PlotBufferMinMax(const ImGuiPlotBuffer* buffer, int idx_begin, int idx_end, float* out_min, float* out_max)
+{
+    const int values_end = (buffer->Count == buffer->Values.Size) ? buffer->Values.Size : buffer->Count;
+    int block_begin = (idx_begin + IM_PLOTBUFFER_BLOCK_SIZE - 1) / IM_PLOTBUFFER_BLOCK_SIZE;
+    int block_end = (idx_end == values_end) ? (idx_end + IM_PLOTBUFFER_BLOCK_SIZE - 1) / IM_PLOTBUFFER_BLOCK_SIZE : idx_end / IM_PLOTBUFFER_BLOCK_SIZE; // Last block is complete if it ends with the values
+    if (block_begin >= block_end)
+    {
+        PlotMinMax(buffer->Values.Data + idx_begin, idx_end - idx_begin, out_min, out_max);
+        return;
+    }
+    PlotMinMax(buffer->Values.Data + idx_begin, block_begin * IM_PLOTBUFFER_BLOCK_SIZE - idx_begin, out_min, out_max);
+    if (block_end * IM_PLOTBUFFER_BLOCK_SIZE < idx_end)
+        PlotMinMax(buffer->Values.Data + block_end * IM_PLOTBUFFER_BLOCK_SIZE, idx_end - block_end * IM_PLOTBUFFER_BLOCK_SIZE, out_min, out_max);
+    for (int level_n = 0; block_begin < block_end; level_n++)
+    {
+        const ImVec2* blocks = buffer->Levels.Data + buffer->LevelsOffsets[level_n];
+        if (block_begin & 1)
+        {
+            *out_min = ImMin(*out_min, blocks[block_begin].x);
+            *out_max = ImMax(*out_max, blocks[block_begin].y);
+            block_begin++;
+        }
+        if (block_end & 1)
+        {
+            block_end--;
+            *out_min = ImMin(*out_min, blocks[block_end].x);
+            *out_max = ImMax(*out_max, blocks[block_end].y);
+        }
+        block_begin >>= 1;
+        block_end >>= 1;
+    }
+}
+
+bool ImGuiPlotBuffer::GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= Count);
+    float v_min = FLT_MAX;
+    float v_max = -FLT_MAX;
+    if (idx_begin < idx_end)
+    {
+        // Oldest value is at Values[Head] once full: the range may wrap around
+        const int capacity = Values.Size;
+        const int begin = (Count == capacity) ? (Head + idx_begin) % capacity : idx_begin;
+        const int n = ImMin(idx_end - idx_begin, capacity - begin);
+        PlotBufferMinMax(this, begin, begin + n, &v_min, &v_max);
+        if (n < idx_end - idx_begin)
+            PlotBufferMinMax(this, 0, idx_end - idx_begin - n, &v_min, &v_max);
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+    return v_min <= v_max;
+}
+
+struct ImGuiPlotArrayGetterData
+{
+    const float* Values;
+    int Stride;
+
+    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
+};
 
+static float Plot_ArrayGetter(void* data, int idx)
+{
+    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
+    return v;
+}
+
+static float Plot_BufferGetter(void* data, int idx)
+{
+    return ((const ImGuiPlotBuffer*)data)->GetValue(idx);
+}
+
+// Shared by PlotEx() and PlotBufferEx(): submit the item and render its frame. Return false when clipped.
+static bool PlotItemAdd(const char* label, ImVec2 frame_size, ImRect* out_frame_bb, ImRect* out_inner_bb, bool* out_hovered)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
 
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = ImGui::CalcTextSize(label, NULL, true);
     if (frame_size.x == 0.0f)
-        frame_size.x = CalcItemWidth();
+        frame_size.x = ImGui::CalcItemWidth();
     if (frame_size.y == 0.0f)
         frame_size.y = label_size.y + (style.FramePadding.y * 2);
 
     const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
     const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
     const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
-    ItemSize(total_bb, style.FramePadding.y);
-    if (!ItemAdd(total_bb, 0, &frame_bb))
+    ImGui::ItemSize(total_bb, style.FramePadding.y);
+    if (!ImGui::ItemAdd(total_bb, 0, &frame_bb))
+        return false;
+    *out_frame_bb = frame_bb;
+    *out_inner_bb = inner_bb;
+    *out_hovered = ImGui::ItemHoverable(frame_bb, id);
+    ImGui::RenderFrame(frame_bb.Min, frame_bb.Max, ImGui::GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+    return true;
+}
+
+static void PlotRenderOverlayAndLabel(const ImRect& frame_bb, const ImRect& inner_bb, const char* label, const char* overlay_text)
+{
+    ImGuiContext& g = *GImGui;
+    const ImGuiStyle& style = g.Style;
+    if (overlay_text)
+        ImGui::RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
+    if (ImGui::FindRenderedTextEnd(label) != label)
+        ImGui::RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+}
+
+namespace ImGui
+{
+    static int          PlotValuesEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, const float* values_array, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size);
+}
+
+// 'values_array': when the values are a contiguous array of floats, computes the scale from it directly rather than calling the getter for every value.
+static int ImGui::PlotValuesEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, const float* values_array, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return -1;
+
+    ImRect frame_bb, inner_bb;
+    bool hovered;
+    if (!PlotItemAdd(label, frame_size, &frame_bb, &inner_bb, &hovered))
         return -1;
-    const bool hovered = ItemHoverable(frame_bb, id);
 
     // Determine scale from values if not specified
     if (scale_min == FLT_MAX || scale_max == FLT_MAX)
     {
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
+        if (values_array != NULL)
         {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
+            PlotMinMax(values_array, values_count, &v_min, &v_max);
+        }
+        else
+        {
+            for (int i = 0; i < values_count; i++)
+            {
+                const float v = values_getter(data, i);
+                if (v != v) // Ignore NaN values
+                    continue;
+                v_min = ImMin(v_min, v);
+                v_max = ImMax(v_max, v);
+            }
         }
         if (scale_min == FLT_MAX)
             scale_min = v_min;
@@ -6472,13 +7133,11 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
             scale_max = v_max;
     }
 
-    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
-
     const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
     int idx_hovered = -1;
     if (values_count >= values_count_min)
     {
-        int res_w = ImMin((int)frame_size.x, values_count) + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
+        int res_w = ImMin((int)frame_bb.GetWidth(), values_count) + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
         int item_count = values_count + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
 
         // Tooltip on hover
@@ -6535,37 +7194,91 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         }
     }
 
-    // Text overlay
-    if (overlay_text)
-        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
-
-    if (label_size.x > 0.0f)
-        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+    PlotRenderOverlayAndLabel(frame_bb, inner_bb, label, overlay_text);
 
     // Return hovered index or -1 if none are hovered.
     // This is currently not exposed in the public API because we need a larger redesign of the whole thing, but in the short-term we are making it available in PlotEx().
     return idx_hovered;
 }
 
-struct ImGuiPlotArrayGetterData
+int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
 {
-    const float* Values;
-    int Stride;
-
-    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
-};
+    return PlotValuesEx(plot_type, label, values_getter, data, NULL, values_count, values_offset, overlay_text, scale_min, scale_max, frame_size);
+}
 
-static float Plot_ArrayGetter(void* data, int idx)
+// Same as PlotEx() reading values from an ImGuiPlotBuffer: the scale comes from its min/max pyramid,
+// and when there are more values than pixel columns each column draws the min/max of the values it covers.
+int ImGui::PlotBufferEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
 {
-    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
-    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
-    return v;
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return -1;
+
+    const int values_count = buffer->Count;
+    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    {
+        float v_min = FLT_MAX;
+        float v_max = -FLT_MAX;
+        buffer->GetMinMax(0, values_count, &v_min, &v_max);
+        if (scale_min == FLT_MAX)
+            scale_min = v_min;
+        if (scale_max == FLT_MAX)
+            scale_max = v_max;
+    }
+
+    // Few enough values to draw each of them
+    if (frame_size.x == 0.0f)
+        frame_size.x = CalcItemWidth();
+    const int columns_count = (int)(frame_size.x - g.Style.FramePadding.x * 2);
+    if (columns_count <= 0 || values_count <= columns_count)
+        return PlotEx(plot_type, label, &Plot_BufferGetter, (void*)buffer, values_count, 0, overlay_text, scale_min, scale_max, frame_size);
+
+    ImRect frame_bb, inner_bb;
+    bool hovered;
+    if (!PlotItemAdd(label, frame_size, &frame_bb, &inner_bb, &hovered))
+        return -1;
+
+    // Min/max envelope: each pixel column covers values [idx_begin, idx_end), lines also cover the segment from the previous value
+    int idx_hovered = -1;
+    const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+    const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);
+    const int column_hovered = (hovered && inner_bb.Contains(g.IO.MousePos)) ? (int)(g.IO.MousePos.x - inner_bb.Min.x) : -1;
+    const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+    const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+    for (int column_n = 0; column_n < columns_count; column_n++)
+    {
+        const int idx_begin = (int)((ImS64)column_n * values_count / columns_count);
+        const int idx_end = (int)((ImS64)(column_n + 1) * values_count / columns_count);
+        float v_min, v_max;
+        if (!buffer->GetMinMax((plot_type == ImGuiPlotType_Lines && idx_begin > 0) ? idx_begin - 1 : idx_begin, idx_end, &v_min, &v_max))
+            continue;
+        if (column_n == column_hovered)
+        {
+            SetTooltip("%d..%d: min %8.4g, max %8.4g", idx_begin, idx_end - 1, v_min, v_max);
+            idx_hovered = idx_begin;
+        }
+        float t_min = 1.0f - ImSaturate((v_min - scale_min) * inv_scale);
+        float t_max = 1.0f - ImSaturate((v_max - scale_min) * inv_scale);
+        if (plot_type == ImGuiPlotType_Histogram)
+        {
+            t_min = ImMax(t_min, histogram_zero_line_t);
+            t_max = ImMin(t_max, histogram_zero_line_t);
+        }
+        const float x = inner_bb.Min.x + (float)column_n;
+        const float y_max = ImFloor(ImLerp(inner_bb.Min.y, inner_bb.Max.y, t_max));
+        const float y_min = ImMax(ImFloor(ImLerp(inner_bb.Min.y, inner_bb.Max.y, t_min)), y_max + 1.0f);
+        window->DrawList->AddRectFilled(ImVec2(x, y_max), ImVec2(x + 1.0f, y_min), column_n == column_hovered ? col_hovered : col_base);
+    }
+
+    PlotRenderOverlayAndLabel(frame_bb, inner_bb, label, overlay_text);
+    return idx_hovered;
 }
 
 void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
     ImGuiPlotArrayGetterData data(values, stride);
-    PlotEx(ImGuiPlotType_Lines, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
+    PlotValuesEx(ImGuiPlotType_Lines, label, &Plot_ArrayGetter, (void*)&data, (stride == sizeof(float)) ? values : NULL, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
 void ImGui::PlotLines(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
@@ -6576,7 +7289,7 @@ void ImGui::PlotLines(const char* label, float (*values_getter)(void* data, int
 void ImGui::PlotHistogram(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
     ImGuiPlotArrayGetterData data(values, stride);
-    PlotEx(ImGuiPlotType_Histogram, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
+    PlotValuesEx(ImGuiPlotType_Histogram, label, &Plot_ArrayGetter, (void*)&data, (stride == sizeof(float)) ? values : NULL, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
 void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
@@ -6584,6 +7297,16 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGui::PlotLines(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotBufferEx(ImGuiPlotType_Lines, label, buffer, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotBufferEx(ImGuiPlotType_Histogram, label, buffer, overlay_text, scale_min, scale_max, graph_size);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
@@ -57,7 +57,6 @@ int main()
 
 
     std::cout << glGetString(GL_VERSION) << std::endl;
-	glViewport(0, 0, 800, 800);
 
 	bool drawTriangle = true;
 	float size = 0.8f;
@@ -69,7 +68,10 @@ int main()
 	ImGuiIO& io = ImGui::GetIO();
 	ImGui::StyleColorsDark();
 	ImGui_ImplGlfw_InitForOpenGL(window, true);
-	if(!ImGui_ImplOpenGL2_Init()) std::cout << "Failed to initit OpenGL 2" << std::endl;
+	// Only render when something changed instead of redrawing the same frame continuously
+	ImGui_ImplGlfw_SetPowerSaving(true);
+	// We restore our own state around the triangle draw, so the backend doesn't need to backup/restore GL state every frame
+	if(!ImGui_ImplOpenGL2_Init(ImGui_ImplOpenGL2_Flags_UseBufferObjects | ImGui_ImplOpenGL2_Flags_HostOwnsState | ImGui_ImplOpenGL2_Flags_FontAlpha8, glfwGetProcAddress)) std::cout << "Failed to initit OpenGL 2" << std::endl;
 
 
 	unsigned int v_sh=glCreateShader(GL_VERTEX_SHADER);
@@ -110,8 +112,6 @@ int main()
 	glUniform1f(glGetUniformLocation(sh, "scale"), size);
 	glUniform4f(glGetUniformLocation(sh, "u_color"), color[0], color[1], color[2], color[3]);
 
-	glEnable(GL_DEPTH_TEST);
-
 	while (!glfwWindowShouldClose(window))
 	{
 		glClearColor(0.07f, 0.13f, 0.17f, 1.0f);
@@ -129,8 +129,20 @@ int main()
 		ImGui::Checkbox("Draw Triangle", &drawTriangle);
 		ImGui::SliderFloat("Size", &size, 0.1f, 2.0f);
 		ImGui::ColorEdit4("Color", color);
+		const ImGui_ImplGlfw_Stats& stats = ImGui_ImplGlfw_GetStats();
+		ImGui::Text("%.1f FPS, %.0f%% idle", stats.FramesPerSecond, stats.IdleRatio * 100.0f);
 		ImGui::End();
 
+		// The backend doesn't restore GL state (HostOwnsState): set what the triangle needs, then put back what the backend left
+		// (the viewport is the same for both, and matches the framebuffer after a resize)
+		int fb_width, fb_height;
+		glfwGetFramebufferSize(window, &fb_width, &fb_height);
+		glViewport(0, 0, fb_width, fb_height);
+		const GLboolean last_blend = glIsEnabled(GL_BLEND);
+		const GLboolean last_scissor = glIsEnabled(GL_SCISSOR_TEST);
+		glDisable(GL_BLEND);
+		glDisable(GL_SCISSOR_TEST);
+		glEnable(GL_DEPTH_TEST);
 		glUseProgram(sh);
 		glUniform1f(glGetUniformLocation(sh, "scale"), size);
 		glUniform4f(glGetUniformLocation(sh, "u_color"), color[0], color[1], color[2], color[3]);
@@ -138,12 +150,15 @@ int main()
 		if(drawTriangle) glDrawArrays(GL_TRIANGLES,0,3);
 		glBindVertexArray(0);
 		glUseProgram(0);
+		glDisable(GL_DEPTH_TEST);
+		if (last_blend) glEnable(GL_BLEND);
+		if (last_scissor) glEnable(GL_SCISSOR_TEST);
 
 		//End of render
 		ImGui::Render();
 		ImGui_ImplOpenGL2_RenderDrawData(ImGui::GetDrawData());
 		glfwSwapBuffers(window);
-		glfwPollEvents();
+		ImGui_ImplGlfw_WaitForEvents();
 	}
 
 	ImGui_ImplOpenGL2_Shutdown();